@@ -134,5 +134,6 @@ echo ""
 echo "========================================"
 echo "Build successful!"
 echo "Library: $OUTPUT_DIR"
+echo "Benchmark: $NATIVE_BUILD_DIR/bin/zvec_c_bench"
 ls -lh "$OUTPUT_DIR"
 echo "========================================"
@@ -1,7 +1,24 @@
 #include "zvec_c.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
 #include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <list>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -13,12 +30,401 @@
 #include <zvec/db/query_params.h>
 #include <zvec/db/index_params.h>
 
+#ifdef ZVEC_C_WITH_ARROW
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/ipc/writer.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/properties.h>
+#endif
+
 using namespace zvec;
 
+// Fixed-size pool of worker threads; tasks run in submission order.
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t threads) {
+        workers_.reserve(threads);
+        for (size_t i = 0; i < threads; i++) {
+            workers_.emplace_back([this] { run(); });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto& t : workers_) t.join();
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    size_t size() const { return workers_.size(); }
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+private:
+    void run() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+};
+
+// Helper: run fn(0..count) on the pool, with the calling thread taking indices too.
+// Only helpers that claimed an index are waited for, so a helper still queued
+// behind other work never holds up the caller.
+static void parallel_for(WorkerPool& pool, size_t count, const std::function<void(size_t)>& fn) {
+    struct State {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> active{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+    auto state = std::make_shared<State>();
+
+    auto drain = [state, count, &fn] {
+        state->active++;
+        for (size_t i; (i = state->next++) < count;) {
+            fn(i);
+        }
+        if (--state->active == 0) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->cv.notify_all();
+        }
+    };
+
+    size_t helpers = std::min(pool.size(), count) - 1;
+    for (size_t h = 0; h < helpers; h++) {
+        pool.submit(drain);
+    }
+    drain();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&state] { return state->active == 0; });
+}
+
+// Bounded LRU of query hits. Each entry records the collection's write epoch it was
+// computed under; once a write has moved the epoch on, the entry counts as a miss.
+class QueryCache {
+public:
+    explicit QueryCache(size_t capacity) : capacity_(capacity) {}
+
+    bool lookup(const std::string& key, uint64_t epoch, DocPtrList& hits) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end() || it->second->epoch != epoch) {
+            if (it != index_.end()) {
+                entries_.erase(it->second);
+                index_.erase(it);
+            }
+            stats_.misses++;
+            return false;
+        }
+        entries_.splice(entries_.begin(), entries_, it->second);
+        hits = it->second->hits;
+        stats_.hits++;
+        return true;
+    }
+
+    void store(const std::string& key, uint64_t epoch, const DocPtrList& hits) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            // A slower query computed under an older epoch must not replace a newer result.
+            if (it->second->epoch > epoch) return;
+            it->second->epoch = epoch;
+            it->second->hits = hits;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return;
+        }
+        entries_.push_front(Entry{key, epoch, hits});
+        index_.emplace(key, entries_.begin());
+        while (entries_.size() > capacity_) {
+            index_.erase(entries_.back().key);
+            entries_.pop_back();
+            stats_.evictions++;
+        }
+    }
+
+    size_t capacity() const { return capacity_; }
+
+    zvec_query_cache_stats_t stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto stats = stats_;
+        stats.entries = entries_.size();
+        return stats;
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        uint64_t epoch;
+        DocPtrList hits;
+    };
+
+    size_t capacity_;
+    std::list<Entry> entries_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    zvec_query_cache_stats_t stats_{};
+    mutable std::mutex mutex_;
+};
+
+// Process-wide latency histograms, one per ZVEC_OP_*. Each thread records into one of a
+// few stripes with relaxed atomics, so concurrent calls rarely share a cache line.
+class Metrics {
+public:
+    static Metrics& instance() {
+        static Metrics metrics;
+        return metrics;
+    }
+
+    void record(int op, uint64_t ns, bool failed) {
+        auto& h = stripes_[stripe()].ops[op];
+        h.count.fetch_add(1, std::memory_order_relaxed);
+        if (failed) h.errors.fetch_add(1, std::memory_order_relaxed);
+        h.total_ns.fetch_add(ns, std::memory_order_relaxed);
+        h.buckets[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+        uint64_t max = h.max_ns.load(std::memory_order_relaxed);
+        while (ns > max && !h.max_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {}
+    }
+
+    void snapshot(int op, zvec_op_metrics_t& out) const {
+        out = zvec_op_metrics_t{};
+        for (const auto& stripe : stripes_) {
+            const auto& h = stripe.ops[op];
+            out.count += h.count.load(std::memory_order_relaxed);
+            out.errors += h.errors.load(std::memory_order_relaxed);
+            out.total_ns += h.total_ns.load(std::memory_order_relaxed);
+            out.max_ns = std::max(out.max_ns, h.max_ns.load(std::memory_order_relaxed));
+            for (size_t b = 0; b < ZVEC_METRIC_BUCKETS; b++) {
+                out.buckets[b] += h.buckets[b].load(std::memory_order_relaxed);
+            }
+        }
+        out.p50_ns = percentile(out, 0.50);
+        out.p90_ns = percentile(out, 0.90);
+        out.p99_ns = percentile(out, 0.99);
+    }
+
+    void reset() {
+        for (auto& stripe : stripes_) {
+            for (auto& h : stripe.ops) {
+                h.count.store(0, std::memory_order_relaxed);
+                h.errors.store(0, std::memory_order_relaxed);
+                h.total_ns.store(0, std::memory_order_relaxed);
+                h.max_ns.store(0, std::memory_order_relaxed);
+                for (auto& b : h.buckets) b.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Values below 4 ns get their own bucket; above that, four buckets per power of two.
+    static size_t bucket_of(uint64_t ns) {
+        if (ns < 4) return static_cast<size_t>(ns);
+        size_t msb = 0;
+        for (uint64_t v = ns; v > 1; v >>= 1) msb++;
+        size_t bucket = (msb - 1) * 4 + static_cast<size_t>((ns >> (msb - 2)) & 3);
+        return std::min<size_t>(bucket, ZVEC_METRIC_BUCKETS - 1);
+    }
+
+    static uint64_t bucket_upper(size_t bucket) {
+        if (bucket < 4) return bucket;
+        if (bucket >= ZVEC_METRIC_BUCKETS - 1) return UINT64_MAX;
+        size_t msb = bucket / 4 + 1;
+        uint64_t width = uint64_t{1} << (msb - 2);
+        return (4 + bucket % 4) * width + width - 1;
+    }
+
+private:
+    static constexpr size_t kStripes = 8;
+
+    struct Histogram {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> errors{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+        std::atomic<uint64_t> buckets[ZVEC_METRIC_BUCKETS] = {};
+    };
+
+    struct alignas(64) Stripe {
+        Histogram ops[ZVEC_OP_COUNT];
+    };
+
+    static size_t stripe() {
+        static std::atomic<size_t> next{0};
+        thread_local const size_t index = next.fetch_add(1, std::memory_order_relaxed) % kStripes;
+        return index;
+    }
+
+    static uint64_t percentile(const zvec_op_metrics_t& m, double q) {
+        if (m.count == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(m.count)));
+        uint64_t seen = 0;
+        for (size_t b = 0; b < ZVEC_METRIC_BUCKETS; b++) {
+            seen += m.buckets[b];
+            if (seen >= rank) return std::min(bucket_upper(b), m.max_ns);
+        }
+        return m.max_ns;
+    }
+
+    Stripe stripes_[kStripes];
+};
+
+// Times one call or phase into its ZVEC_OP_* histogram when it goes out of scope
+class OpTimer {
+public:
+    explicit OpTimer(int op) : op_(op), start_(std::chrono::steady_clock::now()) {}
+    OpTimer(const OpTimer&) = delete;
+    OpTimer& operator=(const OpTimer&) = delete;
+
+    ~OpTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        Metrics::instance().record(op_,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+            failed_);
+    }
+
+    zvec_status_t finish(zvec_status_t status) {
+        failed_ = status.code != 0;
+        return status;
+    }
+
+private:
+    int op_;
+    std::chrono::steady_clock::time_point start_;
+    bool failed_ = false;
+};
+
+// Helper: run fn as one timed phase and pass its value through
+template <typename Fn>
+static auto timed(int op, Fn&& fn) -> decltype(fn()) {
+    OpTimer timer(op);
+    return fn();
+}
+
+// State of a collection's background optimize thread; guarded by mutex
+struct AutoOptimizer {
+    zvec_optimize_policy_t policy{};
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+    bool paused = false;
+    bool running = false;
+    uint64_t runs = 0;
+    uint64_t failures = 0;
+    uint64_t last_duration_ms = 0;
+    int32_t last_status_code = 0;
+    std::chrono::steady_clock::time_point next_run{};
+    std::thread thread;
+};
+
 // Internal structures wrapping zvec objects
+// Interned field name with its schema type; lives in its collection's deque so ids stay
+// valid as more are resolved
+struct zvec_field_t {
+    std::string name;
+    DataType data_type;
+    uint32_t dimension;
+};
+
+// Counters of the running or last warmup, read while it runs
+struct WarmupProgress {
+    std::atomic<uint64_t> files_total{0};
+    std::atomic<uint64_t> files_loaded{0};
+    std::atomic<uint64_t> bytes_total{0};
+    std::atomic<uint64_t> bytes_loaded{0};
+    std::atomic<uint64_t> queries_total{0};
+    std::atomic<uint64_t> queries_run{0};
+    std::atomic<bool> running{false};
+
+    zvec_warmup_progress_t snapshot() const {
+        return {files_total.load(), files_loaded.load(), bytes_total.load(), bytes_loaded.load(),
+            queries_total.load(), queries_run.load(), running.load() ? 1 : 0};
+    }
+};
+
 struct zvec_collection_t {
     Collection::Ptr ptr;
     std::string path_cache;
+    int32_t index_build_parallel = 0;
+    bool auto_flush = false;
+    std::atomic<bool> bulk_loading{false};
+    std::vector<std::pair<std::string, IndexParams::Ptr>> deferred_indexes;
+    int32_t query_parallel = 0;
+    std::once_flag pool_once;
+    std::unique_ptr<WorkerPool> pool;
+    std::mutex fields_mutex;
+    std::deque<zvec_field_t> fields;
+    std::atomic<uint64_t> write_epoch{0};
+    std::unique_ptr<QueryCache> query_cache;
+    std::mutex optimize_mutex;                      // one Optimize at a time
+    std::atomic<uint64_t> pending_writes{0};        // since the last optimize
+    std::atomic<uint64_t> pending_deletes{0};
+    std::mutex optimizer_mutex;                     // guards optimizer start/stop
+    std::unique_ptr<AutoOptimizer> optimizer;
+    std::atomic<bool> auto_optimize{false};
+    std::mutex query_defaults_mutex;
+    std::unordered_map<std::string, zvec_query_params_t> query_defaults;  // per field
+    std::atomic<bool> has_query_defaults{false};
+    bool read_only = false;                          // ptr is swapped by zvec_collection_refresh
+    bool snapshot = false;                           // pinned by zvec_collection_snapshot_create; never refreshed
+    // Live snapshots of this writer; while any is open nothing that deletes segment or
+    // index files runs. A snapshot shares its writer's counter and decrements it on release.
+    std::shared_ptr<std::atomic<int>> snapshot_pins = std::make_shared<std::atomic<int>>(0);
+    std::shared_ptr<std::atomic<int>> pinned_writer;
+    std::mutex warmup_mutex;                         // held by the running warmup
+    WarmupProgress warmup;
+    std::atomic<bool> warmup_cancelled{false};
+};
+
+// Helper: the handle's engine collection. Read-only handles swap it on refresh,
+// so it is loaded atomically and callers keep their own reference.
+static Collection::Ptr engine(const zvec_collection_t* col) {
+    return col->read_only ? std::atomic_load(&col->ptr) : col->ptr;
+}
+
+static zvec_status_t read_only_status() {
+    return {2, "collection is opened read-only"};
+}
+
+// Helper: whether an open snapshot needs this handle's current files kept on disk
+static bool snapshot_pinned(const zvec_collection_t* col) {
+    return col->snapshot_pins->load() > 0;
+}
+
+static zvec_status_t snapshot_pinned_status() {
+    return {2, "collection has open snapshots; release them before optimizing or changing indexes"};
+}
+
+// Shared by the queued task and, when requested, the caller; freed by whoever releases last
+struct zvec_async_op_t {
+    std::atomic<bool> cancelled{false};
+    std::atomic<int> refs{1};
 };
 
 struct zvec_doc_t {
@@ -27,8 +433,39 @@ struct zvec_doc_t {
     std::vector<float> vector_cache;
 };
 
+// Slots live in a deque so handles stay valid as the batch grows. Clear keeps the slots,
+// but each add resets its document, so field payloads are allocated per fill.
+struct zvec_doc_batch_t {
+    std::deque<zvec_doc_t> slots;
+    size_t count = 0;
+    std::vector<Doc> staging;
+};
+
+// Result-owned buffers for one exported column
+struct ExportColumn {
+    std::vector<uint8_t> values;
+    std::vector<int32_t> offsets;
+    std::vector<uint8_t> null_bitmap;
+};
+
 struct zvec_result_t {
-    std::vector<zvec_doc_t> docs;
+    DocPtrList hits;
+    std::vector<zvec_doc_t> docs;  // per-doc handles, built on first zvec_result_get_doc
+    std::string pk_data;
+    std::vector<int32_t> pk_offsets;
+    std::vector<double> scores;
+    std::vector<ExportColumn> columns;
+    bool truncated = false;  // an id-filtered search hit its candidate cap short of topk
+};
+
+// Keys matched when the scan opened; each page of batch_size keys is fetched on demand.
+// The engine is held so a refreshed handle does not switch instances mid-scan.
+struct zvec_scan_t {
+    Collection::Ptr col;
+    std::vector<std::string> keys;
+    std::vector<std::string> hidden_fields;  // nulled on fetched docs to honour the projection
+    size_t next = 0;
+    size_t batch_size = 0;
 };
 
 struct zvec_schema_t {
@@ -36,27 +473,92 @@ struct zvec_schema_t {
     std::string name_cache;
 };
 
+// Primary keys resolved once for id-filtered queries. id tells sets apart in
+// query cache keys without hashing their contents.
+struct IdSet {
+    std::unordered_set<std::string> pks;
+    uint64_t id = 0;
+};
+
+static std::atomic<uint64_t> g_next_id_set{1};
+
+struct zvec_id_set_t {
+    std::shared_ptr<const IdSet> set;
+};
+
+struct IdFilter {
+    std::shared_ptr<const IdSet> set;  // null when the query is unrestricted
+    int32_t mode = ZVEC_ID_FILTER_NONE;
+};
+
 struct zvec_query_t {
     VectorQuery query;
     std::string field_name_cache;
     std::string filter_cache;
     std::vector<std::string> output_fields_cache;
     std::vector<const char*> output_fields_ptrs;
-    std::vector<float> vector_cache;
+    std::vector<float> sparse_values_cache;
+    zvec_query_params_t params{};
+    bool has_params = false;
+    zvec_query_params_t applied_params{};   // params, or the field's defaults; set by prepare_query
+    bool has_applied_params = false;
+    IdFilter id_filter;
+};
+
+// A query shape frozen by zvec_collection_prepare_query. Executions borrow a
+// copy of query from idle, so its strings keep their capacity across calls
+// and rebinding the vector does not allocate once the pool is warm.
+struct zvec_prepared_query_t {
+    zvec_collection_t* col = nullptr;
+    VectorQuery query;
+    IdFilter id_filter;
+    std::string key_prefix;  // query cache key without the vector; empty when the cache is off
+
+    std::mutex idle_mutex;
+    std::vector<std::unique_ptr<VectorQuery>> idle;
+
+    std::unique_ptr<VectorQuery> acquire() {
+        {
+            std::lock_guard<std::mutex> lock(idle_mutex);
+            if (!idle.empty()) {
+                auto q = std::move(idle.back());
+                idle.pop_back();
+                return q;
+            }
+        }
+        return std::make_unique<VectorQuery>(query);
+    }
+
+    void release(std::unique_ptr<VectorQuery> q) {
+        std::lock_guard<std::mutex> lock(idle_mutex);
+        idle.push_back(std::move(q));
+    }
 };
 
-// Helper: convert zvec Status to C status
+// Helper: convert zvec Status to C status. The message is copied into a
+// per-thread buffer so it outlives the (usually temporary) Status; it stays
+// valid until the next failing call on the same thread.
 static zvec_status_t to_c_status(const Status& s) {
     if (s.ok()) {
         return {0, nullptr};
     }
-    return {static_cast<int32_t>(s.code()), s.c_str()};
+    thread_local std::string message;
+    message = s.c_str();
+    return {static_cast<int32_t>(s.code()), message.c_str()};
 }
 
 static zvec_status_t ok_status() {
     return {0, nullptr};
 }
 
+// Helper: a failure whose message is built here; like to_c_status, the message is
+// copied to a per-thread buffer so it outlives the reader or writer that produced it
+static zvec_status_t message_status(const std::string& message) {
+    thread_local std::string text;
+    text = message;
+    return {2, text.c_str()};
+}
+
 // Helper: convert C field_def to IndexParams
 static IndexParams::Ptr create_index_params(const zvec_field_def_t* def) {
     if (!def) return nullptr;
@@ -88,6 +590,25 @@ static IndexParams::Ptr create_index_params(const zvec_field_def_t* def) {
     }
 }
 
+// Helper: copy vector index parameters onto a field_def; the inverse of create_index_params
+static void fill_index_def(zvec_field_def_t& def, const IndexParams* params) {
+    if (!params) return;
+    auto* vec_params = dynamic_cast<const VectorIndexParams*>(params);
+    if (vec_params) {
+        def.metric_type = static_cast<int32_t>(vec_params->metric_type());
+        def.quantize_type = static_cast<int32_t>(vec_params->quantize_type());
+    }
+    auto* hnsw_params = dynamic_cast<const HnswIndexParams*>(params);
+    if (hnsw_params) {
+        def.m = hnsw_params->m();
+        def.ef_construction = hnsw_params->ef_construction();
+    }
+    auto* ivf_params = dynamic_cast<const IVFIndexParams*>(params);
+    if (ivf_params) {
+        def.n_lists = ivf_params->n_list();
+    }
+}
+
 // Helper: convert C field_def to FieldSchema
 static FieldSchema::Ptr create_field_schema(const zvec_field_def_t* def) {
     if (!def || !def->name) return nullptr;
@@ -106,591 +627,3899 @@ static FieldSchema::Ptr create_field_schema(const zvec_field_def_t* def) {
     return field;
 }
 
-extern "C" {
-
-// ===== Version =====
-const char* zvec_version() {
-    return "0.2.0";
+// Helper: bit `row` of an LSB-first null bitmap
+static inline bool column_is_null(const zvec_column_t& col, size_t row) {
+    return col.null_bitmap && ((col.null_bitmap[row >> 3] >> (row & 7)) & 1);
 }
 
-// ===== Document =====
-zvec_doc_handle_t zvec_doc_create() {
-    return new zvec_doc_t();
+template <typename T>
+static void fill_scalar_column(std::vector<Doc>& docs, const std::string& name,
+    const zvec_column_t& col, size_t begin, size_t end) {
+    const T* values = static_cast<const T*>(col.values);
+    for (size_t i = begin; i < end; i++) {
+        if (column_is_null(col, i)) {
+            docs[i].set_null(name);
+        } else {
+            docs[i].set<T>(name, values[i]);
+        }
+    }
 }
 
-void zvec_doc_destroy(zvec_doc_handle_t handle) {
-    delete handle;
+template <typename T>
+static void fill_vector_column(std::vector<Doc>& docs, const std::string& name,
+    const zvec_column_t& col, size_t begin, size_t end) {
+    const T* values = static_cast<const T*>(col.values);
+    const size_t dim = static_cast<size_t>(col.dimension);
+    for (size_t i = begin; i < end; i++) {
+        if (column_is_null(col, i)) continue;
+        const T* row = values + i * dim;
+        docs[i].set<std::vector<T>>(name, std::vector<T>(row, row + dim));
+    }
 }
 
-void zvec_doc_set_pk(zvec_doc_handle_t handle, const char* pk) {
-    if (handle && pk) {
-        handle->doc.set_pk(std::string(pk));
-        handle->pk_cache = pk;
+static void fill_column(std::vector<Doc>& docs, const std::string& name,
+    const zvec_column_t& col, size_t begin, size_t end) {
+    switch (col.data_type) {
+        case ZVEC_DATA_TYPE_BOOL: {
+            const uint8_t* values = static_cast<const uint8_t*>(col.values);
+            for (size_t i = begin; i < end; i++) {
+                if (column_is_null(col, i)) {
+                    docs[i].set_null(name);
+                } else {
+                    docs[i].set<bool>(name, values[i] != 0);
+                }
+            }
+            break;
+        }
+        case ZVEC_DATA_TYPE_STRING: {
+            const char* bytes = static_cast<const char*>(col.values);
+            for (size_t i = begin; i < end; i++) {
+                if (column_is_null(col, i)) {
+                    docs[i].set_null(name);
+                } else {
+                    docs[i].set<std::string>(name,
+                        std::string(bytes + col.offsets[i], col.offsets[i + 1] - col.offsets[i]));
+                }
+            }
+            break;
+        }
+        case ZVEC_DATA_TYPE_INT32:  fill_scalar_column<int32_t>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_INT64:  fill_scalar_column<int64_t>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_UINT32: fill_scalar_column<uint32_t>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_UINT64: fill_scalar_column<uint64_t>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_FLOAT:  fill_scalar_column<float>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_DOUBLE: fill_scalar_column<double>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_VECTOR_FP16:  fill_vector_column<float16_t>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_VECTOR_FP32:  fill_vector_column<float>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_VECTOR_FP64:  fill_vector_column<double>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_VECTOR_INT8:  fill_vector_column<int8_t>(docs, name, col, begin, end); break;
+        case ZVEC_DATA_TYPE_VECTOR_INT16: fill_vector_column<int16_t>(docs, name, col, begin, end); break;
     }
 }
 
-const char* zvec_doc_get_pk(zvec_doc_handle_t handle) {
-    if (!handle) return nullptr;
-    handle->pk_cache = handle->doc.pk();
-    return handle->pk_cache.c_str();
+// Helper: offsets of a string column start at 0 or above, never decrease and end within size bytes
+static bool check_offsets(const int32_t* offsets, size_t rows, size_t size) {
+    if (offsets[0] < 0) return false;
+    for (size_t i = 0; i < rows; i++) {
+        if (offsets[i + 1] < offsets[i]) return false;
+    }
+    return static_cast<size_t>(offsets[rows]) <= size;
 }
 
-double zvec_doc_get_score(zvec_doc_handle_t handle) {
-    return handle ? handle->doc.score() : 0.0;
+static zvec_status_t validate_column(const zvec_column_t& col, size_t rows) {
+    if (!col.name || !col.values) return {2, "null column"};
+    switch (col.data_type) {
+        case ZVEC_DATA_TYPE_BOOL:
+        case ZVEC_DATA_TYPE_INT32:
+        case ZVEC_DATA_TYPE_INT64:
+        case ZVEC_DATA_TYPE_UINT32:
+        case ZVEC_DATA_TYPE_UINT64:
+        case ZVEC_DATA_TYPE_FLOAT:
+        case ZVEC_DATA_TYPE_DOUBLE:
+            return ok_status();
+        case ZVEC_DATA_TYPE_STRING:
+            if (!col.offsets) return {2, "string column without offsets"};
+            return check_offsets(col.offsets, rows, col.values_size)
+                ? ok_status() : zvec_status_t{2, "string column offsets out of range"};
+        case ZVEC_DATA_TYPE_VECTOR_FP16:
+        case ZVEC_DATA_TYPE_VECTOR_FP32:
+        case ZVEC_DATA_TYPE_VECTOR_FP64:
+        case ZVEC_DATA_TYPE_VECTOR_INT8:
+        case ZVEC_DATA_TYPE_VECTOR_INT16:
+            return col.dimension > 0 ? ok_status() : zvec_status_t{2, "vector column without dimension"};
+        default:
+            return {2, "unsupported column data type"};
+    }
 }
 
-zvec_status_t zvec_doc_set_string(zvec_doc_handle_t handle, const char* field, const char* value) {
-    if (!handle || !field) return {2, "null argument"};
-    handle->doc.set<std::string>(field, value ? std::string(value) : std::string());
-    return ok_status();
-}
+// Rows per worker when materializing columnar batches; smaller batches stay on the caller thread.
+static constexpr size_t kColumnarRowsPerWorker = 4096;
 
-zvec_status_t zvec_doc_set_int32(zvec_doc_handle_t handle, const char* field, int32_t value) {
-    if (!handle || !field) return {2, "null argument"};
-    handle->doc.set<int32_t>(field, value);
-    return ok_status();
-}
+// Helper: materialize a columnar batch into engine documents, one row range per pool task
+static zvec_status_t build_columnar_docs(WorkerPool& pool, const zvec_column_batch_t* batch, std::vector<Doc>& docs) {
+    if (!batch->pk_data || !batch->pk_offsets) return {2, "null pk column"};
+    if (batch->column_count > 0 && !batch->columns) return {2, "null columns"};
 
-zvec_status_t zvec_doc_set_int64(zvec_doc_handle_t handle, const char* field, int64_t value) {
-    if (!handle || !field) return {2, "null argument"};
-    handle->doc.set<int64_t>(field, value);
-    return ok_status();
-}
+    const size_t rows = batch->row_count;
+    if (!check_offsets(batch->pk_offsets, rows, batch->pk_data_size)) return {2, "pk offsets out of range"};
 
-zvec_status_t zvec_doc_set_float(zvec_doc_handle_t handle, const char* field, float value) {
-    if (!handle || !field) return {2, "null argument"};
-    handle->doc.set<float>(field, value);
+    std::vector<std::string> names;
+    names.reserve(batch->column_count);
+    for (size_t c = 0; c < batch->column_count; c++) {
+        auto status = validate_column(batch->columns[c], rows);
+        if (status.code != 0) return status;
+        names.emplace_back(batch->columns[c].name);
+    }
+
+    docs.resize(rows);
+
+    auto fill_range = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const int32_t offset = batch->pk_offsets[i];
+            docs[i].set_pk(std::string(batch->pk_data + offset, batch->pk_offsets[i + 1] - offset));
+        }
+        for (size_t c = 0; c < batch->column_count; c++) {
+            fill_column(docs, names[c], batch->columns[c], begin, end);
+        }
+    };
+
+    const size_t ranges = (rows + kColumnarRowsPerWorker - 1) / kColumnarRowsPerWorker;
+    if (ranges <= 1 || pool.size() <= 1) {
+        fill_range(0, rows);
+        return ok_status();
+    }
+
+    parallel_for(pool, ranges, [&](size_t r) {
+        const size_t begin = r * kColumnarRowsPerWorker;
+        fill_range(begin, std::min(rows, begin + kColumnarRowsPerWorker));
+    });
     return ok_status();
 }
 
-zvec_status_t zvec_doc_set_double(zvec_doc_handle_t handle, const char* field, double value) {
-    if (!handle || !field) return {2, "null argument"};
-    handle->doc.set<double>(field, value);
-    return ok_status();
+// Helper: copy C collection options onto the handle
+static void apply_collection_options(zvec_collection_t* col, const zvec_collection_options_t* options) {
+    if (!options) return;
+    col->index_build_parallel = options->index_build_parallel;
+    col->auto_flush = options->auto_flush != 0;
+    col->query_parallel = options->query_parallel;
+    if (options->query_cache_size > 0) {
+        col->query_cache = std::make_unique<QueryCache>(static_cast<size_t>(options->query_cache_size));
+    }
 }
 
-zvec_status_t zvec_doc_set_bool(zvec_doc_handle_t handle, const char* field, int value) {
-    if (!handle || !field) return {2, "null argument"};
-    handle->doc.set<bool>(field, value != 0);
-    return ok_status();
+// Helper: file next to the collection that records the indexes a bulk load dropped
+static std::string bulk_load_path(const zvec_collection_t* col) {
+    return col->path_cache + ".bulk_load";
 }
 
-zvec_status_t zvec_doc_set_null(zvec_doc_handle_t handle, const char* field) {
-    if (!handle || !field) return {2, "null argument"};
-    handle->doc.set_null(field);
-    return ok_status();
+// Helper: persist the deferred indexes, one "type metric quantize m ef n_lists name" line
+// each, so a crash or close during a bulk load loses no index parameters. An empty list
+// removes the file. The file is written aside and renamed over the old one.
+static bool save_deferred_indexes(const zvec_collection_t* col) {
+    std::error_code ec;
+    const std::string path = bulk_load_path(col);
+    if (col->deferred_indexes.empty()) {
+        std::filesystem::remove(path, ec);
+        return !ec;
+    }
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::trunc);
+        for (const auto& [field_name, params] : col->deferred_indexes) {
+            zvec_field_def_t def = {};
+            fill_index_def(def, params.get());
+            out << static_cast<int32_t>(params->type()) << ' ' << def.metric_type << ' '
+                << def.quantize_type << ' ' << def.m << ' ' << def.ef_construction << ' '
+                << def.n_lists << ' ' << field_name << '\n';
+        }
+        out.flush();
+        if (!out) return false;
+    }
+    std::filesystem::rename(tmp, path, ec);
+    return !ec;
 }
 
-zvec_status_t zvec_doc_set_vector_f32(zvec_doc_handle_t handle, const char* field, const float* data, size_t len) {
-    if (!handle || !field || !data) return {2, "null argument"};
-    std::vector<float> vec(data, data + len);
-    handle->doc.set<std::vector<float>>(field, std::move(vec));
-    return ok_status();
+// Helper: restore a bulk load left active by a crash or close. Entries whose field
+// already has its index again (e.g. the drop never happened) are skipped.
+static void load_deferred_indexes(zvec_collection_t* col) {
+    std::ifstream in(bulk_load_path(col));
+    if (!in) return;
+    auto schema = engine(col)->Schema();
+    if (!schema.has_value()) return;
+
+    zvec_field_def_t def = {};
+    std::string field_name;
+    while (in >> def.index_type >> def.metric_type >> def.quantize_type >> def.m
+        >> def.ef_construction >> def.n_lists) {
+        in.get();
+        if (!std::getline(in, field_name)) break;
+        auto field = schema.value().get_field_ptr(field_name);
+        auto params = create_index_params(&def);
+        if (!field || !params || field->index_type() == params->type()) continue;
+        col->deferred_indexes.emplace_back(field_name, std::move(params));
+    }
+    col->bulk_loading = !col->deferred_indexes.empty();
 }
 
-zvec_status_t zvec_doc_set_sparse_vector_f32(zvec_doc_handle_t handle, const char* field, 
-    const uint32_t* indices, const float* values, size_t len) {
-    if (!handle || !field || !indices || !values) return {2, "null argument"};
-    std::pair<std::vector<uint32_t>, std::vector<float>> sparse;
-    sparse.first.assign(indices, indices + len);
-    sparse.second.assign(values, values + len);
-    handle->doc.set<decltype(sparse)>(field, std::move(sparse));
-    return ok_status();
+// Helper: invalidate every cached query result; called after anything that can change hits
+static void bump_write_epoch(zvec_collection_t* col) {
+    col->write_epoch.fetch_add(1, std::memory_order_acq_rel);
 }
 
-size_t zvec_doc_get_vector_f32(zvec_doc_handle_t handle, const char* field, float* out_data, size_t max_len) {
-    if (!handle || !field || !out_data) return 0;
-    auto result = handle->doc.get<std::vector<float>>(field);
-    if (result.has_value()) {
-        const auto& vec = result.value();
-        size_t copy_len = std::min(max_len, vec.size());
-        std::memcpy(out_data, vec.data(), copy_len * sizeof(float));
-        return copy_len;
+// Helper: run Optimize with the given thread count; serialized with other optimizes
+// and resets the work counted since the last one
+static Status run_optimize(zvec_collection_t* col, int32_t concurrency) {
+    std::lock_guard<std::mutex> lock(col->optimize_mutex);
+    // Compaction deletes the segment files an open snapshot reads; the work stays pending.
+    if (snapshot_pinned(col)) return Status();
+    uint64_t writes = col->pending_writes.exchange(0);
+    uint64_t deletes = col->pending_deletes.exchange(0);
+
+    OptimizeOptions optimize_options;
+    optimize_options.concurrency_ = concurrency;
+    auto status = engine(col)->Optimize(optimize_options);
+    bump_write_epoch(col);
+    if (!status.ok()) {
+        // Nothing was compacted, so the work is still pending.
+        col->pending_writes += writes;
+        col->pending_deletes += deletes;
     }
-    return 0;
+    return status;
 }
 
-int zvec_doc_has_field(zvec_doc_handle_t handle, const char* field) {
-    if (!handle || !field) return 0;
-    return handle->doc.has(field) ? 1 : 0;
+// Helper: whether the work since the last optimize crosses the policy's thresholds
+static bool optimize_due(zvec_collection_t* col, const zvec_optimize_policy_t& policy) {
+    uint64_t writes = col->pending_writes.load();
+    if (policy.pending_writes > 0 && writes >= policy.pending_writes) return true;
+
+    uint64_t deletes = col->pending_deletes.load();
+    if (policy.deleted_ratio <= 0 || deletes == 0) return false;
+    auto stats = engine(col)->Stats();
+    if (!stats.has_value()) return false;
+    double live = static_cast<double>(std::max<uint64_t>(stats.value().doc_count, 1));
+    return static_cast<double>(deletes) / live >= policy.deleted_ratio;
 }
 
-const char* zvec_doc_get_string(zvec_doc_handle_t handle, const char* field) {
-    if (!handle || !field) return nullptr;
-    auto result = handle->doc.get<std::string>(field);
-    if (result.has_value()) {
-        handle->pk_cache = result.value();
-        return handle->pk_cache.c_str();
+// Background optimize thread: wakes every check interval and runs Optimize when due
+static void auto_optimize_loop(zvec_collection_t* col, AutoOptimizer* opt) {
+    const auto policy = opt->policy;
+    const auto check_interval = std::chrono::milliseconds(policy.check_interval_ms > 0 ? policy.check_interval_ms : 1000);
+    const int32_t budget = policy.budget_percent > 0 ? std::min(policy.budget_percent, 100) : 100;
+
+    std::unique_lock<std::mutex> lock(opt->mutex);
+    while (!opt->stopping) {
+        opt->wake.wait_for(lock, check_interval);
+        if (opt->stopping) break;
+        if (opt->paused || col->bulk_loading || snapshot_pinned(col)) continue;
+        if (std::chrono::steady_clock::now() < opt->next_run) continue;
+
+        lock.unlock();
+        bool due = optimize_due(col, policy);
+        lock.lock();
+        if (!due || opt->paused || opt->stopping) continue;
+
+        opt->running = true;
+        lock.unlock();
+        auto start = std::chrono::steady_clock::now();
+        auto status = run_optimize(col, policy.concurrency > 0 ? policy.concurrency : 1);
+        auto end = std::chrono::steady_clock::now();
+        lock.lock();
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        opt->running = false;
+        opt->runs++;
+        if (!status.ok()) opt->failures++;
+        opt->last_status_code = static_cast<int32_t>(status.code());
+        opt->last_duration_ms = static_cast<uint64_t>(elapsed.count());
+        auto cooldown = std::max(
+            std::chrono::milliseconds(policy.min_interval_ms),
+            elapsed * (100 - budget) / budget);
+        opt->next_run = end + cooldown;
     }
-    return nullptr;
 }
 
-int64_t zvec_doc_get_int64(zvec_doc_handle_t handle, const char* field) {
-    if (!handle || !field) return 0;
-    auto result = handle->doc.get<int64_t>(field);
-    return result.has_value() ? result.value() : 0;
+// Helper: stop and join the background optimize thread, if any
+static void stop_auto_optimize(zvec_collection_t* col) {
+    std::unique_ptr<AutoOptimizer> opt;
+    {
+        std::lock_guard<std::mutex> lock(col->optimizer_mutex);
+        opt = std::move(col->optimizer);
+        col->auto_optimize = false;
+    }
+    if (!opt) return;
+    {
+        std::lock_guard<std::mutex> lock(opt->mutex);
+        opt->stopping = true;
+    }
+    opt->wake.notify_all();
+    opt->thread.join();
 }
 
-double zvec_doc_get_double(zvec_doc_handle_t handle, const char* field) {
-    if (!handle || !field) return 0.0;
-    auto result = handle->doc.get<double>(field);
-    return result.has_value() ? result.value() : 0.0;
-}
+// Helper: set the background optimizer's paused flag
+static zvec_status_t set_auto_optimize_paused(zvec_collection_t* col, bool paused) {
+    if (!col || !engine(col)) return {2, "null handle"};
 
-int zvec_doc_get_bool(zvec_doc_handle_t handle, const char* field) {
-    if (!handle || !field) return 0;
-    auto result = handle->doc.get<bool>(field);
-    return result.has_value() ? (result.value() ? 1 : 0) : 0;
+    std::lock_guard<std::mutex> lock(col->optimizer_mutex);
+    if (!col->optimizer) return {2, "auto optimize not running"};
+    {
+        std::lock_guard<std::mutex> opt_lock(col->optimizer->mutex);
+        col->optimizer->paused = paused;
+    }
+    col->optimizer->wake.notify_all();
+    return ok_status();
 }
 
-// ===== Schema Creation =====
-zvec_schema_handle_t zvec_schema_create(const char* name) {
-    if (!name) return nullptr;
-    auto* schema = new zvec_schema_t();
-    schema->schema = CollectionSchema(std::string(name));
-    return schema;
+// Caller's arrays for a *_with_status write; without one a write stops at its first failure
+struct DocStatusOut {
+    zvec_doc_status_t* statuses;
+    size_t* failed;
+};
+
+// Distinct messages of the calling thread's last *_with_status write
+static std::vector<std::string>& write_status_messages() {
+    thread_local std::vector<std::string> messages;
+    return messages;
 }
 
-void zvec_schema_destroy(zvec_schema_handle_t handle) {
-    delete handle;
+// Helper: fill the caller's per-document statuses; messages are interned so a
+// batch failing on one cause stores one string
+static size_t report_doc_statuses(const Result<WriteResults>& result, size_t count, const DocStatusOut& out) {
+    auto& messages = write_status_messages();
+    messages.clear();
+    std::unordered_map<std::string, int32_t> interned;
+    auto record = [&](const Status& s, zvec_doc_status_t& doc) {
+        auto [it, added] = interned.emplace(s.c_str(), static_cast<int32_t>(messages.size()));
+        if (added) messages.push_back(it->first);
+        doc = {static_cast<int32_t>(s.code()), it->second};
+    };
+
+    size_t failed = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!result.has_value()) {
+            record(result.error(), out.statuses[i]);
+            failed++;
+        } else if (i < result.value().size() && !result.value()[i].ok()) {
+            record(result.value()[i], out.statuses[i]);
+            failed++;
+        } else {
+            out.statuses[i] = {0, -1};
+        }
+    }
+    if (out.failed) *out.failed = failed;
+    return failed;
 }
 
-zvec_status_t zvec_schema_add_field(zvec_schema_handle_t handle, const zvec_field_def_t* field_def) {
-    if (!handle || !field_def) return {2, "null argument"};
+// Helper: flush after a successful write when auto-flush is on and no bulk load is running.
+// With out, every document's outcome is reported and the documents that were written are
+// flushed even when others failed.
+static zvec_status_t finish_write(zvec_collection_t* col, const Result<WriteResults>& result,
+    size_t count = 0, const DocStatusOut* out = nullptr) {
+    // Even a failed batch may have applied some of its documents.
+    bump_write_epoch(col);
+    if (out) {
+        size_t failed = report_doc_statuses(result, count, *out);
+        if (!result.has_value()) return to_c_status(result.error());
+        if (failed == count) return ok_status();
+    } else {
+        if (!result.has_value()) return to_c_status(result.error());
+        for (const auto& s : result.value()) {
+            if (!s.ok()) return to_c_status(s);
+        }
+    }
+    if (col->auto_flush && !col->bulk_loading) {
+        OpTimer timer(ZVEC_OP_FLUSH);
+        return timer.finish(to_c_status(engine(col)->Flush()));
+    }
+    return ok_status();
+}
+
+// Helper: run an engine write as the write-engine phase, then finish it
+static zvec_status_t run_write(zvec_collection_t* col, std::vector<Doc>& docs,
+    Result<WriteResults> (Collection::*write)(std::vector<Doc>&), const DocStatusOut* out = nullptr) {
+    auto result = timed(ZVEC_OP_WRITE_ENGINE, [&] { return ((*col->ptr).*write)(docs); });
+    col->pending_writes += docs.size();
+    return finish_write(col, result, docs.size(), out);
+}
+
+// Helper: check a *_with_status call's arrays and report an empty write as all written
+static zvec_status_t begin_status_write(size_t count, const DocStatusOut& out) {
+    if (count > 0 && !out.statuses) return {2, "null out_statuses"};
+    if (out.failed) *out.failed = 0;
+    return ok_status();
+}
+
+// Helper: the ZVEC_OP_* a document write is timed under
+static int write_op(Result<WriteResults> (Collection::*write)(std::vector<Doc>&)) {
+    if (write == &Collection::Upsert) return ZVEC_OP_UPSERT;
+    if (write == &Collection::Update) return ZVEC_OP_UPDATE;
+    return ZVEC_OP_INSERT;
+}
+
+// Helper: the collection's worker pool, started on first use
+static WorkerPool& collection_pool(zvec_collection_t* col) {
+    std::call_once(col->pool_once, [col] {
+        size_t threads = col->query_parallel > 0
+            ? static_cast<size_t>(col->query_parallel)
+            : std::max(1u, std::thread::hardware_concurrency());
+        col->pool = std::make_unique<WorkerPool>(threads);
+    });
+    return *col->pool;
+}
+
+static void release_async_op(zvec_async_op_t* op) {
+    if (op->refs.fetch_sub(1) == 1) delete op;
+}
+
+// Helper: queue work on the collection's pool and report its outcome through callback.
+// work fills *out_result only for queries.
+static void submit_async(zvec_collection_t* col, zvec_async_op_handle_t* out_op,
+    zvec_async_callback_t callback, void* user_data,
+    std::function<zvec_status_t(zvec_result_t**)> work) {
+    auto* op = new zvec_async_op_t();
+    if (out_op) {
+        op->refs = 2;
+        *out_op = op;
+    }
+
+    auto queued = std::chrono::steady_clock::now();
+    collection_pool(col).submit([op, callback, user_data, queued, work = std::move(work)] {
+        auto waited = std::chrono::steady_clock::now() - queued;
+        Metrics::instance().record(ZVEC_OP_ASYNC_QUEUE,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count()), false);
+        zvec_result_t* result = nullptr;
+        zvec_status_t status = op->cancelled
+            ? zvec_status_t{ZVEC_STATUS_CANCELLED, "operation cancelled"}
+            : work(&result);
+        callback(user_data, status, result);
+        release_async_op(op);
+    });
+}
+
+// Helper: copy document handles into engine documents
+static std::vector<Doc> copy_docs(const zvec_doc_handle_t* docs, size_t count) {
+    std::vector<Doc> zvec_docs;
+    zvec_docs.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        zvec_docs.push_back(docs[i]->doc);
+    }
+    return zvec_docs;
+}
+
+// Helper: hand the batch's documents to a write without copying them, then take them back
+static zvec_status_t write_doc_batch(zvec_collection_t* col, zvec_doc_batch_t* batch,
+    Result<WriteResults> (Collection::*write)(std::vector<Doc>&), const DocStatusOut* out = nullptr) {
+    if (!col || !engine(col)) return {2, "null handle"};
+    if (col->read_only) return read_only_status();
+    if (out) {
+        auto status = begin_status_write(batch ? batch->count : 0, *out);
+        if (status.code != 0) return status;
+    }
+    if (!batch || batch->count == 0) return ok_status();
+
+    OpTimer timer(write_op(write));
+    auto& staging = batch->staging;
+    staging.clear();
+    timed(ZVEC_OP_WRITE_CONVERT, [&] {
+        for (size_t i = 0; i < batch->count; i++) {
+            staging.push_back(std::move(batch->slots[i].doc));
+        }
+    });
+    auto result = timed(ZVEC_OP_WRITE_ENGINE, [&] { return ((*col->ptr).*write)(staging); });
+    col->pending_writes += staging.size();
+    for (size_t i = 0; i < batch->count; i++) {
+        batch->slots[i].doc = std::move(staging[i]);
+    }
+    const size_t count = staging.size();
+    staging.clear();
+    return timer.finish(finish_write(col, result, count, out));
+}
+
+// Helper: copy C strings into primary keys
+static std::vector<std::string> copy_pks(const char** ids, size_t count) {
+    std::vector<std::string> pks;
+    pks.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        pks.push_back(std::string(ids[i]));
+    }
+    return pks;
+}
+
+// Helper: engine query params of the given index type; zero knobs keep engine defaults
+static QueryParams::Ptr make_query_params(IndexType type, const zvec_query_params_t& p) {
+    QueryParams::Ptr params;
+    switch (type) {
+        case IndexType::HNSW: {
+            auto hnsw = std::make_shared<HnswQueryParams>();
+            if (p.ef > 0) hnsw->set_ef(p.ef);
+            params = hnsw;
+            break;
+        }
+        case IndexType::IVF: {
+            auto ivf = std::make_shared<IVFQueryParams>();
+            if (p.n_probe > 0) ivf->set_nprobe(p.n_probe);
+            if (p.refine_factor > 0) ivf->set_scale_factor(p.refine_factor);
+            params = ivf;
+            break;
+        }
+        case IndexType::FLAT: {
+            auto flat = std::make_shared<FlatQueryParams>();
+            if (p.refine_factor > 0) flat->set_scale_factor(p.refine_factor);
+            params = flat;
+            break;
+        }
+        default:
+            return nullptr;
+    }
+    params->set_radius(p.radius);
+    params->set_is_linear(p.is_linear != 0);
+    params->set_is_using_refiner(p.is_using_refiner != 0);
+    return params;
+}
+
+// Helper: IEEE 754 binary32 -> binary16, round to nearest even
+static uint16_t float_to_half(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    const uint32_t abs = bits & 0x7fffffffu;
+
+    if (abs >= 0x7f800000u) {  // inf / nan
+        return sign | 0x7c00u | (abs > 0x7f800000u ? 0x200u : 0u);
+    }
+    if (abs >= 0x477ff000u) {  // overflows to inf after rounding
+        return sign | 0x7c00u;
+    }
+    if (abs < 0x38800000u) {  // subnormal or zero
+        if (abs < 0x33000000u) return sign;
+        const uint32_t mantissa = (abs & 0x7fffffu) | 0x800000u;
+        const int shift = 126 - static_cast<int>(abs >> 23);
+        uint32_t half = mantissa >> shift;
+        const uint32_t rest = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1u))) half++;
+        return sign | static_cast<uint16_t>(half);
+    }
+    uint32_t half = ((abs - 0x38000000u) >> 13);
+    const uint32_t rest = abs & 0x1fffu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) half++;
+    return sign | static_cast<uint16_t>(half);
+}
+
+// Helper: the field's query defaults, if it has any
+static bool find_query_defaults(zvec_collection_t* col, const std::string& field_name, zvec_query_params_t& out) {
+    std::lock_guard<std::mutex> lock(col->query_defaults_mutex);
+    auto it = col->query_defaults.find(field_name);
+    if (it == col->query_defaults.end()) return false;
+    out = it->second;
+    return true;
+}
+
+// Helper: set or (params NULL) clear a field's query defaults
+static void set_query_defaults(zvec_collection_t* col, const std::string& field_name, const zvec_query_params_t* params) {
+    std::lock_guard<std::mutex> lock(col->query_defaults_mutex);
+    if (params) {
+        col->query_defaults[field_name] = *params;
+    } else {
+        col->query_defaults.erase(field_name);
+    }
+    col->has_query_defaults.store(!col->query_defaults.empty(), std::memory_order_release);
+}
+
+// Helper: finish a query handle for its target field before it runs:
+// build engine search params and encode sparse values in the field's precision
+static zvec_status_t prepare_query(zvec_collection_t* col, zvec_query_t* query) {
+    const bool has_sparse = !query->sparse_values_cache.empty();
+    bool has_params = query->has_params;
+    zvec_query_params_t params = query->params;
+    if (!has_params) {
+        query->query.query_params_ = nullptr;
+        if (col->has_query_defaults.load(std::memory_order_acquire)) {
+            has_params = find_query_defaults(col, query->query.field_name_, params);
+        }
+    }
+    query->applied_params = params;
+    query->has_applied_params = has_params;
+    if (!has_params && !has_sparse) return ok_status();
+
+    IndexType type = static_cast<IndexType>(params.index_type);
+    FieldSchema::Ptr field;
+    if (has_sparse || (has_params && type == IndexType::UNDEFINED)) {
+        auto schema = engine(col)->Schema();
+        if (!schema.has_value()) return to_c_status(schema.error());
+        field = schema.value().get_field_ptr(query->query.field_name_);
+        if (!field) return {2, "unknown query field"};
+    }
+
+    if (has_params) {
+        if (type == IndexType::UNDEFINED) type = field->index_type();
+        query->query.query_params_ = make_query_params(type, params);
+    }
+
+    if (has_sparse) {
+        const auto& values = query->sparse_values_cache;
+        if (field->data_type() == DataType::SPARSE_VECTOR_FP16) {
+            std::vector<uint16_t> halves(values.size());
+            std::transform(values.begin(), values.end(), halves.begin(), float_to_half);
+            query->query.query_sparse_values_.assign(
+                reinterpret_cast<const char*>(halves.data()), halves.size() * sizeof(uint16_t));
+        } else {
+            query->query.query_sparse_values_.assign(
+                reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+        }
+    }
+    return ok_status();
+}
+
+// Helper: map a raw engine score onto [0, 1], higher is better, so scores of
+// fields with different metrics can be weighted against each other
+static double normalize_score(MetricType metric, double score) {
+    constexpr double kPi = 3.14159265358979323846;
+    switch (metric) {
+        case MetricType::L2:     return 1.0 - 2.0 * std::atan(score) / kPi;
+        case MetricType::IP:     return 0.5 + std::atan(score) / kPi;
+        case MetricType::COSINE: return 1.0 - score / 2.0;
+        default:                 return score;
+    }
+}
+
+// Helper: metric of a vector field's index, UNDEFINED if it has none
+static MetricType field_metric(const CollectionSchema& schema, const std::string& field_name) {
+    auto field = schema.get_field_ptr(field_name);
+    if (!field || !field->index_params()) return MetricType::UNDEFINED;
+    auto* vec_params = dynamic_cast<const VectorIndexParams*>(field->index_params().get());
+    return vec_params ? vec_params->metric_type() : MetricType::UNDEFINED;
+}
+
+// Helper: fuse per-query hit lists into one list ordered by fused score
+static DocPtrList fuse_hits(const std::vector<DocPtrList>& lists, const std::vector<MetricType>& metrics,
+    const zvec_fusion_t& fusion) {
+    struct Candidate {
+        Doc::Ptr doc;
+        double score = 0.0;
+    };
+    std::unordered_map<std::string, Candidate> candidates;
+
+    for (size_t q = 0; q < lists.size(); q++) {
+        for (size_t rank = 0; rank < lists[q].size(); rank++) {
+            const auto& doc = lists[q][rank];
+            if (!doc) continue;
+            auto& candidate = candidates[doc->pk()];
+            if (!candidate.doc) candidate.doc = doc;
+            if (fusion.method == ZVEC_FUSION_WEIGHTED) {
+                candidate.score += fusion.weights[q] * normalize_score(metrics[q], doc->score());
+            } else {
+                candidate.score += 1.0 / (fusion.rrf_k + static_cast<double>(rank + 1));
+            }
+        }
+    }
+
+    std::vector<Candidate> ranked;
+    ranked.reserve(candidates.size());
+    for (auto& entry : candidates) ranked.push_back(std::move(entry.second));
+
+    const size_t keep = std::min(ranked.size(), static_cast<size_t>(std::max(fusion.topk, 0)));
+    std::partial_sort(ranked.begin(), ranked.begin() + keep, ranked.end(),
+        [](const Candidate& a, const Candidate& b) { return a.score > b.score; });
+
+    // The engine's documents may be shared beyond this call, so the fused score goes
+    // on a copy and the engine's own score is left untouched.
+    DocPtrList fused;
+    fused.reserve(keep);
+    for (size_t i = 0; i < keep; i++) {
+        auto doc = std::make_shared<Doc>(*ranked[i].doc);
+        doc->set_score(static_cast<float>(ranked[i].score));
+        fused.push_back(std::move(doc));
+    }
+    return fused;
+}
+
+// Helper: wrap engine query hits in a C result; documents are shared, not copied
+static zvec_result_t* to_c_result(const DocPtrList& hits, bool truncated = false) {
+    auto* res = new zvec_result_t();
+    res->truncated = truncated;
+    res->hits.reserve(hits.size());
+    for (const auto& doc_ptr : hits) {
+        if (doc_ptr) res->hits.push_back(doc_ptr);
+    }
+    return res;
+}
+
+// Helper: everything that decides a prepared query's hits, as one byte string
+static std::string query_cache_key(const zvec_query_t* query) {
+    const auto& q = query->query;
+    std::string key;
+    auto append = [&key](const void* data, size_t size) {
+        key.append(static_cast<const char*>(data), size);
+    };
+    auto append_string = [&](const std::string& value) {
+        size_t size = value.size();
+        append(&size, sizeof(size));
+        key.append(value);
+    };
+
+    append_string(q.field_name_);
+    append_string(q.query_vector_);
+    append_string(q.query_sparse_indices_);
+    append_string(q.query_sparse_values_);
+    append_string(q.filter_);
+    append(&q.topk_, sizeof(q.topk_));
+    key.push_back(q.include_vector_ ? 1 : 0);
+    key.push_back(q.include_doc_id_ ? 1 : 0);
+
+    key.push_back(q.output_fields_.has_value() ? 1 : 0);
+    if (q.output_fields_.has_value()) {
+        size_t count = q.output_fields_->size();
+        append(&count, sizeof(count));
+        for (const auto& field : *q.output_fields_) append_string(field);
+    }
+
+    key.push_back(query->has_applied_params ? 1 : 0);
+    if (query->has_applied_params) {
+        const auto& p = query->applied_params;
+        append(&p.index_type, sizeof(p.index_type));
+        append(&p.ef, sizeof(p.ef));
+        append(&p.n_probe, sizeof(p.n_probe));
+        append(&p.radius, sizeof(p.radius));
+        append(&p.is_linear, sizeof(p.is_linear));
+        append(&p.is_using_refiner, sizeof(p.is_using_refiner));
+        append(&p.refine_factor, sizeof(p.refine_factor));
+    }
+
+    const auto& filter = query->id_filter;
+    append(&filter.mode, sizeof(filter.mode));
+    if (filter.set) append(&filter.set->id, sizeof(filter.set->id));
+    return key;
+}
+
+// Most candidates an id-filtered query asks the engine for before giving up on topk
+static constexpr size_t kIdFilterMaxCandidates = size_t{1} << 20;
+
+// Helper: run a query and keep only the hits its id filter lets through. This is a
+// post-filter: the engine takes no candidate set, so each pass is a full search
+// whose non-member hits are dropped, widened (topk x4) until topk hits pass, the
+// engine runs out, or kIdFilterMaxCandidates is reached. truncated, if given, is
+// set when the cap stopped the search short of topk hits.
+static Result<DocPtrList> engine_query(zvec_collection_t* col, const VectorQuery& query, const IdFilter& filter,
+    bool* truncated = nullptr) {
+    if (truncated) *truncated = false;
+    if (!filter.set || query.topk_ <= 0) return engine(col)->Query(query);
+
+    const auto& pks = filter.set->pks;
+    const bool allow = filter.mode == ZVEC_ID_FILTER_ALLOW;
+    const size_t topk = static_cast<size_t>(query.topk_);
+    if (allow && pks.empty()) return DocPtrList{};
+
+    // A deny set removes at most |set| hits, so topk + |set| candidates always suffice.
+    size_t limit = std::max(topk, kIdFilterMaxCandidates);
+    if (!allow) limit = std::min(limit, topk + pks.size());
+    limit = std::min<size_t>(limit, INT32_MAX);
+    size_t k = std::min(limit, allow ? topk * 4 : topk + std::min(pks.size(), topk));
+
+    VectorQuery widened = query;
+    while (true) {
+        widened.topk_ = static_cast<int>(k);
+        auto result = engine(col)->Query(widened);
+        if (!result.has_value()) return result;
+
+        auto& candidates = result.value();
+        const bool exhausted = candidates.size() < k;
+        DocPtrList hits;
+        hits.reserve(std::min(topk, candidates.size()));
+        for (auto& doc : candidates) {
+            if (!doc || (pks.count(doc->pk()) != 0) != allow) continue;
+            hits.push_back(std::move(doc));
+            if (hits.size() == topk) break;
+        }
+        if (hits.size() == topk || exhausted || k >= limit || (allow && hits.size() == pks.size())) {
+            if (truncated) *truncated = hits.size() < topk && !exhausted && !(allow && hits.size() == pks.size());
+            return hits;
+        }
+        k = std::min(limit, k * 4);
+    }
+}
+
+// Helper: run a prepared query through the collection's result cache, if it has one.
+// key is empty when the cache is off.
+// A truncated result is not cached, so every run of the query reports the truncation.
+static Result<DocPtrList> run_cached_query(zvec_collection_t* col, const VectorQuery& query,
+    const IdFilter& filter, const std::string& key, bool* truncated = nullptr) {
+    if (!col->query_cache || key.empty()) return engine_query(col, query, filter, truncated);
+
+    // Read the epoch before searching so a write that lands mid-query invalidates the entry.
+    const uint64_t epoch = col->write_epoch.load(std::memory_order_acquire);
+    DocPtrList hits;
+    if (col->query_cache->lookup(key, epoch, hits)) {
+        if (truncated) *truncated = false;
+        return hits;
+    }
+
+    bool cut = false;
+    auto result = engine_query(col, query, filter, &cut);
+    if (truncated) *truncated = cut;
+    if (result.has_value() && !cut) col->query_cache->store(key, epoch, result.value());
+    return result;
+}
+
+// Helper: bytes per row of an exportable column, 0 if the type cannot be exported
+static size_t export_row_size(int32_t data_type, int32_t dimension) {
+    switch (data_type) {
+        case ZVEC_DATA_TYPE_BOOL:   return sizeof(uint8_t);
+        case ZVEC_DATA_TYPE_INT32:  return sizeof(int32_t);
+        case ZVEC_DATA_TYPE_INT64:  return sizeof(int64_t);
+        case ZVEC_DATA_TYPE_UINT32: return sizeof(uint32_t);
+        case ZVEC_DATA_TYPE_UINT64: return sizeof(uint64_t);
+        case ZVEC_DATA_TYPE_FLOAT:  return sizeof(float);
+        case ZVEC_DATA_TYPE_DOUBLE: return sizeof(double);
+        case ZVEC_DATA_TYPE_VECTOR_FP16:
+            return dimension > 0 ? dimension * sizeof(float16_t) : 0;
+        case ZVEC_DATA_TYPE_VECTOR_FP32:
+            return dimension > 0 ? dimension * sizeof(float) : 0;
+        case ZVEC_DATA_TYPE_VECTOR_FP64:
+            return dimension > 0 ? dimension * sizeof(double) : 0;
+        case ZVEC_DATA_TYPE_VECTOR_INT8:
+            return dimension > 0 ? dimension * sizeof(int8_t) : 0;
+        case ZVEC_DATA_TYPE_VECTOR_INT16:
+            return dimension > 0 ? dimension * sizeof(int16_t) : 0;
+        default:
+            return 0;
+    }
+}
+
+template <typename T>
+static void export_scalar_column(const DocPtrList& hits, const std::string& name, ExportColumn& out) {
+    T* values = reinterpret_cast<T*>(out.values.data());
+    for (size_t i = 0; i < hits.size(); i++) {
+        auto value = hits[i]->get<T>(name);
+        if (value.has_value()) {
+            values[i] = value.value();
+        } else {
+            out.null_bitmap[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+        }
+    }
+}
+
+template <typename T>
+static void export_vector_column(const DocPtrList& hits, const std::string& name, size_t dim, ExportColumn& out) {
+    T* values = reinterpret_cast<T*>(out.values.data());
+    for (size_t i = 0; i < hits.size(); i++) {
+        auto value = hits[i]->get<std::vector<T>>(name);
+        if (value.has_value() && value.value().size() == dim) {
+            std::memcpy(values + i * dim, value.value().data(), dim * sizeof(T));
+        } else {
+            out.null_bitmap[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+        }
+    }
+}
+
+// Helper: write one column of every hit into result-owned buffers
+static void export_column(const DocPtrList& hits, const zvec_column_t& col, ExportColumn& out) {
+    const std::string name(col.name);
+    const size_t rows = hits.size();
+    out.null_bitmap.assign((rows + 7) / 8, 0);
+    out.offsets.clear();
+
+    if (col.data_type == ZVEC_DATA_TYPE_STRING) {
+        out.values.clear();
+        out.offsets.reserve(rows + 1);
+        out.offsets.push_back(0);
+        for (size_t i = 0; i < rows; i++) {
+            auto value = hits[i]->get<std::string>(name);
+            if (value.has_value()) {
+                out.values.insert(out.values.end(), value.value().begin(), value.value().end());
+            } else {
+                out.null_bitmap[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+            }
+            out.offsets.push_back(static_cast<int32_t>(out.values.size()));
+        }
+        return;
+    }
+
+    out.values.assign(rows * export_row_size(col.data_type, col.dimension), 0);
+    switch (col.data_type) {
+        case ZVEC_DATA_TYPE_BOOL: {
+            for (size_t i = 0; i < rows; i++) {
+                auto value = hits[i]->get<bool>(name);
+                if (value.has_value()) {
+                    out.values[i] = value.value() ? 1 : 0;
+                } else {
+                    out.null_bitmap[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+                }
+            }
+            break;
+        }
+        case ZVEC_DATA_TYPE_INT32:  export_scalar_column<int32_t>(hits, name, out); break;
+        case ZVEC_DATA_TYPE_INT64:  export_scalar_column<int64_t>(hits, name, out); break;
+        case ZVEC_DATA_TYPE_UINT32: export_scalar_column<uint32_t>(hits, name, out); break;
+        case ZVEC_DATA_TYPE_UINT64: export_scalar_column<uint64_t>(hits, name, out); break;
+        case ZVEC_DATA_TYPE_FLOAT:  export_scalar_column<float>(hits, name, out); break;
+        case ZVEC_DATA_TYPE_DOUBLE: export_scalar_column<double>(hits, name, out); break;
+        case ZVEC_DATA_TYPE_VECTOR_FP16:
+            export_vector_column<float16_t>(hits, name, static_cast<size_t>(col.dimension), out);
+            break;
+        case ZVEC_DATA_TYPE_VECTOR_FP32:
+            export_vector_column<float>(hits, name, static_cast<size_t>(col.dimension), out);
+            break;
+        case ZVEC_DATA_TYPE_VECTOR_FP64:
+            export_vector_column<double>(hits, name, static_cast<size_t>(col.dimension), out);
+            break;
+        case ZVEC_DATA_TYPE_VECTOR_INT8:
+            export_vector_column<int8_t>(hits, name, static_cast<size_t>(col.dimension), out);
+            break;
+        case ZVEC_DATA_TYPE_VECTOR_INT16:
+            export_vector_column<int16_t>(hits, name, static_cast<size_t>(col.dimension), out);
+            break;
+    }
+}
+
+// Helper: the key a setter passes to Doc; resolved ids reuse their interned string
+static const char* field_key(const char* field) { return field; }
+static const std::string& field_key(zvec_field_id_t field) { return field->name; }
+
+// Schema type written by each setter's value type
+template <typename T> struct ScalarFieldType;
+template <> struct ScalarFieldType<std::string> { static constexpr DataType value = DataType::STRING; };
+template <> struct ScalarFieldType<int32_t> { static constexpr DataType value = DataType::INT32; };
+template <> struct ScalarFieldType<int64_t> { static constexpr DataType value = DataType::INT64; };
+template <> struct ScalarFieldType<float> { static constexpr DataType value = DataType::FLOAT; };
+template <> struct ScalarFieldType<double> { static constexpr DataType value = DataType::DOUBLE; };
+template <> struct ScalarFieldType<bool> { static constexpr DataType value = DataType::BOOL; };
+
+template <typename T> struct VectorFieldType;
+template <> struct VectorFieldType<float> { static constexpr DataType value = DataType::VECTOR_FP32; };
+template <> struct VectorFieldType<float16_t> { static constexpr DataType value = DataType::VECTOR_FP16; };
+template <> struct VectorFieldType<int8_t> { static constexpr DataType value = DataType::VECTOR_INT8; };
+template <> struct VectorFieldType<int16_t> { static constexpr DataType value = DataType::VECTOR_INT16; };
+
+// Helper: check a value against its field. Name-based setters leave that to the engine;
+// resolved ids carry their schema type and dimension.
+static zvec_status_t check_field(const char*, DataType, size_t = 0) { return ok_status(); }
+static zvec_status_t check_field(zvec_field_id_t field, DataType type, size_t len = 0) {
+    if (field->data_type != type) {
+        return message_status("field '" + field->name + "' has data type " +
+            std::to_string(static_cast<int>(field->data_type)) + ", not " + std::to_string(static_cast<int>(type)));
+    }
+    if (len > 0 && field->dimension > 0 && len != field->dimension) {
+        return message_status("field '" + field->name + "' has dimension " + std::to_string(field->dimension) +
+            ", got " + std::to_string(len));
+    }
+    return ok_status();
+}
+
+// Helper: store a dense vector in the element type the engine keeps for its field
+template <typename T, typename In, typename Field>
+static zvec_status_t set_doc_vector(zvec_doc_handle_t handle, Field field, const In* data, size_t len) {
+    static_assert(sizeof(T) == sizeof(In), "element size mismatch");
+    if (!handle || !field || !data) return {2, "null argument"};
+    auto checked = check_field(field, VectorFieldType<T>::value, len);
+    if (checked.code != 0) return checked;
+    const T* begin = reinterpret_cast<const T*>(data);
+    handle->doc.set<std::vector<T>>(field_key(field), std::vector<T>(begin, begin + len));
+    return ok_status();
+}
+
+// Helper: store a sparse vector as the (indices, values) pair the engine expects
+template <typename Field>
+static zvec_status_t set_doc_sparse_vector(zvec_doc_handle_t handle, Field field,
+    const uint32_t* indices, const float* values, size_t len) {
+    if (!handle || !field || !indices || !values) return {2, "null argument"};
+    // A sparse FP16 field takes the same float pairs
+    auto checked = check_field(field, DataType::SPARSE_VECTOR_FP32);
+    if (checked.code != 0 && check_field(field, DataType::SPARSE_VECTOR_FP16).code != 0) return checked;
+    std::pair<std::vector<uint32_t>, std::vector<float>> sparse;
+    sparse.first.assign(indices, indices + len);
+    sparse.second.assign(values, values + len);
+    handle->doc.set<decltype(sparse)>(field_key(field), std::move(sparse));
+    return ok_status();
+}
+
+// Helper: store a scalar field value
+template <typename T, typename Field>
+static zvec_status_t set_doc_value(zvec_doc_handle_t handle, Field field, T value) {
+    if (!handle || !field) return {2, "null argument"};
+    auto checked = check_field(field, ScalarFieldType<T>::value);
+    if (checked.code != 0) return checked;
+    handle->doc.set<T>(field_key(field), std::move(value));
+    return ok_status();
+}
+
+// Helper: copy up to max_len elements of a dense vector field, 0 if absent or of another type
+template <typename T, typename Out>
+static size_t get_doc_vector(zvec_doc_handle_t handle, const char* field, Out* out_data, size_t max_len) {
+    static_assert(sizeof(T) == sizeof(Out), "element size mismatch");
+    if (!handle || !field || !out_data) return 0;
+    auto result = handle->doc.get<std::vector<T>>(field);
+    if (!result.has_value()) return 0;
+    const auto& vec = result.value();
+    size_t copy_len = std::min(max_len, vec.size());
+    std::memcpy(out_data, vec.data(), copy_len * sizeof(T));
+    return copy_len;
+}
+
+// Helper: shared body of the document-handle async writes
+static zvec_status_t submit_doc_write(zvec_collection_t* handle, zvec_doc_handle_t* docs, size_t count,
+    Result<WriteResults> (Collection::*write)(std::vector<Doc>&),
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (!callback) return {2, "null callback"};
+    if (!docs && count > 0) return {2, "null docs"};
+
+    auto zvec_docs = timed(ZVEC_OP_WRITE_CONVERT, [&] { return copy_docs(docs, count); });
+    submit_async(handle, out_op, callback, user_data,
+        [handle, write, zvec_docs = std::move(zvec_docs)](zvec_result_t**) mutable -> zvec_status_t {
+            if (zvec_docs.empty()) return ok_status();
+            OpTimer timer(write_op(write));
+            return timer.finish(run_write(handle, zvec_docs, write));
+        });
+    return ok_status();
+}
+
+// Helper: shared body of the columnar async writes; the batch is materialized before returning
+static zvec_status_t submit_columnar_write(zvec_collection_t* handle, const zvec_column_batch_t* batch,
+    Result<WriteResults> (Collection::*write)(std::vector<Doc>&),
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (!callback) return {2, "null callback"};
+
+    std::vector<Doc> zvec_docs;
+    if (batch && batch->row_count > 0) {
+        auto build_status = timed(ZVEC_OP_WRITE_CONVERT, [&] { return build_columnar_docs(collection_pool(handle), batch, zvec_docs); });
+        if (build_status.code != 0) return build_status;
+    }
+
+    submit_async(handle, out_op, callback, user_data,
+        [handle, write, zvec_docs = std::move(zvec_docs)](zvec_result_t**) mutable -> zvec_status_t {
+            if (zvec_docs.empty()) return ok_status();
+            OpTimer timer(write_op(write));
+            return timer.finish(run_write(handle, zvec_docs, write));
+        });
+    return ok_status();
+}
+
+// Rows per chunk when the caller leaves chunk_rows at 0
+static constexpr size_t kImportChunkRows = 16384;
+
+// One chunk of imported rows in zvec_column_t layout. Converted values live in
+// buffers; a deque keeps earlier buffers in place while later ones are added.
+struct ImportChunk {
+    size_t rows = 0;
+    std::string error;
+    std::vector<zvec_column_t> columns;
+    std::deque<std::vector<uint8_t>> buffers;
+    std::vector<char> pk_data;
+    std::vector<int32_t> pk_offsets;
+    bool has_pks = false;
+#ifdef ZVEC_C_WITH_ARROW
+    std::shared_ptr<arrow::RecordBatch> batch;  // backs columns that point into it
+#endif
+
+    uint8_t* buffer(size_t bytes) {
+        buffers.emplace_back(bytes);
+        return buffers.back().data();
+    }
+
+    bool fail(std::string message) {
+        error = std::move(message);
+        return false;
+    }
+};
+
+// Source of import chunks. read() fills up to max_rows rows and returns false with
+// chunk.error set on malformed input; zero rows means the end of the file.
+class ImportReader {
+public:
+    virtual ~ImportReader() = default;
+    virtual bool read(size_t max_rows, ImportChunk& chunk) = 0;
+};
+
+using ImportFile = std::unique_ptr<std::FILE, int (*)(std::FILE*)>;
+
+// fvecs / bvecs: each record is an int32 dimension followed by that many float32 or
+// uint8 values; every record must have the first record's dimension.
+class VecsReader : public ImportReader {
+public:
+    VecsReader(ImportFile file, std::string field, bool bytes)
+        : file_(std::move(file)), field_(std::move(field)), bytes_(bytes) {}
+
+    bool open(std::string& error) {
+        int32_t dim = 0;
+        if (std::fread(&dim, sizeof(dim), 1, file_.get()) == 0) return true;  // empty file
+        if (dim <= 0) {
+            error = "invalid vector dimension " + std::to_string(dim);
+            return false;
+        }
+        dim_ = static_cast<size_t>(dim);
+        std::rewind(file_.get());
+        return true;
+    }
+
+    bool read(size_t max_rows, ImportChunk& chunk) override {
+        if (dim_ == 0) return true;
+        const size_t value_size = bytes_ ? 1 : sizeof(float);
+        const size_t record = sizeof(int32_t) + dim_ * value_size;
+        raw_.resize(max_rows * record);
+        const size_t got = std::fread(raw_.data(), 1, raw_.size(), file_.get());
+        if (got % record != 0) {
+            return chunk.fail("truncated record " + std::to_string(row_ + got / record));
+        }
+
+        const size_t rows = got / record;
+        float* values = reinterpret_cast<float*>(chunk.buffer(rows * dim_ * sizeof(float)));
+        for (size_t i = 0; i < rows; i++) {
+            const uint8_t* rec = raw_.data() + i * record;
+            int32_t dim;
+            std::memcpy(&dim, rec, sizeof(dim));
+            if (dim != static_cast<int32_t>(dim_)) {
+                return chunk.fail("record " + std::to_string(row_ + i) + " has dimension " +
+                    std::to_string(dim) + ", expected " + std::to_string(dim_));
+            }
+            float* row = values + i * dim_;
+            if (bytes_) {
+                std::copy(rec + sizeof(int32_t), rec + record, row);
+            } else {
+                std::memcpy(row, rec + sizeof(int32_t), dim_ * sizeof(float));
+            }
+        }
+
+        row_ += rows;
+        chunk.rows = rows;
+        chunk.columns.push_back({field_.c_str(), ZVEC_DATA_TYPE_VECTOR_FP32,
+            static_cast<int32_t>(dim_), values, nullptr, 0, nullptr});
+        return true;
+    }
+
+private:
+    ImportFile file_;
+    std::string field_;
+    bool bytes_;
+    size_t dim_ = 0;
+    uint64_t row_ = 0;
+    std::vector<uint8_t> raw_;
+};
+
+// .npy: a 2-D C-order array, one row per vector. |u1 is widened to float32; the
+// other element types keep their vector type.
+class NpyReader : public ImportReader {
+public:
+    NpyReader(ImportFile file, std::string field) : file_(std::move(file)), field_(std::move(field)) {}
+
+    bool open(std::string& error) {
+        char magic[8];
+        if (std::fread(magic, 1, sizeof(magic), file_.get()) != sizeof(magic) ||
+            std::memcmp(magic, "\x93NUMPY", 6) != 0) {
+            error = "not an .npy file";
+            return false;
+        }
+        const int major = static_cast<uint8_t>(magic[6]);
+        uint32_t header_len = 0;
+        uint8_t len[4] = {};
+        const size_t len_bytes = major == 1 ? 2 : 4;
+        if (major < 1 || major > 3 || std::fread(len, 1, len_bytes, file_.get()) != len_bytes) {
+            error = "unsupported .npy version";
+            return false;
+        }
+        for (size_t i = 0; i < len_bytes; i++) header_len |= static_cast<uint32_t>(len[i]) << (8 * i);
+
+        std::string header(header_len, '\0');
+        if (std::fread(header.data(), 1, header_len, file_.get()) != header_len) {
+            error = "truncated .npy header";
+            return false;
+        }
+        return parse_header(header, error);
+    }
+
+    bool read(size_t max_rows, ImportChunk& chunk) override {
+        const size_t rows = static_cast<size_t>(std::min<uint64_t>(max_rows, rows_ - row_));
+        if (rows == 0) return true;
+        const size_t count = rows * dim_;
+        void* values;
+        if (data_type_ == ZVEC_DATA_TYPE_VECTOR_FP32 && value_size_ == 1) {
+            raw_.resize(count);
+            if (std::fread(raw_.data(), 1, count, file_.get()) != count) return chunk.fail("truncated .npy data");
+            float* widened = reinterpret_cast<float*>(chunk.buffer(count * sizeof(float)));
+            std::copy(raw_.begin(), raw_.end(), widened);
+            values = widened;
+        } else {
+            values = chunk.buffer(count * value_size_);
+            if (std::fread(values, value_size_, count, file_.get()) != count) {
+                return chunk.fail("truncated .npy data");
+            }
+        }
+
+        row_ += rows;
+        chunk.rows = rows;
+        chunk.columns.push_back({field_.c_str(), data_type_, static_cast<int32_t>(dim_), values, nullptr, 0, nullptr});
+        return true;
+    }
+
+private:
+    // Helper: the quoted value or parenthesized tuple after 'key': in the header dict
+    static std::string header_value(const std::string& header, const char* key) {
+        auto pos = header.find(std::string("'") + key + "'");
+        if (pos == std::string::npos) return {};
+        pos = header.find(':', pos);
+        if (pos == std::string::npos) return {};
+        pos = header.find_first_not_of(' ', pos + 1);
+        if (pos == std::string::npos) return {};
+        const char open = header[pos];
+        if (open != '(' && open != '\'') return header.substr(pos, header.find_first_of(",}", pos) - pos);
+        auto end = header.find(open == '(' ? ')' : '\'', pos + 1);
+        if (end == std::string::npos) return {};
+        return header.substr(pos + 1, end - pos - 1);
+    }
+
+    bool parse_header(const std::string& header, std::string& error) {
+        const std::string descr = header_value(header, "descr");
+        static const struct { const char* descr; int32_t type; size_t size; } kTypes[] = {
+            {"<f4", ZVEC_DATA_TYPE_VECTOR_FP32, 4}, {"<f8", ZVEC_DATA_TYPE_VECTOR_FP64, 8},
+            {"<f2", ZVEC_DATA_TYPE_VECTOR_FP16, 2}, {"|i1", ZVEC_DATA_TYPE_VECTOR_INT8, 1},
+            {"<i2", ZVEC_DATA_TYPE_VECTOR_INT16, 2}, {"|u1", ZVEC_DATA_TYPE_VECTOR_FP32, 1},
+        };
+        for (const auto& t : kTypes) {
+            if (descr == t.descr) {
+                data_type_ = t.type;
+                value_size_ = t.size;
+            }
+        }
+        if (value_size_ == 0) {
+            error = "unsupported .npy dtype '" + descr + "'";
+            return false;
+        }
+        if (header_value(header, "fortran_order").find("True") != std::string::npos) {
+            error = "Fortran-order .npy arrays are not supported";
+            return false;
+        }
+
+        std::vector<uint64_t> shape;
+        const std::string dims = header_value(header, "shape");
+        for (size_t pos = 0; pos < dims.size();) {
+            pos = dims.find_first_of("0123456789", pos);
+            if (pos == std::string::npos) break;
+            size_t end = dims.find_first_not_of("0123456789", pos);
+            if (end == std::string::npos) end = dims.size();
+            shape.push_back(std::stoull(dims.substr(pos, end - pos)));
+            pos = end;
+        }
+        if (shape.size() != 2 || shape[1] == 0) {
+            error = "expected a 2-D .npy array of shape (rows, dimension)";
+            return false;
+        }
+        rows_ = shape[0];
+        dim_ = static_cast<size_t>(shape[1]);
+        return true;
+    }
+
+    ImportFile file_;
+    std::string field_;
+    int32_t data_type_ = 0;
+    size_t value_size_ = 0;
+    uint64_t rows_ = 0;
+    size_t dim_ = 0;
+    uint64_t row_ = 0;
+    std::vector<uint8_t> raw_;
+};
+
+#ifdef ZVEC_C_WITH_ARROW
+// Parquet and Arrow IPC: record batches sliced into chunks. Fixed-size-list vectors
+// and fixed-width scalars are passed to the conversion without copying.
+class ArrowReader : public ImportReader {
+public:
+    explicit ArrowReader(const zvec_import_mapping_t& mapping)
+        : vector_field_(mapping.vector_field),
+          vector_column_(mapping.vector_column ? mapping.vector_column : mapping.vector_field),
+          pk_column_(mapping.pk_column ? mapping.pk_column : "") {
+        for (size_t i = 0; i < mapping.scalar_column_count; i++) {
+            scalar_columns_.emplace_back(mapping.scalar_columns[i]);
+        }
+    }
+
+    bool open_parquet(const std::string& path, size_t chunk_rows, std::string& error) {
+        parquet::ArrowReaderProperties properties;
+        properties.set_batch_size(static_cast<int64_t>(chunk_rows));
+        parquet::arrow::FileReaderBuilder builder;
+        auto status = builder.OpenFile(path);
+        std::unique_ptr<parquet::arrow::FileReader> reader;
+        if (status.ok()) status = builder.properties(properties)->Build(&reader);
+        if (!status.ok()) return fail(status, error);
+        auto batches = reader->GetRecordBatchReader();
+        if (!batches.ok()) return fail(batches.status(), error);
+        parquet_ = std::move(reader);
+        batches_ = std::move(batches).ValueUnsafe();
+        return true;
+    }
+
+    // The IPC file format allows random access; anything else is read as a stream.
+    bool open_ipc(const std::string& path, std::string& error) {
+        auto file = arrow::io::ReadableFile::Open(path);
+        if (!file.ok()) return fail(file.status(), error);
+        auto reader = arrow::ipc::RecordBatchFileReader::Open(*file);
+        if (reader.ok()) {
+            ipc_file_ = *reader;
+            return true;
+        }
+        // The failed probe has moved the file position, so the stream gets a fresh handle.
+        file = arrow::io::ReadableFile::Open(path);
+        if (!file.ok()) return fail(file.status(), error);
+        auto stream = arrow::ipc::RecordBatchStreamReader::Open(*file);
+        if (!stream.ok()) return fail(stream.status(), error);
+        batches_ = *stream;
+        return true;
+    }
+
+    bool read(size_t max_rows, ImportChunk& chunk) override {
+        while (!batch_ || offset_ >= batch_->num_rows()) {
+            std::shared_ptr<arrow::RecordBatch> next;
+            arrow::Status status;
+            if (ipc_file_) {
+                if (next_batch_ >= ipc_file_->num_record_batches()) return true;
+                auto batch = ipc_file_->ReadRecordBatch(next_batch_++);
+                if (batch.ok()) next = *batch; else status = batch.status();
+            } else {
+                status = batches_->ReadNext(&next);
+            }
+            if (!status.ok()) return chunk.fail(status.ToString());
+            if (!next) return true;
+            batch_ = next;
+            offset_ = 0;
+        }
+
+        const int64_t rows = std::min<int64_t>(static_cast<int64_t>(max_rows), batch_->num_rows() - offset_);
+        chunk.batch = batch_->Slice(offset_, rows);
+        offset_ += rows;
+        chunk.rows = static_cast<size_t>(rows);
+
+        if (!pk_column_.empty() && !add_pks(chunk)) return false;
+        if (!add_vector(chunk)) return false;
+        for (const auto& name : scalar_columns_) {
+            if (!add_scalar(chunk, name)) return false;
+        }
+        return true;
+    }
+
+private:
+    static bool fail(const arrow::Status& status, std::string& error) {
+        error = status.ToString();
+        return false;
+    }
+
+    static std::shared_ptr<arrow::Array> column(ImportChunk& chunk, const std::string& name) {
+        auto array = chunk.batch->GetColumnByName(name);
+        if (!array) chunk.fail("column '" + name + "' not found");
+        return array;
+    }
+
+    // Helper: zvec's null bitmap (bit set = null) for an array with nulls, else NULL
+    static const uint8_t* null_bitmap(ImportChunk& chunk, const arrow::Array& array) {
+        if (array.null_count() == 0) return nullptr;
+        uint8_t* bitmap = chunk.buffer((static_cast<size_t>(array.length()) + 7) / 8);
+        for (int64_t i = 0; i < array.length(); i++) {
+            if (array.IsNull(i)) bitmap[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+        }
+        return bitmap;
+    }
+
+    template <typename ArrayType>
+    static int32_t* widen_to_int32(ImportChunk& chunk, const arrow::Array& array) {
+        const auto& typed = static_cast<const ArrayType&>(array);
+        int32_t* values = reinterpret_cast<int32_t*>(chunk.buffer(typed.length() * sizeof(int32_t)));
+        for (int64_t i = 0; i < typed.length(); i++) values[i] = static_cast<int32_t>(typed.Value(i));
+        return values;
+    }
+
+    template <typename ArrayType>
+    static void append_strings(ImportChunk& chunk, const arrow::Array& array) {
+        const auto& typed = static_cast<const ArrayType&>(array);
+        for (int64_t i = 0; i < typed.length(); i++) {
+            auto value = typed.GetView(i);
+            chunk.pk_data.insert(chunk.pk_data.end(), value.begin(), value.end());
+            chunk.pk_offsets.push_back(static_cast<int32_t>(chunk.pk_data.size()));
+        }
+    }
+
+    template <typename ArrayType>
+    static void append_integers(ImportChunk& chunk, const arrow::Array& array) {
+        const auto& typed = static_cast<const ArrayType&>(array);
+        for (int64_t i = 0; i < typed.length(); i++) {
+            auto value = std::to_string(typed.Value(i));
+            chunk.pk_data.insert(chunk.pk_data.end(), value.begin(), value.end());
+            chunk.pk_offsets.push_back(static_cast<int32_t>(chunk.pk_data.size()));
+        }
+    }
+
+    bool add_pks(ImportChunk& chunk) {
+        auto array = column(chunk, pk_column_);
+        if (!array) return false;
+        if (array->null_count() > 0) return chunk.fail("primary key column '" + pk_column_ + "' has nulls");
+        chunk.pk_offsets.assign(1, 0);
+        switch (array->type_id()) {
+            case arrow::Type::STRING:       append_strings<arrow::StringArray>(chunk, *array); break;
+            case arrow::Type::LARGE_STRING: append_strings<arrow::LargeStringArray>(chunk, *array); break;
+            case arrow::Type::INT32:        append_integers<arrow::Int32Array>(chunk, *array); break;
+            case arrow::Type::INT64:        append_integers<arrow::Int64Array>(chunk, *array); break;
+            case arrow::Type::UINT32:       append_integers<arrow::UInt32Array>(chunk, *array); break;
+            case arrow::Type::UINT64:       append_integers<arrow::UInt64Array>(chunk, *array); break;
+            default:
+                return chunk.fail("primary key column '" + pk_column_ + "' must be a string or integer");
+        }
+        chunk.has_pks = true;
+        return true;
+    }
+
+    static int32_t vector_type(arrow::Type::type element) {
+        switch (element) {
+            case arrow::Type::FLOAT:      return ZVEC_DATA_TYPE_VECTOR_FP32;
+            case arrow::Type::DOUBLE:     return ZVEC_DATA_TYPE_VECTOR_FP64;
+            case arrow::Type::HALF_FLOAT: return ZVEC_DATA_TYPE_VECTOR_FP16;
+            case arrow::Type::INT8:       return ZVEC_DATA_TYPE_VECTOR_INT8;
+            case arrow::Type::INT16:      return ZVEC_DATA_TYPE_VECTOR_INT16;
+            default:                      return ZVEC_DATA_TYPE_UNDEFINED;
+        }
+    }
+
+    bool add_vector(ImportChunk& chunk) {
+        auto array = column(chunk, vector_column_);
+        if (!array) return false;
+        zvec_column_t col{vector_field_.c_str(), ZVEC_DATA_TYPE_UNDEFINED, 0, nullptr, nullptr, 0, null_bitmap(chunk, *array)};
+
+        if (array->type_id() == arrow::Type::FIXED_SIZE_LIST) {
+            const auto& list = static_cast<const arrow::FixedSizeListArray&>(*array);
+            const auto& values = *list.values();
+            const int32_t width = values.type()->byte_width();
+            col.data_type = vector_type(values.type_id());
+            col.dimension = list.list_type()->list_size();
+            if (col.data_type != ZVEC_DATA_TYPE_UNDEFINED) {
+                col.values = values.data()->buffers[1]->data() + (values.offset() + list.value_offset(0)) * width;
+            }
+        } else if (array->type_id() == arrow::Type::LIST) {
+            // Variable-length lists are packed densely; every non-null row needs the same length.
+            const auto& list = static_cast<const arrow::ListArray&>(*array);
+            const auto& values = *list.values();
+            const int32_t width = values.type()->byte_width();
+            col.data_type = vector_type(values.type_id());
+            for (int64_t i = 0; i < list.length() && col.dimension == 0; i++) {
+                if (list.IsValid(i)) col.dimension = list.value_length(i);
+            }
+            if (col.data_type != ZVEC_DATA_TYPE_UNDEFINED && col.dimension > 0) {
+                const size_t row_bytes = static_cast<size_t>(col.dimension) * width;
+                uint8_t* dense = chunk.buffer(list.length() * row_bytes);
+                const uint8_t* src = values.data()->buffers[1]->data() + values.offset() * width;
+                for (int64_t i = 0; i < list.length(); i++) {
+                    if (list.IsNull(i)) continue;
+                    if (list.value_length(i) != col.dimension) {
+                        return chunk.fail("column '" + vector_column_ + "' has vectors of different lengths");
+                    }
+                    std::memcpy(dense + i * row_bytes, src + list.value_offset(i) * width, row_bytes);
+                }
+                col.values = dense;
+            }
+        }
+        if (!col.values) {
+            return chunk.fail("column '" + vector_column_ +
+                "' must be a list of float, double, half_float, int8 or int16");
+        }
+        chunk.columns.push_back(col);
+        return true;
+    }
+
+    bool add_scalar(ImportChunk& chunk, const std::string& name) {
+        auto array = column(chunk, name);
+        if (!array) return false;
+        zvec_column_t col{name.c_str(), ZVEC_DATA_TYPE_UNDEFINED, 0, nullptr, nullptr, 0, null_bitmap(chunk, *array)};
+        const auto& data = *array->data();
+
+        switch (array->type_id()) {
+            case arrow::Type::BOOL: {
+                const auto& typed = static_cast<const arrow::BooleanArray&>(*array);
+                uint8_t* values = chunk.buffer(typed.length());
+                for (int64_t i = 0; i < typed.length(); i++) values[i] = typed.Value(i) ? 1 : 0;
+                col.data_type = ZVEC_DATA_TYPE_BOOL;
+                col.values = values;
+                break;
+            }
+            case arrow::Type::INT8:   col.data_type = ZVEC_DATA_TYPE_INT32; col.values = widen_to_int32<arrow::Int8Array>(chunk, *array); break;
+            case arrow::Type::INT16:  col.data_type = ZVEC_DATA_TYPE_INT32; col.values = widen_to_int32<arrow::Int16Array>(chunk, *array); break;
+            case arrow::Type::UINT8:  col.data_type = ZVEC_DATA_TYPE_INT32; col.values = widen_to_int32<arrow::UInt8Array>(chunk, *array); break;
+            case arrow::Type::UINT16: col.data_type = ZVEC_DATA_TYPE_INT32; col.values = widen_to_int32<arrow::UInt16Array>(chunk, *array); break;
+            case arrow::Type::INT32:  col.data_type = ZVEC_DATA_TYPE_INT32;  col.values = data.GetValues<int32_t>(1); break;
+            case arrow::Type::INT64:  col.data_type = ZVEC_DATA_TYPE_INT64;  col.values = data.GetValues<int64_t>(1); break;
+            case arrow::Type::UINT32: col.data_type = ZVEC_DATA_TYPE_UINT32; col.values = data.GetValues<uint32_t>(1); break;
+            case arrow::Type::UINT64: col.data_type = ZVEC_DATA_TYPE_UINT64; col.values = data.GetValues<uint64_t>(1); break;
+            case arrow::Type::FLOAT:  col.data_type = ZVEC_DATA_TYPE_FLOAT;  col.values = data.GetValues<float>(1); break;
+            case arrow::Type::DOUBLE: col.data_type = ZVEC_DATA_TYPE_DOUBLE; col.values = data.GetValues<double>(1); break;
+            case arrow::Type::STRING: {
+                // Offsets index into the whole value buffer, so slices need no rebasing.
+                const auto& typed = static_cast<const arrow::StringArray&>(*array);
+                col.data_type = ZVEC_DATA_TYPE_STRING;
+                col.values = typed.value_data() ? typed.value_data()->data() : reinterpret_cast<const uint8_t*>("");
+                col.values_size = typed.value_data() ? static_cast<size_t>(typed.value_data()->size()) : 0;
+                col.offsets = typed.raw_value_offsets();
+                break;
+            }
+            case arrow::Type::LARGE_STRING: {
+                const auto& typed = static_cast<const arrow::LargeStringArray&>(*array);
+                int32_t* offsets = reinterpret_cast<int32_t*>(chunk.buffer((typed.length() + 1) * sizeof(int32_t)));
+                const int64_t base = typed.value_offset(0);
+                for (int64_t i = 0; i <= typed.length(); i++) {
+                    const int64_t offset = typed.raw_value_offsets()[i] - base;
+                    if (offset > INT32_MAX) return chunk.fail("column '" + name + "' exceeds 2 GiB in one chunk");
+                    offsets[i] = static_cast<int32_t>(offset);
+                }
+                col.data_type = ZVEC_DATA_TYPE_STRING;
+                col.values = typed.value_data() ? typed.value_data()->data() + base : reinterpret_cast<const uint8_t*>("");
+                col.values_size = static_cast<size_t>(offsets[typed.length()]);
+                col.offsets = offsets;
+                break;
+            }
+            default:
+                return chunk.fail("column '" + name + "' has unsupported type " + array->type()->ToString());
+        }
+        chunk.columns.push_back(col);
+        return true;
+    }
+
+    std::string vector_field_;
+    std::string vector_column_;
+    std::string pk_column_;
+    std::vector<std::string> scalar_columns_;
+    std::unique_ptr<parquet::arrow::FileReader> parquet_;  // owns the file batches_ reads
+    std::shared_ptr<arrow::RecordBatchReader> batches_;
+    std::shared_ptr<arrow::ipc::RecordBatchFileReader> ipc_file_;
+    int next_batch_ = 0;
+    std::shared_ptr<arrow::RecordBatch> batch_;
+    int64_t offset_ = 0;
+};
+#endif
+
+// Helper: keys of every document matching filter, from one vector-less query with topk =
+// doc_count that loads no fields. O(N): the engine materializes every hit before the keys
+// are copied out and the hits dropped; only the keys stay resident afterwards.
+static zvec_status_t collect_keys(const Collection::Ptr& col, const std::string& filter,
+    std::vector<std::string>& keys) {
+    OpTimer timer(ZVEC_OP_SCAN_OPEN);
+    auto stats = col->Stats();
+    if (!stats.has_value()) return timer.finish(to_c_status(stats.error()));
+    const uint64_t doc_count = stats.value().doc_count;
+    if (doc_count == 0) return ok_status();
+
+    VectorQuery query;
+    query.topk_ = static_cast<int>(std::min<uint64_t>(doc_count, INT32_MAX));
+    query.filter_ = filter;
+    query.output_fields_ = std::vector<std::string>();
+    auto result = col->Query(query);
+    if (!result.has_value()) return timer.finish(to_c_status(result.error()));
+    keys.reserve(result.value().size());
+    for (auto& hit : result.value()) {
+        if (hit) keys.push_back(hit->pk());
+        hit.reset();
+    }
+    return ok_status();
+}
+
+// Helper: fetch keys [begin, end) in key order; documents deleted since the key pass are skipped
+static zvec_status_t fetch_key_page(const Collection::Ptr& col, const std::vector<std::string>& keys,
+    size_t begin, size_t end, DocPtrList& hits) {
+    std::vector<std::string> pks(keys.begin() + begin, keys.begin() + end);
+    auto fetched = timed(ZVEC_OP_FETCH, [&] { return col->Fetch(pks); });
+    if (!fetched.has_value()) return to_c_status(fetched.error());
+
+    hits.reserve(pks.size());
+    for (const auto& pk : pks) {
+        auto it = fetched.value().find(pk);
+        if (it != fetched.value().end() && it->second) hits.push_back(std::move(it->second));
+    }
+    return ok_status();
+}
+
+#ifdef ZVEC_C_WITH_ARROW
+// Rows per batch when the caller leaves batch_rows at 0
+static constexpr size_t kExportBatchRows = 16384;
+
+// One exported field; column carries the name, type and dimension export_column reads
+struct ExportField {
+    std::string name;
+    zvec_column_t column;
+    std::shared_ptr<arrow::DataType> type;
+};
+
+// Helper: the Arrow type a zvec field is written as, or null if it has none
+static std::shared_ptr<arrow::DataType> export_arrow_type(int32_t data_type, int32_t dimension) {
+    auto vector = [dimension](std::shared_ptr<arrow::DataType> element) {
+        return dimension > 0 ? arrow::fixed_size_list(std::move(element), dimension) : nullptr;
+    };
+    switch (data_type) {
+        case ZVEC_DATA_TYPE_STRING:       return arrow::utf8();
+        case ZVEC_DATA_TYPE_BOOL:         return arrow::boolean();
+        case ZVEC_DATA_TYPE_INT32:        return arrow::int32();
+        case ZVEC_DATA_TYPE_INT64:        return arrow::int64();
+        case ZVEC_DATA_TYPE_UINT32:       return arrow::uint32();
+        case ZVEC_DATA_TYPE_UINT64:       return arrow::uint64();
+        case ZVEC_DATA_TYPE_FLOAT:        return arrow::float32();
+        case ZVEC_DATA_TYPE_DOUBLE:       return arrow::float64();
+        case ZVEC_DATA_TYPE_VECTOR_FP16:  return vector(arrow::float16());
+        case ZVEC_DATA_TYPE_VECTOR_FP32:  return vector(arrow::float32());
+        case ZVEC_DATA_TYPE_VECTOR_FP64:  return vector(arrow::float64());
+        case ZVEC_DATA_TYPE_VECTOR_INT8:  return vector(arrow::int8());
+        case ZVEC_DATA_TYPE_VECTOR_INT16: return vector(arrow::int16());
+        default:                          return nullptr;
+    }
+}
+
+// Helper: Arrow validity (bit set = valid) from zvec's null bitmap (bit set = null); null if no nulls
+static std::shared_ptr<arrow::Buffer> export_validity(const std::vector<uint8_t>& nulls, size_t rows,
+    int64_t& null_count) {
+    null_count = 0;
+    for (size_t i = 0; i < rows; i++) null_count += (nulls[i >> 3] >> (i & 7)) & 1;
+    if (null_count == 0) return nullptr;
+    std::vector<uint8_t> valid(nulls.size());
+    for (size_t b = 0; b < nulls.size(); b++) valid[b] = static_cast<uint8_t>(~nulls[b]);
+    return arrow::Buffer::FromVector(std::move(valid));
+}
+
+// Helper: hand one exported column's buffers to an Arrow array without copying the values
+static std::shared_ptr<arrow::Array> export_arrow_array(const ExportField& field, ExportColumn& col, size_t rows) {
+    int64_t null_count;
+    auto validity = export_validity(col.null_bitmap, rows, null_count);
+    const auto length = static_cast<int64_t>(rows);
+
+    switch (field.column.data_type) {
+        case ZVEC_DATA_TYPE_STRING:
+            return std::make_shared<arrow::StringArray>(length, arrow::Buffer::FromVector(std::move(col.offsets)),
+                arrow::Buffer::FromVector(std::move(col.values)), validity, null_count);
+        case ZVEC_DATA_TYPE_BOOL: {
+            // zvec exports a byte per row; Arrow packs booleans into bits.
+            std::vector<uint8_t> bits((rows + 7) / 8, 0);
+            for (size_t i = 0; i < rows; i++) {
+                if (col.values[i]) bits[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+            }
+            return std::make_shared<arrow::BooleanArray>(length, arrow::Buffer::FromVector(std::move(bits)),
+                validity, null_count);
+        }
+        default:
+            break;
+    }
+
+    auto values = arrow::Buffer::FromVector(std::move(col.values));
+    if (field.type->id() != arrow::Type::FIXED_SIZE_LIST) {
+        return arrow::MakeArray(arrow::ArrayData::Make(field.type, length, {validity, values}, null_count));
+    }
+    const auto& list = static_cast<const arrow::FixedSizeListType&>(*field.type);
+    auto elements = arrow::MakeArray(arrow::ArrayData::Make(list.value_type(),
+        length * list.list_size(), {nullptr, values}, 0));
+    return std::make_shared<arrow::FixedSizeListArray>(field.type, length, elements, validity, null_count);
+}
+
+// One fetched and converted batch; error is set instead of batch on failure
+struct ExportBatch {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    std::string error;
+};
+
+// Helper: fetch keys [begin, end) and convert them to a record batch, rows in key order
+static ExportBatch build_export_batch(const Collection::Ptr& col, const std::vector<std::string>& keys,
+    size_t begin, size_t end, const std::shared_ptr<arrow::Schema>& schema, const std::vector<ExportField>& fields) {
+    ExportBatch out;
+    DocPtrList hits;
+    auto fetched = fetch_key_page(col, keys, begin, end, hits);
+    if (fetched.code != 0) {
+        out.error = fetched.message ? fetched.message : "fetch failed";
+        return out;
+    }
+
+    std::vector<uint8_t> pk_data;
+    std::vector<int32_t> pk_offsets(1, 0);
+    pk_offsets.reserve(hits.size() + 1);
+    for (const auto& hit : hits) {
+        auto pk = hit->pk();
+        pk_data.insert(pk_data.end(), pk.begin(), pk.end());
+        pk_offsets.push_back(static_cast<int32_t>(pk_data.size()));
+    }
+
+    std::vector<std::shared_ptr<arrow::Array>> arrays;
+    arrays.reserve(fields.size() + 1);
+    arrays.push_back(std::make_shared<arrow::StringArray>(static_cast<int64_t>(hits.size()),
+        arrow::Buffer::FromVector(std::move(pk_offsets)), arrow::Buffer::FromVector(std::move(pk_data))));
+    for (const auto& field : fields) {
+        ExportColumn column;
+        export_column(hits, field.column, column);
+        arrays.push_back(export_arrow_array(field, column, hits.size()));
+    }
+    out.batch = arrow::RecordBatch::Make(schema, static_cast<int64_t>(hits.size()), std::move(arrays));
+    return out;
+}
+
+// Helper: resolve the exported fields against the schema; error explains a failure
+static bool resolve_export_fields(const CollectionSchema& schema, const zvec_export_options_t& options,
+    std::vector<ExportField>& fields, std::string& error) {
+    std::vector<FieldSchema::Ptr> selected;
+    const bool all = !options.fields || options.field_count == 0;
+    if (all) {
+        for (const auto& f : schema.forward_fields()) selected.push_back(f);
+        for (const auto& f : schema.vector_fields()) selected.push_back(f);
+    } else {
+        for (size_t i = 0; i < options.field_count; i++) {
+            auto f = options.fields[i] ? schema.get_field_ptr(options.fields[i]) : nullptr;
+            if (!f) {
+                error = std::string("unknown field '") + (options.fields[i] ? options.fields[i] : "") + "'";
+                return false;
+            }
+            selected.push_back(f);
+        }
+    }
+
+    for (const auto& f : selected) {
+        const auto data_type = static_cast<int32_t>(f->data_type());
+        const auto dimension = static_cast<int32_t>(f->dimension());
+        auto type = export_arrow_type(data_type, dimension);
+        if (!type) {
+            // Sparse vectors and binary fields have no column layout; a full export leaves them out.
+            if (all) continue;
+            error = "field '" + f->name() + "' cannot be exported";
+            return false;
+        }
+        fields.push_back(ExportField{f->name(), {nullptr, data_type, dimension, nullptr, nullptr, 0, nullptr}, type});
+    }
+    for (auto& field : fields) field.column.name = field.name.c_str();
+    return true;
+}
+
+// Helper: the export itself; returns an error message, empty on success
+static std::string run_export(const Collection::Ptr& col, const std::string& path, int32_t format,
+    const zvec_export_options_t& options, zvec_export_report_t& report) {
+    auto collection_schema = col->Schema();
+    if (!collection_schema.has_value()) return collection_schema.error().c_str();
+    std::vector<ExportField> fields;
+    std::string error;
+    if (!resolve_export_fields(collection_schema.value(), options, fields, error)) return error;
+
+    arrow::FieldVector columns;
+    columns.push_back(arrow::field(options.pk_column ? options.pk_column : "pk", arrow::utf8(), false));
+    for (const auto& field : fields) columns.push_back(arrow::field(field.name, field.type));
+    auto schema = arrow::schema(std::move(columns));
+
+    // Key pass: only the keys stay resident; documents are fetched a batch at a time below.
+    std::vector<std::string> keys;
+    auto collected = collect_keys(col, options.filter ? options.filter : "", keys);
+    if (collected.code != 0) return collected.message ? collected.message : "key pass failed";
+
+    auto sink = arrow::io::FileOutputStream::Open(path);
+    if (!sink.ok()) return sink.status().ToString();
+    std::shared_ptr<arrow::ipc::RecordBatchWriter> ipc;
+    std::unique_ptr<parquet::arrow::FileWriter> parquet;
+    if (format == ZVEC_EXPORT_PARQUET) {
+        auto writer = parquet::arrow::FileWriter::Open(*schema, arrow::default_memory_pool(), *sink);
+        if (!writer.ok()) return writer.status().ToString();
+        parquet = std::move(writer).ValueUnsafe();
+    } else {
+        auto writer = arrow::ipc::MakeFileWriter(*sink, schema);
+        if (!writer.ok()) return writer.status().ToString();
+        ipc = *writer;
+    }
+
+    const size_t batch_rows = options.batch_rows > 0 ? options.batch_rows : kExportBatchRows;
+    const size_t window = options.concurrency > 0
+        ? static_cast<size_t>(options.concurrency)
+        : std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    // Batches are fetched up to `window` ahead and written in order as they complete.
+    std::deque<std::future<ExportBatch>> pending;
+    size_t next = 0;
+    auto fill = [&] {
+        while (pending.size() < window && next < keys.size()) {
+            const size_t begin = next;
+            const size_t end = std::min(keys.size(), begin + batch_rows);
+            next = end;
+            pending.push_back(std::async(std::launch::async, [&, begin, end] {
+                return build_export_batch(col, keys, begin, end, schema, fields);
+            }));
+        }
+    };
+
+    arrow::Status status;
+    fill();
+    while (!pending.empty() && status.ok()) {
+        auto batch = pending.front().get();
+        pending.pop_front();
+        if (!batch.error.empty()) {
+            error = batch.error;
+            break;
+        }
+        fill();
+        if (batch.batch->num_rows() == 0) continue;
+        if (parquet) {
+            // One row group per batch keeps the writer from buffering more than a batch.
+            auto table = arrow::Table::FromRecordBatches(schema, {batch.batch});
+            status = table.ok() ? parquet->WriteTable(**table, batch.batch->num_rows()) : table.status();
+        } else {
+            status = ipc->WriteRecordBatch(*batch.batch);
+        }
+        report.rows += static_cast<uint64_t>(batch.batch->num_rows());
+        report.batches++;
+    }
+    // An early stop leaves fetches running that reference keys; wait for them.
+    for (auto& f : pending) f.wait();
+
+    auto closed = parquet ? parquet->Close() : ipc->Close();
+    if (status.ok()) status = closed;
+    auto size = (*sink)->Tell();
+    closed = (*sink)->Close();
+    if (status.ok()) status = closed;
+    if (error.empty() && !status.ok()) error = status.ToString();
+    if (error.empty() && size.ok()) report.bytes_written = static_cast<uint64_t>(*size);
+    return error;
+}
+#endif
+
+extern "C" {
+
+// ===== Version =====
+const char* zvec_version() {
+    return "0.2.0";
+}
+
+// ===== Document =====
+zvec_doc_handle_t zvec_doc_create() {
+    return new zvec_doc_t();
+}
+
+void zvec_doc_destroy(zvec_doc_handle_t handle) {
+    delete handle;
+}
+
+void zvec_doc_set_pk(zvec_doc_handle_t handle, const char* pk) {
+    if (handle && pk) {
+        handle->doc.set_pk(std::string(pk));
+        handle->pk_cache = pk;
+    }
+}
+
+const char* zvec_doc_get_pk(zvec_doc_handle_t handle) {
+    if (!handle) return nullptr;
+    handle->pk_cache = handle->doc.pk();
+    return handle->pk_cache.c_str();
+}
+
+double zvec_doc_get_score(zvec_doc_handle_t handle) {
+    return handle ? handle->doc.score() : 0.0;
+}
+
+zvec_status_t zvec_doc_set_string(zvec_doc_handle_t handle, const char* field, const char* value) {
+    return set_doc_value<std::string>(handle, field, value ? std::string(value) : std::string());
+}
+
+zvec_status_t zvec_doc_set_int32(zvec_doc_handle_t handle, const char* field, int32_t value) {
+    return set_doc_value<int32_t>(handle, field, value);
+}
+
+zvec_status_t zvec_doc_set_int64(zvec_doc_handle_t handle, const char* field, int64_t value) {
+    return set_doc_value<int64_t>(handle, field, value);
+}
+
+zvec_status_t zvec_doc_set_float(zvec_doc_handle_t handle, const char* field, float value) {
+    return set_doc_value<float>(handle, field, value);
+}
+
+zvec_status_t zvec_doc_set_double(zvec_doc_handle_t handle, const char* field, double value) {
+    return set_doc_value<double>(handle, field, value);
+}
+
+zvec_status_t zvec_doc_set_bool(zvec_doc_handle_t handle, const char* field, int value) {
+    return set_doc_value<bool>(handle, field, value != 0);
+}
+
+zvec_status_t zvec_doc_set_null(zvec_doc_handle_t handle, const char* field) {
+    if (!handle || !field) return {2, "null argument"};
+    handle->doc.set_null(field);
+    return ok_status();
+}
+
+zvec_status_t zvec_doc_set_vector_f32(zvec_doc_handle_t handle, const char* field, const float* data, size_t len) {
+    return set_doc_vector<float>(handle, field, data, len);
+}
+
+zvec_status_t zvec_doc_set_vector_f16(zvec_doc_handle_t handle, const char* field, const uint16_t* data, size_t len) {
+    return set_doc_vector<float16_t>(handle, field, data, len);
+}
+
+zvec_status_t zvec_doc_set_vector_i8(zvec_doc_handle_t handle, const char* field, const int8_t* data, size_t len) {
+    return set_doc_vector<int8_t>(handle, field, data, len);
+}
+
+zvec_status_t zvec_doc_set_vector_i16(zvec_doc_handle_t handle, const char* field, const int16_t* data, size_t len) {
+    return set_doc_vector<int16_t>(handle, field, data, len);
+}
+
+zvec_status_t zvec_doc_set_sparse_vector_f32(zvec_doc_handle_t handle, const char* field, 
+    const uint32_t* indices, const float* values, size_t len) {
+    return set_doc_sparse_vector(handle, field, indices, values, len);
+}
+
+size_t zvec_doc_get_vector_f32(zvec_doc_handle_t handle, const char* field, float* out_data, size_t max_len) {
+    return get_doc_vector<float>(handle, field, out_data, max_len);
+}
+
+size_t zvec_doc_get_vector_f16(zvec_doc_handle_t handle, const char* field, uint16_t* out_data, size_t max_len) {
+    return get_doc_vector<float16_t>(handle, field, out_data, max_len);
+}
+
+size_t zvec_doc_get_vector_i8(zvec_doc_handle_t handle, const char* field, int8_t* out_data, size_t max_len) {
+    return get_doc_vector<int8_t>(handle, field, out_data, max_len);
+}
+
+size_t zvec_doc_get_vector_i16(zvec_doc_handle_t handle, const char* field, int16_t* out_data, size_t max_len) {
+    return get_doc_vector<int16_t>(handle, field, out_data, max_len);
+}
+
+int zvec_doc_has_field(zvec_doc_handle_t handle, const char* field) {
+    if (!handle || !field) return 0;
+    return handle->doc.has(field) ? 1 : 0;
+}
+
+const char* zvec_doc_get_string(zvec_doc_handle_t handle, const char* field) {
+    if (!handle || !field) return nullptr;
+    auto result = handle->doc.get<std::string>(field);
+    if (result.has_value()) {
+        handle->pk_cache = result.value();
+        return handle->pk_cache.c_str();
+    }
+    return nullptr;
+}
+
+int64_t zvec_doc_get_int64(zvec_doc_handle_t handle, const char* field) {
+    if (!handle || !field) return 0;
+    auto result = handle->doc.get<int64_t>(field);
+    return result.has_value() ? result.value() : 0;
+}
+
+double zvec_doc_get_double(zvec_doc_handle_t handle, const char* field) {
+    if (!handle || !field) return 0.0;
+    auto result = handle->doc.get<double>(field);
+    return result.has_value() ? result.value() : 0.0;
+}
+
+int zvec_doc_get_bool(zvec_doc_handle_t handle, const char* field) {
+    if (!handle || !field) return 0;
+    auto result = handle->doc.get<bool>(field);
+    return result.has_value() ? (result.value() ? 1 : 0) : 0;
+}
+
+// ===== Document Batch =====
+zvec_doc_batch_handle_t zvec_doc_batch_create(size_t capacity) {
+    auto* batch = new zvec_doc_batch_t();
+    batch->slots.resize(capacity);
+    batch->staging.reserve(capacity);
+    return batch;
+}
+
+void zvec_doc_batch_destroy(zvec_doc_batch_handle_t batch) {
+    delete batch;
+}
+
+zvec_doc_handle_t zvec_doc_batch_add(zvec_doc_batch_handle_t batch) {
+    if (!batch) return nullptr;
+    if (batch->count == batch->slots.size()) {
+        batch->slots.emplace_back();
+    }
+    auto& slot = batch->slots[batch->count++];
+    slot.doc = Doc();
+    slot.pk_cache.clear();
+    slot.vector_cache.clear();
+    return &slot;
+}
+
+void zvec_doc_batch_clear(zvec_doc_batch_handle_t batch) {
+    if (batch) batch->count = 0;
+}
+
+size_t zvec_doc_batch_count(zvec_doc_batch_handle_t batch) {
+    return batch ? batch->count : 0;
+}
+
+// ===== Resolved Fields =====
+zvec_status_t zvec_collection_resolve_field(zvec_collection_handle_t handle, const char* name,
+    int32_t data_type, zvec_field_id_t* out_field) {
+    if (!handle || !engine(handle) || !name || !out_field) return {2, "null argument"};
+
+    std::lock_guard<std::mutex> lock(handle->fields_mutex);
+    const zvec_field_t* resolved = nullptr;
+    for (const auto& field : handle->fields) {
+        if (field.name == name) {
+            resolved = &field;
+            break;
+        }
+    }
+    if (!resolved) {
+        auto schema = engine(handle)->Schema();
+        if (!schema.has_value()) return to_c_status(schema.error());
+        auto field = schema.value().get_field_ptr(name);
+        if (!field) return message_status(std::string("unknown field '") + name + "'");
+        handle->fields.push_back(zvec_field_t{name, field->data_type(), field->dimension()});
+        resolved = &handle->fields.back();
+    }
+
+    if (data_type != ZVEC_DATA_TYPE_UNDEFINED) {
+        auto checked = check_field(resolved, static_cast<DataType>(data_type));
+        if (checked.code != 0) return checked;
+    }
+    *out_field = resolved;
+    return ok_status();
+}
+
+zvec_status_t zvec_doc_set_string_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const char* value) {
+    return set_doc_value<std::string>(handle, field, value ? std::string(value) : std::string());
+}
+
+zvec_status_t zvec_doc_set_int32_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, int32_t value) {
+    return set_doc_value<int32_t>(handle, field, value);
+}
+
+zvec_status_t zvec_doc_set_int64_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, int64_t value) {
+    return set_doc_value<int64_t>(handle, field, value);
+}
+
+zvec_status_t zvec_doc_set_float_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, float value) {
+    return set_doc_value<float>(handle, field, value);
+}
+
+zvec_status_t zvec_doc_set_double_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, double value) {
+    return set_doc_value<double>(handle, field, value);
+}
+
+zvec_status_t zvec_doc_set_bool_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, int value) {
+    return set_doc_value<bool>(handle, field, value != 0);
+}
+
+zvec_status_t zvec_doc_set_null_by_id(zvec_doc_handle_t handle, zvec_field_id_t field) {
+    if (!handle || !field) return {2, "null argument"};
+    handle->doc.set_null(field->name);
+    return ok_status();
+}
+
+zvec_status_t zvec_doc_set_vector_f32_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const float* data, size_t len) {
+    return set_doc_vector<float>(handle, field, data, len);
+}
+
+zvec_status_t zvec_doc_set_vector_f16_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const uint16_t* data, size_t len) {
+    return set_doc_vector<float16_t>(handle, field, data, len);
+}
+
+zvec_status_t zvec_doc_set_vector_i8_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const int8_t* data, size_t len) {
+    return set_doc_vector<int8_t>(handle, field, data, len);
+}
+
+zvec_status_t zvec_doc_set_vector_i16_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const int16_t* data, size_t len) {
+    return set_doc_vector<int16_t>(handle, field, data, len);
+}
+
+zvec_status_t zvec_doc_set_sparse_vector_f32_by_id(zvec_doc_handle_t handle, zvec_field_id_t field,
+    const uint32_t* indices, const float* values, size_t len) {
+    return set_doc_sparse_vector(handle, field, indices, values, len);
+}
+
+// ===== Schema Creation =====
+zvec_schema_handle_t zvec_schema_create(const char* name) {
+    if (!name) return nullptr;
+    auto* schema = new zvec_schema_t();
+    schema->schema = CollectionSchema(std::string(name));
+    return schema;
+}
+
+void zvec_schema_destroy(zvec_schema_handle_t handle) {
+    delete handle;
+}
+
+zvec_status_t zvec_schema_add_field(zvec_schema_handle_t handle, const zvec_field_def_t* field_def) {
+    if (!handle || !field_def) return {2, "null argument"};
+    
+    auto field = create_field_schema(field_def);
+    if (!field) return {2, "invalid field definition"};
+    
+    auto status = handle->schema.add_field(field);
+    return to_c_status(status);
+}
+
+zvec_status_t zvec_schema_add_vector_field(zvec_schema_handle_t handle, const zvec_field_def_t* field_def) {
+    if (!handle || !field_def) return {2, "null argument"};
+    
+    auto field = create_field_schema(field_def);
+    if (!field) return {2, "invalid field definition"};
+    
+    // Ensure it's a vector type
+    if (!FieldSchema::is_vector_field(field->data_type())) {
+        return {2, "not a vector field type"};
+    }
+    
+    auto status = handle->schema.add_field(field);
+    return to_c_status(status);
+}
+
+// ===== Schema (from collection) =====
+zvec_schema_handle_t zvec_collection_get_schema(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return nullptr;
+    
+    auto result = engine(handle)->Schema();
+    if (result.has_value()) {
+        auto* schema = new zvec_schema_t();
+        schema->schema = result.value();
+        return schema;
+    }
+    return nullptr;
+}
+
+const char* zvec_schema_get_name(zvec_schema_handle_t handle) {
+    if (!handle) return nullptr;
+    handle->name_cache = handle->schema.name();
+    return handle->name_cache.c_str();
+}
+
+size_t zvec_schema_get_field_count(zvec_schema_handle_t handle) {
+    if (!handle) return 0;
+    return handle->schema.fields().size();
+}
+
+size_t zvec_schema_get_vector_count(zvec_schema_handle_t handle) {
+    if (!handle) return 0;
+    return handle->schema.vector_fields().size();
+}
+
+zvec_field_def_t zvec_schema_get_field(zvec_schema_handle_t handle, size_t index) {
+    zvec_field_def_t def = {nullptr, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    if (!handle) return def;
+    
+    auto fields = handle->schema.fields();
+    if (index >= fields.size()) return def;
+    
+    const auto& field = fields[index];
+    def.name = field->name().c_str();
+    def.data_type = static_cast<int32_t>(field->data_type());
+    def.dimension = field->dimension();
+    def.nullable = field->nullable() ? 1 : 0;
+    def.index_type = static_cast<int32_t>(field->index_type());
+    
+    return def;
+}
+
+zvec_field_def_t zvec_schema_get_vector(zvec_schema_handle_t handle, size_t index) {
+    zvec_field_def_t def = {nullptr, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    if (!handle) return def;
+    
+    auto vectors = handle->schema.vector_fields();
+    if (index >= vectors.size()) return def;
+    
+    const auto& field = vectors[index];
+    def.name = field->name().c_str();
+    def.data_type = static_cast<int32_t>(field->data_type());
+    def.dimension = field->dimension();
+    def.nullable = field->nullable() ? 1 : 0;
+    def.index_type = static_cast<int32_t>(field->index_type());
     
-    auto field = create_field_schema(field_def);
-    if (!field) return {2, "invalid field definition"};
+    // Get metric type from index params if available
+    fill_index_def(def, field->index_params().get());
+    
+    return def;
+}
+
+// ===== Query =====
+zvec_query_handle_t zvec_query_create() {
+    return new zvec_query_t();
+}
+
+void zvec_query_destroy(zvec_query_handle_t handle) {
+    delete handle;
+}
+
+void zvec_query_set_topk(zvec_query_handle_t handle, int32_t topk) {
+    if (handle) handle->query.topk_ = topk;
+}
+
+void zvec_query_set_field_name(zvec_query_handle_t handle, const char* field_name) {
+    if (handle && field_name) {
+        handle->field_name_cache = field_name;
+        handle->query.field_name_ = handle->field_name_cache;
+    }
+}
+
+void zvec_query_set_vector(zvec_query_handle_t handle, const float* data, size_t len) {
+    if (handle && data) {
+        handle->query.query_vector_.assign(reinterpret_cast<const char*>(data), len * sizeof(float));
+    }
+}
+
+void zvec_query_set_vector_f16(zvec_query_handle_t handle, const uint16_t* data, size_t len) {
+    if (handle && data) {
+        handle->query.query_vector_.assign(reinterpret_cast<const char*>(data), len * sizeof(uint16_t));
+    }
+}
+
+void zvec_query_set_vector_i8(zvec_query_handle_t handle, const int8_t* data, size_t len) {
+    if (handle && data) {
+        handle->query.query_vector_.assign(reinterpret_cast<const char*>(data), len * sizeof(int8_t));
+    }
+}
+
+void zvec_query_set_vector_i16(zvec_query_handle_t handle, const int16_t* data, size_t len) {
+    if (handle && data) {
+        handle->query.query_vector_.assign(reinterpret_cast<const char*>(data), len * sizeof(int16_t));
+    }
+}
+
+void zvec_query_set_sparse_vector(zvec_query_handle_t handle, const uint32_t* indices, const float* values, size_t len) {
+    if (handle && indices && values) {
+        handle->query.query_sparse_indices_.assign(
+            reinterpret_cast<const char*>(indices), len * sizeof(uint32_t));
+        handle->sparse_values_cache.assign(values, values + len);
+    }
+}
+
+void zvec_query_set_filter(zvec_query_handle_t handle, const char* filter) {
+    if (handle && filter) {
+        handle->filter_cache = filter;
+        handle->query.filter_ = handle->filter_cache;
+    }
+}
+
+void zvec_query_set_include_vector(zvec_query_handle_t handle, int include) {
+    if (handle) handle->query.include_vector_ = include != 0;
+}
+
+void zvec_query_set_output_fields(zvec_query_handle_t handle, const char** fields, size_t count) {
+    if (handle && fields) {
+        handle->output_fields_cache.clear();
+        handle->output_fields_ptrs.clear();
+        for (size_t i = 0; i < count; i++) {
+            handle->output_fields_cache.push_back(fields[i]);
+        }
+        handle->query.output_fields_ = handle->output_fields_cache;
+    }
+}
+
+void zvec_query_set_ef_search(zvec_query_handle_t handle, int32_t ef) {
+    if (handle) {
+        handle->params.ef = ef;
+        handle->has_params = true;
+    }
+}
+
+void zvec_query_set_n_probe(zvec_query_handle_t handle, int32_t n_probe) {
+    if (handle) {
+        handle->params.n_probe = n_probe;
+        handle->has_params = true;
+    }
+}
+
+void zvec_query_set_params(zvec_query_handle_t handle, const zvec_query_params_t* params) {
+    if (handle && params) {
+        handle->params = *params;
+        handle->has_params = true;
+    }
+}
+
+// ===== Id Sets =====
+zvec_status_t zvec_id_set_create(const char** pks, size_t count, zvec_id_set_handle_t* out) {
+    if (!pks && count > 0) return {2, "null pks"};
+    if (!out) return {2, "null out"};
+
+    OpTimer timer(ZVEC_OP_ID_SET_CREATE);
+    auto set = std::make_shared<IdSet>();
+    set->pks.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        if (!pks[i]) return timer.finish({2, "null pk"});
+        set->pks.emplace(pks[i]);
+    }
+    set->id = g_next_id_set.fetch_add(1, std::memory_order_relaxed);
+
+    *out = new zvec_id_set_t{std::move(set)};
+    return ok_status();
+}
+
+void zvec_id_set_destroy(zvec_id_set_handle_t set) {
+    delete set;
+}
+
+size_t zvec_id_set_count(zvec_id_set_handle_t set) {
+    return set ? set->set->pks.size() : 0;
+}
+
+void zvec_query_set_id_filter(zvec_query_handle_t handle, zvec_id_set_handle_t set, int32_t mode) {
+    if (!handle) return;
+    if (!set || (mode != ZVEC_ID_FILTER_ALLOW && mode != ZVEC_ID_FILTER_DENY)) {
+        handle->id_filter = IdFilter{};
+        return;
+    }
+    handle->id_filter = IdFilter{set->set, mode};
+}
+
+// ===== Collection =====
+zvec_status_t zvec_collection_create_and_open(
+    const char* path,
+    zvec_schema_handle_t schema,
+    const zvec_collection_options_t* options,
+    zvec_collection_handle_t* out)
+{
+    if (!path || !out) {
+        return {2, "null argument"};
+    }
+    if (!schema) {
+        return {2, "null schema"};
+    }
+    
+    OpTimer timer(ZVEC_OP_OPEN);
+    CollectionSchema collection_schema = schema->schema;
+    if (options && options->segment_max_docs > 0) {
+        collection_schema.set_max_doc_count_per_segment(static_cast<uint64_t>(options->segment_max_docs));
+    }
+    
+    auto result = Collection::CreateAndOpen(std::string(path), collection_schema, CollectionOptions{});
+    
+    if (result.has_value()) {
+        auto* col = new zvec_collection_t();
+        col->ptr = result.value();
+        col->path_cache = path;
+        apply_collection_options(col, options);
+        save_deferred_indexes(col);  // drops a file left by an earlier collection at this path
+        *out = col;
+        return ok_status();
+    }
+    
+    return timer.finish(to_c_status(result.error()));
+}
+
+zvec_status_t zvec_collection_open(
+    const char* path,
+    const zvec_collection_options_t* options,
+    zvec_collection_handle_t* out)
+{
+    if (!path || !out) {
+        return {2, "null argument"};
+    }
+    
+    OpTimer timer(ZVEC_OP_OPEN);
+    auto result = Collection::Open(std::string(path), CollectionOptions{});
+    
+    if (result.has_value()) {
+        auto* col = new zvec_collection_t();
+        col->ptr = result.value();
+        col->path_cache = path;
+        apply_collection_options(col, options);
+        load_deferred_indexes(col);
+        *out = col;
+        return ok_status();
+    }
+    
+    return timer.finish(to_c_status(result.error()));
+}
+
+// Helper: engine options for read-only handles: no write path, segments shared through mmap
+static CollectionOptions read_only_options() {
+    CollectionOptions options;
+    options.read_only_ = true;
+    options.enable_mmap_ = true;
+    return options;
+}
+
+zvec_status_t zvec_collection_open_readonly(
+    const char* path,
+    const zvec_collection_options_t* options,
+    zvec_collection_handle_t* out)
+{
+    if (!path || !out) {
+        return {2, "null argument"};
+    }
+
+    OpTimer timer(ZVEC_OP_OPEN);
+    auto result = Collection::Open(std::string(path), read_only_options());
+    if (!result.has_value()) return timer.finish(to_c_status(result.error()));
+
+    auto* col = new zvec_collection_t();
+    col->ptr = result.value();
+    col->path_cache = path;
+    apply_collection_options(col, options);
+    col->auto_flush = false;
+    col->read_only = true;
+    *out = col;
+    return ok_status();
+}
+
+zvec_status_t zvec_collection_refresh(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!handle->read_only) return {2, "refresh needs a read-only handle"};
+    if (handle->snapshot) return {2, "snapshots cannot be refreshed"};
+
+    OpTimer timer(ZVEC_OP_REFRESH);
+    auto path = engine(handle)->Path();
+    if (!path.has_value()) return timer.finish(to_c_status(path.error()));
+    auto result = Collection::Open(path.value(), read_only_options());
+    if (!result.has_value()) return timer.finish(to_c_status(result.error()));
+
+    // Calls already running finish on the engine they loaded; it closes when the last one returns.
+    std::atomic_store(&handle->ptr, result.value());
+    bump_write_epoch(handle);
+    return ok_status();
+}
+
+zvec_status_t zvec_collection_snapshot_create(zvec_collection_handle_t handle, zvec_collection_handle_t* out_snapshot) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!out_snapshot) return {2, "null out"};
+
+    OpTimer timer(ZVEC_OP_SNAPSHOT_CREATE);
+    Collection::Ptr pinned;
+    if (handle->read_only) {
+        // Already immutable until refreshed; the snapshot keeps this engine alive past a refresh
+        pinned = engine(handle);
+    } else {
+        // Flush and reopen with no optimize in between, so the files opened are the ones flushed
+        std::lock_guard<std::mutex> lock(handle->optimize_mutex);
+        auto status = engine(handle)->Flush();
+        if (!status.ok()) return timer.finish(to_c_status(status));
+        auto path = engine(handle)->Path();
+        if (!path.has_value()) return timer.finish(to_c_status(path.error()));
+        auto result = Collection::Open(path.value(), read_only_options());
+        if (!result.has_value()) return timer.finish(to_c_status(result.error()));
+        pinned = result.value();
+        // Taken under optimize_mutex, so no optimize or index change is mid-way
+        handle->snapshot_pins->fetch_add(1);
+    }
+
+    auto* snap = new zvec_collection_t();
+    snap->ptr = std::move(pinned);
+    snap->path_cache = handle->path_cache;
+    snap->query_parallel = handle->query_parallel;
+    snap->auto_flush = false;
+    snap->read_only = true;
+    snap->snapshot = true;
+    if (!handle->read_only) snap->pinned_writer = handle->snapshot_pins;
+    if (handle->query_cache) {
+        snap->query_cache = std::make_unique<QueryCache>(handle->query_cache->capacity());
+    }
+    {
+        std::lock_guard<std::mutex> lock(handle->query_defaults_mutex);
+        snap->query_defaults = handle->query_defaults;
+        snap->has_query_defaults = !snap->query_defaults.empty();
+    }
+    *out_snapshot = snap;
+    return ok_status();
+}
+
+zvec_status_t zvec_collection_snapshot_release(zvec_collection_handle_t snapshot) {
+    if (!snapshot) return {2, "null handle"};
+    if (!snapshot->snapshot) return {2, "handle is not a snapshot"};
+    zvec_collection_destroy(snapshot);
+    return ok_status();
+}
+
+void zvec_collection_destroy(zvec_collection_handle_t handle) {
+    if (handle) {
+        stop_auto_optimize(handle);
+        // Drain queued async operations while the engine is still open
+        handle->pool.reset();
+        handle->ptr.reset();
+        if (handle->pinned_writer) handle->pinned_writer->fetch_sub(1);
+        delete handle;
+    }
+}
+
+zvec_status_t zvec_collection_destroy_data(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (snapshot_pinned(handle)) return snapshot_pinned_status();
+    auto status = engine(handle)->Destroy();
+    bump_write_epoch(handle);
+    if (status.ok()) {
+        handle->deferred_indexes.clear();
+        save_deferred_indexes(handle);
+    }
+    return to_c_status(status);
+}
+
+zvec_status_t zvec_collection_flush(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    OpTimer timer(ZVEC_OP_FLUSH);
+    return timer.finish(to_c_status(engine(handle)->Flush()));
+}
+
+zvec_status_t zvec_collection_optimize(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (snapshot_pinned(handle)) return snapshot_pinned_status();
+    OpTimer timer(ZVEC_OP_OPTIMIZE);
+    return timer.finish(to_c_status(run_optimize(handle, handle->index_build_parallel)));
+}
+
+zvec_status_t zvec_collection_begin_bulk_load(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    std::lock_guard<std::mutex> lock(handle->optimize_mutex);
+    if (snapshot_pinned(handle)) return snapshot_pinned_status();
+    bool expected = false;
+    if (!handle->bulk_loading.compare_exchange_strong(expected, true)) {
+        return {2, "bulk load already active"};
+    }
+    OpTimer timer(ZVEC_OP_BULK_BEGIN);
+
+    auto schema = engine(handle)->Schema();
+    if (!schema.has_value()) {
+        handle->bulk_loading = false;
+        return timer.finish(to_c_status(schema.error()));
+    }
+
+    // The parameters are persisted before anything is dropped, so a crash at any
+    // point leaves them on disk for the next open.
+    handle->deferred_indexes.clear();
+    for (const auto& field : schema.value().vector_fields()) {
+        if (!field->index_params() || field->index_type() == IndexType::FLAT) continue;
+        handle->deferred_indexes.emplace_back(field->name(), field->index_params());
+    }
+    if (!save_deferred_indexes(handle)) {
+        handle->deferred_indexes.clear();
+        handle->bulk_loading = false;
+        return timer.finish(message_status("cannot write " + bulk_load_path(handle)));
+    }
+
+    CreateIndexOptions index_options;
+    index_options.concurrency_ = handle->index_build_parallel;
+    auto planned = handle->deferred_indexes;
+    for (size_t i = 0; i < planned.size(); i++) {
+        auto status = engine(handle)->DropIndex(planned[i].first);
+        bump_write_epoch(handle);
+        if (status.ok()) continue;
+
+        // Roll back the drops that already happened. Anything that cannot be
+        // rebuilt stays deferred under an active bulk load so end_bulk_load
+        // can still restore it.
+        handle->deferred_indexes.clear();
+        for (size_t j = 0; j < i; j++) {
+            auto restored = engine(handle)->CreateIndex(planned[j].first, planned[j].second, index_options);
+            bump_write_epoch(handle);
+            if (!restored.ok()) handle->deferred_indexes.push_back(planned[j]);
+        }
+        save_deferred_indexes(handle);
+        handle->bulk_loading = !handle->deferred_indexes.empty();
+        return timer.finish(to_c_status(status));
+    }
+
+    return ok_status();
+}
+
+zvec_status_t zvec_collection_end_bulk_load(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (!handle->bulk_loading) return {2, "no bulk load active"};
+
+    OpTimer timer(ZVEC_OP_BULK_END);
+    // Each entry is removed only once its index is rebuilt, so a failed call
+    // leaves the load active and a retry picks up where this one stopped.
+    CreateIndexOptions index_options;
+    index_options.concurrency_ = handle->index_build_parallel;
+    auto& deferred = handle->deferred_indexes;
+    while (!deferred.empty()) {
+        const auto& [field_name, params] = deferred.front();
+        auto status = engine(handle)->CreateIndex(field_name, params, index_options);
+        bump_write_epoch(handle);
+        if (!status.ok()) return timer.finish(to_c_status(status));
+        deferred.erase(deferred.begin());
+        // A stale entry left by a failed save is skipped when the file is loaded.
+        save_deferred_indexes(handle);
+    }
+    handle->bulk_loading = false;
+
+    auto status = run_optimize(handle, handle->index_build_parallel);
+    if (!status.ok()) return timer.finish(to_c_status(status));
+
+    return timer.finish(to_c_status(engine(handle)->Flush()));
+}
+
+zvec_status_t zvec_collection_create_index(
+    zvec_collection_handle_t handle,
+    const char* field_name,
+    const zvec_field_def_t* index_def)
+{
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (!field_name) return {2, "null field_name"};
+    if (!index_def) return {2, "null index_def"};
+    
+    auto index_params = create_index_params(index_def);
+    if (!index_params) return {2, "invalid index definition"};
+    
+    // Held so a snapshot cannot open between the check and the rebuild
+    std::lock_guard<std::mutex> lock(handle->optimize_mutex);
+    if (snapshot_pinned(handle)) return snapshot_pinned_status();
+    OpTimer timer(ZVEC_OP_CREATE_INDEX);
+    CreateIndexOptions index_options;
+    index_options.concurrency_ = handle->index_build_parallel;
+    auto status = engine(handle)->CreateIndex(std::string(field_name), index_params, index_options);
+    bump_write_epoch(handle);
+    return timer.finish(to_c_status(status));
+}
+
+zvec_status_t zvec_collection_drop_index(
+    zvec_collection_handle_t handle,
+    const char* field_name)
+{
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (!field_name) return {2, "null field_name"};
+    
+    std::lock_guard<std::mutex> lock(handle->optimize_mutex);
+    if (snapshot_pinned(handle)) return snapshot_pinned_status();
+    OpTimer timer(ZVEC_OP_DROP_INDEX);
+    auto status = engine(handle)->DropIndex(std::string(field_name));
+    bump_write_epoch(handle);
+    return timer.finish(to_c_status(status));
+}
+
+// Helper: shared body of the document-handle writes
+static zvec_status_t write_docs(zvec_collection_t* handle, zvec_doc_handle_t* docs, size_t count,
+    Result<WriteResults> (Collection::*write)(std::vector<Doc>&), const DocStatusOut* out = nullptr) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (out) {
+        auto status = begin_status_write(docs ? count : 0, *out);
+        if (status.code != 0) return status;
+    }
+    if (!docs || count == 0) return ok_status();
+
+    OpTimer timer(write_op(write));
+    auto zvec_docs = timed(ZVEC_OP_WRITE_CONVERT, [&] { return copy_docs(docs, count); });
+    return timer.finish(run_write(handle, zvec_docs, write, out));
+}
+
+// Helper: shared body of the columnar writes
+static zvec_status_t write_columnar(zvec_collection_t* handle, const zvec_column_batch_t* batch,
+    Result<WriteResults> (Collection::*write)(std::vector<Doc>&), const DocStatusOut* out = nullptr) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (out) {
+        auto status = begin_status_write(batch ? batch->row_count : 0, *out);
+        if (status.code != 0) return status;
+    }
+    if (!batch || batch->row_count == 0) return ok_status();
+
+    OpTimer timer(write_op(write));
+    std::vector<Doc> zvec_docs;
+    auto build_status = timed(ZVEC_OP_WRITE_CONVERT, [&] { return build_columnar_docs(collection_pool(handle), batch, zvec_docs); });
+    if (build_status.code != 0) return timer.finish(build_status);
+
+    return timer.finish(run_write(handle, zvec_docs, write, out));
+}
+
+// Helper: shared body of the deletes by id
+static zvec_status_t delete_ids(zvec_collection_t* handle, const char** ids, size_t count,
+    const DocStatusOut* out = nullptr) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (out) {
+        auto status = begin_status_write(ids ? count : 0, *out);
+        if (status.code != 0) return status;
+    }
+    if (!ids || count == 0) return ok_status();
+
+    OpTimer timer(ZVEC_OP_DELETE);
+    auto pks = timed(ZVEC_OP_WRITE_CONVERT, [&] { return copy_pks(ids, count); });
+    auto result = timed(ZVEC_OP_WRITE_ENGINE, [&] { return engine(handle)->Delete(pks); });
+    handle->pending_deletes += pks.size();
+    return timer.finish(finish_write(handle, result, count, out));
+}
+
+zvec_status_t zvec_collection_insert(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count) {
+    return write_docs(handle, docs, count, &Collection::Insert);
+}
+
+zvec_status_t zvec_collection_upsert(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count) {
+    return write_docs(handle, docs, count, &Collection::Upsert);
+}
+
+zvec_status_t zvec_collection_update(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count) {
+    return write_docs(handle, docs, count, &Collection::Update);
+}
+
+zvec_status_t zvec_collection_insert_doc_batch(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch) {
+    return write_doc_batch(handle, batch, &Collection::Insert);
+}
+
+zvec_status_t zvec_collection_upsert_doc_batch(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch) {
+    return write_doc_batch(handle, batch, &Collection::Upsert);
+}
+
+zvec_status_t zvec_collection_update_doc_batch(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch) {
+    return write_doc_batch(handle, batch, &Collection::Update);
+}
+
+zvec_status_t zvec_collection_insert_columnar(zvec_collection_handle_t handle, const zvec_column_batch_t* batch) {
+    return write_columnar(handle, batch, &Collection::Insert);
+}
+
+zvec_status_t zvec_collection_upsert_columnar(zvec_collection_handle_t handle, const zvec_column_batch_t* batch) {
+    return write_columnar(handle, batch, &Collection::Upsert);
+}
+
+zvec_status_t zvec_collection_delete(zvec_collection_handle_t handle, const char** ids, size_t count) {
+    return delete_ids(handle, ids, count);
+}
+
+zvec_status_t zvec_collection_insert_with_status(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_doc_status_t* out_statuses, size_t* out_failed) {
+    DocStatusOut out{out_statuses, out_failed};
+    return write_docs(handle, docs, count, &Collection::Insert, &out);
+}
+
+zvec_status_t zvec_collection_upsert_with_status(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_doc_status_t* out_statuses, size_t* out_failed) {
+    DocStatusOut out{out_statuses, out_failed};
+    return write_docs(handle, docs, count, &Collection::Upsert, &out);
+}
+
+zvec_status_t zvec_collection_update_with_status(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_doc_status_t* out_statuses, size_t* out_failed) {
+    DocStatusOut out{out_statuses, out_failed};
+    return write_docs(handle, docs, count, &Collection::Update, &out);
+}
+
+zvec_status_t zvec_collection_insert_doc_batch_with_status(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed) {
+    DocStatusOut out{out_statuses, out_failed};
+    return write_doc_batch(handle, batch, &Collection::Insert, &out);
+}
+
+zvec_status_t zvec_collection_upsert_doc_batch_with_status(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed) {
+    DocStatusOut out{out_statuses, out_failed};
+    return write_doc_batch(handle, batch, &Collection::Upsert, &out);
+}
+
+zvec_status_t zvec_collection_update_doc_batch_with_status(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed) {
+    DocStatusOut out{out_statuses, out_failed};
+    return write_doc_batch(handle, batch, &Collection::Update, &out);
+}
+
+zvec_status_t zvec_collection_insert_columnar_with_status(zvec_collection_handle_t handle, const zvec_column_batch_t* batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed) {
+    DocStatusOut out{out_statuses, out_failed};
+    return write_columnar(handle, batch, &Collection::Insert, &out);
+}
+
+zvec_status_t zvec_collection_upsert_columnar_with_status(zvec_collection_handle_t handle, const zvec_column_batch_t* batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed) {
+    DocStatusOut out{out_statuses, out_failed};
+    return write_columnar(handle, batch, &Collection::Upsert, &out);
+}
+
+zvec_status_t zvec_collection_delete_with_status(zvec_collection_handle_t handle, const char** ids, size_t count,
+    zvec_doc_status_t* out_statuses, size_t* out_failed) {
+    DocStatusOut out{out_statuses, out_failed};
+    return delete_ids(handle, ids, count, &out);
+}
+
+const char* zvec_write_status_message(int32_t index) {
+    const auto& messages = write_status_messages();
+    if (index < 0 || static_cast<size_t>(index) >= messages.size()) return nullptr;
+    return messages[index].c_str();
+}
+
+zvec_status_t zvec_collection_delete_by_filter(zvec_collection_handle_t handle, const char* filter) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (!filter) return {2, "null filter"};
     
-    auto status = handle->schema.add_field(field);
-    return to_c_status(status);
+    OpTimer timer(ZVEC_OP_DELETE_BY_FILTER);
+    // Only the background optimizer needs the number of deleted documents.
+    bool count_deletes = handle->auto_optimize;
+    auto before = count_deletes ? engine(handle)->Stats() : Result<CollectionStats>(CollectionStats{});
+    auto status = engine(handle)->DeleteByFilter(std::string(filter));
+    bump_write_epoch(handle);
+    if (count_deletes && before.has_value()) {
+        auto after = engine(handle)->Stats();
+        if (after.has_value() && after.value().doc_count < before.value().doc_count) {
+            handle->pending_deletes += before.value().doc_count - after.value().doc_count;
+        }
+    }
+    if (status.ok() && handle->auto_flush && !handle->bulk_loading) {
+        OpTimer flush_timer(ZVEC_OP_FLUSH);
+        status = engine(handle)->Flush();
+        flush_timer.finish(to_c_status(status));
+    }
+    return timer.finish(to_c_status(status));
 }
 
-zvec_status_t zvec_schema_add_vector_field(zvec_schema_handle_t handle, const zvec_field_def_t* field_def) {
-    if (!handle || !field_def) return {2, "null argument"};
+zvec_status_t zvec_collection_query(zvec_collection_handle_t handle, zvec_query_handle_t query, zvec_result_handle_t* out) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!query) return {2, "null query"};
+    if (!out) return {2, "null out"};
     
-    auto field = create_field_schema(field_def);
-    if (!field) return {2, "invalid field definition"};
+    OpTimer timer(ZVEC_OP_QUERY);
+    std::string key;
+    auto params_status = timed(ZVEC_OP_QUERY_PREPARE, [&] {
+        auto status = prepare_query(handle, query);
+        if (status.code == 0 && handle->query_cache) key = query_cache_key(query);
+        return status;
+    });
+    if (params_status.code != 0) return timer.finish(params_status);
     
-    // Ensure it's a vector type
-    if (!FieldSchema::is_vector_field(field->data_type())) {
-        return {2, "not a vector field type"};
+    bool truncated = false;
+    auto result = timed(ZVEC_OP_QUERY_ENGINE, [&] {
+        return run_cached_query(handle, query->query, query->id_filter, key, &truncated);
+    });
+    if (result.has_value()) {
+        *out = timed(ZVEC_OP_QUERY_MATERIALIZE, [&] { return to_c_result(result.value(), truncated); });
+        return ok_status();
     }
     
-    auto status = handle->schema.add_field(field);
-    return to_c_status(status);
+    return timer.finish(to_c_status(result.error()));
 }
 
-// ===== Schema (from collection) =====
-zvec_schema_handle_t zvec_collection_get_schema(zvec_collection_handle_t handle) {
-    if (!handle || !handle->ptr) return nullptr;
+zvec_status_t zvec_collection_query_batch(
+    zvec_collection_handle_t handle,
+    zvec_query_handle_t query,
+    const float* vectors,
+    size_t query_count,
+    size_t dimension,
+    zvec_result_handle_t* out_results)
+{
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!query) return {2, "null query"};
+    if (!out_results) return {2, "null out"};
+    if (query_count == 0) return ok_status();
+    if (!vectors || dimension == 0) return {2, "null vectors"};
+
+    OpTimer timer(ZVEC_OP_QUERY_BATCH);
+    auto params_status = timed(ZVEC_OP_QUERY_PREPARE, [&] { return prepare_query(handle, query); });
+    if (params_status.code != 0) return timer.finish(params_status);
+
+    // Rows are passed to the engine as float32 bytes, so other element types would be misread
+    auto schema = engine(handle)->Schema();
+    if (!schema.has_value()) return timer.finish(to_c_status(schema.error()));
+    const auto& field_name = query->query.field_name_;
+    auto field = schema.value().get_field_ptr(field_name);
+    if (!field) return timer.finish({2, "unknown query field"});
+    if (field->data_type() != DataType::VECTOR_FP32) {
+        return timer.finish(message_status("query_batch takes float32 vectors; field '" + field_name +
+            "' is not VECTOR_FP32, query it with zvec_collection_query"));
+    }
+    if (field->dimension() != dimension) {
+        return timer.finish(message_status("field '" + field_name + "' has dimension " +
+            std::to_string(field->dimension()) + ", got " + std::to_string(dimension)));
+    }
+
+    std::vector<zvec_result_t*> results(query_count, nullptr);
+    std::vector<Status> errors(query_count);
+    std::atomic<bool> failed{false};
+
+    parallel_for(collection_pool(handle), query_count, [&](size_t i) {
+        if (failed) return;
+        VectorQuery q = query->query;
+        q.query_vector_.assign(
+            reinterpret_cast<const char*>(vectors + i * dimension),
+            dimension * sizeof(float));
+        bool truncated = false;
+        auto result = timed(ZVEC_OP_QUERY_ENGINE, [&] { return engine_query(handle, q, query->id_filter, &truncated); });
+        if (result.has_value()) {
+            results[i] = timed(ZVEC_OP_QUERY_MATERIALIZE, [&] { return to_c_result(result.value(), truncated); });
+        } else {
+            errors[i] = result.error();
+            failed = true;
+        }
+    });
+
+    if (failed) {
+        for (auto* res : results) delete res;
+        std::fill(out_results, out_results + query_count, nullptr);
+        for (const auto& e : errors) {
+            if (!e.ok()) return timer.finish(to_c_status(e));
+        }
+    }
+
+    std::copy(results.begin(), results.end(), out_results);
+    return ok_status();
+}
+
+zvec_status_t zvec_collection_query_multi(
+    zvec_collection_handle_t handle,
+    const zvec_query_handle_t* queries,
+    size_t query_count,
+    const zvec_fusion_t* fusion,
+    zvec_result_handle_t* out)
+{
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!queries || query_count == 0) return {2, "null queries"};
+    if (!fusion) return {2, "null fusion"};
+    if (!out) return {2, "null out"};
+    if (fusion->method == ZVEC_FUSION_WEIGHTED && !fusion->weights) return {2, "null weights"};
+    if (fusion->method == ZVEC_FUSION_WEIGHTED && fusion->weight_count != query_count) {
+        return {2, "weight_count must equal query_count"};
+    }
+    if (fusion->method == ZVEC_FUSION_RRF && fusion->rrf_k <= 0) return {2, "rrf_k must be positive"};
+    if (fusion->method != ZVEC_FUSION_RRF && fusion->method != ZVEC_FUSION_WEIGHTED) {
+        return {2, "unsupported fusion method"};
+    }
+
+    OpTimer timer(ZVEC_OP_QUERY_MULTI);
+    std::vector<MetricType> metrics(query_count, MetricType::UNDEFINED);
+    if (fusion->method == ZVEC_FUSION_WEIGHTED) {
+        auto schema = engine(handle)->Schema();
+        if (!schema.has_value()) return timer.finish(to_c_status(schema.error()));
+        for (size_t q = 0; q < query_count; q++) {
+            if (!queries[q]) return {2, "null query"};
+            metrics[q] = field_metric(schema.value(), queries[q]->query.field_name_);
+        }
+    }
+
+    for (size_t q = 0; q < query_count; q++) {
+        if (!queries[q]) return {2, "null query"};
+        auto params_status = timed(ZVEC_OP_QUERY_PREPARE, [&] { return prepare_query(handle, queries[q]); });
+        if (params_status.code != 0) return timer.finish(params_status);
+    }
+
+    std::vector<DocPtrList> lists(query_count);
+    std::vector<Status> errors(query_count);
+    std::atomic<bool> failed{false};
+    std::atomic<bool> truncated{false};
+
+    parallel_for(collection_pool(handle), query_count, [&](size_t q) {
+        if (failed) return;
+        bool cut = false;
+        auto result = timed(ZVEC_OP_QUERY_ENGINE, [&] {
+            return engine_query(handle, queries[q]->query, queries[q]->id_filter, &cut);
+        });
+        if (cut) truncated = true;
+        if (result.has_value()) {
+            lists[q] = std::move(result.value());
+        } else {
+            errors[q] = result.error();
+            failed = true;
+        }
+    });
+
+    if (failed) {
+        for (const auto& e : errors) {
+            if (!e.ok()) return timer.finish(to_c_status(e));
+        }
+    }
+
+    *out = timed(ZVEC_OP_QUERY_MATERIALIZE, [&] { return to_c_result(fuse_hits(lists, metrics, *fusion), truncated); });
+    return ok_status();
+}
+
+zvec_status_t zvec_collection_fetch(zvec_collection_handle_t handle, const char** ids, size_t count, zvec_result_handle_t* out) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!out) return {2, "null out"};
+    
+    OpTimer timer(ZVEC_OP_FETCH);
+    std::vector<std::string> pks;
+    if (ids && count > 0) {
+        pks.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            pks.push_back(std::string(ids[i]));
+        }
+    }
     
-    auto result = handle->ptr->Schema();
+    auto result = engine(handle)->Fetch(pks);
     if (result.has_value()) {
-        auto* schema = new zvec_schema_t();
-        schema->schema = result.value();
-        return schema;
+        auto* res = new zvec_result_t();
+        for (const auto& entry : result.value()) {
+            if (entry.second) res->hits.push_back(entry.second);
+        }
+        *out = res;
+        return ok_status();
     }
-    return nullptr;
+    
+    return timer.finish(to_c_status(result.error()));
 }
 
-const char* zvec_schema_get_name(zvec_schema_handle_t handle) {
-    if (!handle) return nullptr;
-    handle->name_cache = handle->schema.name();
-    return handle->name_cache.c_str();
+zvec_status_t zvec_collection_get_query_cache_stats(zvec_collection_handle_t handle, zvec_query_cache_stats_t* out_stats) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!out_stats) return {2, "null out_stats"};
+
+    *out_stats = handle->query_cache ? handle->query_cache->stats() : zvec_query_cache_stats_t{};
+    return ok_status();
 }
 
-size_t zvec_schema_get_field_count(zvec_schema_handle_t handle) {
-    if (!handle) return 0;
-    return handle->schema.fields().size();
+// ===== Prepared Queries =====
+zvec_status_t zvec_collection_prepare_query(
+    zvec_collection_handle_t handle,
+    zvec_query_handle_t query,
+    zvec_prepared_query_handle_t* out)
+{
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!query) return {2, "null query"};
+    if (!out) return {2, "null out"};
+    if (!query->query.query_sparse_indices_.empty()) return {2, "prepared queries take dense vectors"};
+
+    auto status = timed(ZVEC_OP_QUERY_PREPARE, [&] { return prepare_query(handle, query); });
+    if (status.code != 0) return status;
+
+    auto prepared = std::make_unique<zvec_prepared_query_t>();
+    prepared->col = handle;
+    prepared->query = query->query;
+    prepared->query.query_vector_.clear();
+    prepared->id_filter = query->id_filter;
+    if (handle->query_cache) {
+        // Marked so a prefix plus vector can never equal a plain query's key
+        zvec_query_t shape = *query;
+        shape.query.query_vector_.clear();
+        prepared->key_prefix = "P" + query_cache_key(&shape);
+    }
+
+    *out = prepared.release();
+    return ok_status();
 }
 
-size_t zvec_schema_get_vector_count(zvec_schema_handle_t handle) {
-    if (!handle) return 0;
-    return handle->schema.vector_fields().size();
+void zvec_prepared_query_destroy(zvec_prepared_query_handle_t prepared) {
+    delete prepared;
 }
 
-zvec_field_def_t zvec_schema_get_field(zvec_schema_handle_t handle, size_t index) {
-    zvec_field_def_t def = {nullptr, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-    if (!handle) return def;
-    
-    auto fields = handle->schema.fields();
-    if (index >= fields.size()) return def;
-    
-    const auto& field = fields[index];
-    def.name = field->name().c_str();
-    def.data_type = static_cast<int32_t>(field->data_type());
-    def.dimension = field->dimension();
-    def.nullable = field->nullable() ? 1 : 0;
-    def.index_type = static_cast<int32_t>(field->index_type());
-    
-    return def;
+zvec_status_t zvec_prepared_query_execute(
+    zvec_prepared_query_handle_t prepared,
+    const float* vector,
+    size_t len,
+    zvec_result_handle_t* out)
+{
+    if (!prepared || !prepared->col || !engine(prepared->col)) return {2, "null handle"};
+    if (!vector || len == 0) return {2, "null vector"};
+    if (!out) return {2, "null out"};
+
+    auto* col = prepared->col;
+    OpTimer timer(ZVEC_OP_PREPARED_EXECUTE);
+    auto query = prepared->acquire();
+    std::string key;
+    timed(ZVEC_OP_QUERY_PREPARE, [&] {
+        query->query_vector_.assign(reinterpret_cast<const char*>(vector), len * sizeof(float));
+        if (!prepared->key_prefix.empty()) key = prepared->key_prefix + query->query_vector_;
+        return ok_status();
+    });
+
+    bool truncated = false;
+    auto result = timed(ZVEC_OP_QUERY_ENGINE, [&] {
+        return run_cached_query(col, *query, prepared->id_filter, key, &truncated);
+    });
+    prepared->release(std::move(query));
+    if (result.has_value()) {
+        *out = timed(ZVEC_OP_QUERY_MATERIALIZE, [&] { return to_c_result(result.value(), truncated); });
+        return ok_status();
+    }
+
+    return timer.finish(to_c_status(result.error()));
 }
 
-zvec_field_def_t zvec_schema_get_vector(zvec_schema_handle_t handle, size_t index) {
-    zvec_field_def_t def = {nullptr, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-    if (!handle) return def;
-    
-    auto vectors = handle->schema.vector_fields();
-    if (index >= vectors.size()) return def;
-    
-    const auto& field = vectors[index];
-    def.name = field->name().c_str();
-    def.data_type = static_cast<int32_t>(field->data_type());
-    def.dimension = field->dimension();
-    def.nullable = field->nullable() ? 1 : 0;
-    def.index_type = static_cast<int32_t>(field->index_type());
-    
-    // Get metric type from index params if available
-    if (field->index_params()) {
-        auto* vec_params = dynamic_cast<const VectorIndexParams*>(field->index_params().get());
-        if (vec_params) {
-            def.metric_type = static_cast<int32_t>(vec_params->metric_type());
-            def.quantize_type = static_cast<int32_t>(vec_params->quantize_type());
+// ===== Query Tuning =====
+zvec_status_t zvec_collection_tune(
+    zvec_collection_handle_t handle,
+    const zvec_tune_request_t* request,
+    zvec_tune_point_t* out_points,
+    size_t point_capacity,
+    zvec_tune_report_t* out_report)
+{
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!request || !request->field_name) return {2, "null request"};
+    if (!request->queries || request->query_count == 0 || request->dimension == 0) return {2, "null queries"};
+    if (!out_report) return {2, "null out_report"};
+    if (point_capacity > 0 && !out_points) return {2, "null out_points"};
+    if (request->topk <= 0) return {2, "topk must be positive"};
+    if (!(request->target_recall > 0 && request->target_recall <= 1)) return {2, "target_recall must be in (0, 1]"};
+    OpTimer timer(ZVEC_OP_TUNE);
+
+    auto schema = engine(handle)->Schema();
+    if (!schema.has_value()) return timer.finish(to_c_status(schema.error()));
+    auto field = schema.value().get_field_ptr(request->field_name);
+    if (!field || !FieldSchema::is_vector_field(field->data_type())) return timer.finish({2, "unknown vector field"});
+    const IndexType type = field->index_type();
+    if (type != IndexType::HNSW && type != IndexType::IVF) {
+        return timer.finish({2, "only HNSW and IVF indexes have a tunable query parameter"});
+    }
+
+    std::vector<int32_t> candidates;
+    if (request->candidates) {
+        candidates.assign(request->candidates, request->candidates + request->candidate_count);
+    } else if (type == IndexType::HNSW) {
+        candidates = {16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512};
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+            [&](int32_t ef) { return ef < request->topk; }), candidates.end());
+        candidates.insert(candidates.begin(), request->topk);
+    } else {
+        candidates = {1, 2, 4, 8, 12, 16, 24, 32, 48, 64, 96, 128, 256};
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    if (candidates.empty() || candidates.front() <= 0) return timer.finish({2, "candidates must be positive"});
+
+    const size_t count = request->query_count;
+    const size_t dimension = request->dimension;
+    VectorQuery base;
+    base.field_name_ = request->field_name;
+    base.topk_ = request->topk;
+    if (request->filter) base.filter_ = request->filter;
+    base.output_fields_ = std::vector<std::string>{};
+    auto query_at = [&](size_t i, const QueryParams::Ptr& params) {
+        VectorQuery q = base;
+        q.query_vector_.assign(
+            reinterpret_cast<const char*>(request->queries + i * dimension), dimension * sizeof(float));
+        q.query_params_ = params;
+        return q;
+    };
+
+    // Exact top-k of every sample query, from a linear scan
+    zvec_query_params_t linear{};
+    linear.is_linear = 1;
+    const auto linear_params = make_query_params(type, linear);
+    std::vector<std::unordered_set<std::string>> truth(count);
+    std::vector<Status> errors(count);
+    std::atomic<bool> failed{false};
+    parallel_for(collection_pool(handle), count, [&](size_t i) {
+        if (failed) return;
+        auto result = engine(handle)->Query(query_at(i, linear_params));
+        if (!result.has_value()) {
+            errors[i] = result.error();
+            failed = true;
+            return;
+        }
+        for (const auto& doc : result.value()) {
+            if (doc) truth[i].insert(doc->pk());
+        }
+    });
+    if (failed) {
+        for (const auto& e : errors) {
+            if (!e.ok()) return timer.finish(to_c_status(e));
+        }
+    }
+
+    std::vector<zvec_tune_point_t> points;
+    std::vector<uint64_t> latencies(count);
+    for (size_t c = 0; c < candidates.size(); c++) {
+        zvec_query_params_t p{};
+        p.index_type = static_cast<int32_t>(type);
+        (type == IndexType::HNSW ? p.ef : p.n_probe) = candidates[c];
+        const auto params = make_query_params(type, p);
+
+        // The first value also warms the index; that pass is not timed
+        for (int pass = c == 0 ? 0 : 1; pass < 2; pass++) {
+            double recall_sum = 0;
+            size_t recall_count = 0;
+            for (size_t i = 0; i < count; i++) {
+                VectorQuery q = query_at(i, params);
+                auto start = std::chrono::steady_clock::now();
+                auto result = engine(handle)->Query(q);
+                latencies[i] = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count());
+                if (!result.has_value()) return timer.finish(to_c_status(result.error()));
+                if (truth[i].empty()) continue;
+
+                size_t found = 0;
+                for (const auto& doc : result.value()) {
+                    if (doc) found += truth[i].count(doc->pk());
+                }
+                recall_sum += static_cast<double>(found) / static_cast<double>(truth[i].size());
+                recall_count++;
+            }
+            if (pass == 0) continue;
+
+            zvec_tune_point_t point{};
+            point.value = candidates[c];
+            point.recall = recall_count > 0 ? recall_sum / static_cast<double>(recall_count) : 1.0;
+            uint64_t total = 0;
+            for (uint64_t ns : latencies) total += ns;
+            point.mean_latency_us = static_cast<double>(total) / static_cast<double>(count) / 1000.0;
+            std::vector<uint64_t> sorted = latencies;
+            const size_t p99 = std::min(count - 1, static_cast<size_t>(std::ceil(0.99 * count)) - 1);
+            std::nth_element(sorted.begin(), sorted.begin() + p99, sorted.end());
+            point.p99_latency_us = static_cast<double>(sorted[p99]) / 1000.0;
+            points.push_back(point);
         }
-        auto* hnsw_params = dynamic_cast<const HnswIndexParams*>(field->index_params().get());
-        if (hnsw_params) {
-            def.m = hnsw_params->m();
-            def.ef_construction = hnsw_params->ef_construction();
+    }
+
+    // Pareto front: walking from cheapest to dearest, keep points that raise the best recall
+    std::vector<size_t> by_latency(points.size());
+    for (size_t i = 0; i < by_latency.size(); i++) by_latency[i] = i;
+    std::sort(by_latency.begin(), by_latency.end(), [&](size_t a, size_t b) {
+        return points[a].mean_latency_us < points[b].mean_latency_us;
+    });
+    double best_recall = -1;
+    for (size_t i : by_latency) {
+        points[i].pareto = points[i].recall > best_recall ? 1 : 0;
+        best_recall = std::max(best_recall, points[i].recall);
+    }
+
+    // Search cost grows with ef / n_probe, so the smallest value reaching the target is the
+    // cheapest; this is steadier than comparing latencies that differ only by noise.
+    const zvec_tune_point_t* pick = nullptr;
+    for (const auto& point : points) {
+        if (point.recall >= request->target_recall) {
+            pick = &point;
+            break;
         }
-        auto* ivf_params = dynamic_cast<const IVFIndexParams*>(field->index_params().get());
-        if (ivf_params) {
-            def.n_lists = ivf_params->n_list();
+    }
+    const bool met = pick != nullptr;
+    if (!met) {
+        for (const auto& point : points) {
+            if (!pick || point.recall > pick->recall) pick = &point;
         }
     }
+
+    if (request->apply) {
+        zvec_query_params_t defaults{};
+        defaults.index_type = static_cast<int32_t>(type);
+        (type == IndexType::HNSW ? defaults.ef : defaults.n_probe) = pick->value;
+        set_query_defaults(handle, request->field_name, &defaults);
+    }
+
+    std::copy_n(points.begin(), std::min(point_capacity, points.size()), out_points);
+    out_report->index_type = static_cast<int32_t>(type);
+    out_report->recommended = pick->value;
+    out_report->target_met = met ? 1 : 0;
+    out_report->point_count = points.size();
+    return timer.finish(ok_status());
+}
+
+zvec_status_t zvec_collection_set_query_defaults(
+    zvec_collection_handle_t handle,
+    const char* field_name,
+    const zvec_query_params_t* params)
+{
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!field_name) return {2, "null field_name"};
+
+    set_query_defaults(handle, field_name, params);
+    return ok_status();
+}
+
+// ===== Background Optimize =====
+zvec_status_t zvec_collection_start_auto_optimize(zvec_collection_handle_t handle, const zvec_optimize_policy_t* policy) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (!policy) return {2, "null policy"};
+    if (policy->deleted_ratio < 0 || policy->budget_percent < 0 || policy->concurrency < 0) {
+        return {2, "invalid policy"};
+    }
+
+    std::lock_guard<std::mutex> lock(handle->optimizer_mutex);
+    if (handle->optimizer) return {2, "auto optimize already running"};
+
+    auto opt = std::make_unique<AutoOptimizer>();
+    opt->policy = *policy;
+    opt->thread = std::thread(auto_optimize_loop, handle, opt.get());
+    handle->optimizer = std::move(opt);
+    handle->auto_optimize = true;
+    return ok_status();
+}
+
+zvec_status_t zvec_collection_stop_auto_optimize(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    stop_auto_optimize(handle);
+    return ok_status();
+}
+
+zvec_status_t zvec_collection_pause_auto_optimize(zvec_collection_handle_t handle) {
+    return set_auto_optimize_paused(handle, true);
+}
+
+zvec_status_t zvec_collection_resume_auto_optimize(zvec_collection_handle_t handle) {
+    return set_auto_optimize_paused(handle, false);
+}
+
+zvec_status_t zvec_collection_get_auto_optimize_status(zvec_collection_handle_t handle, zvec_optimize_status_t* out_status) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!out_status) return {2, "null out_status"};
+
+    *out_status = zvec_optimize_status_t{};
+    out_status->pending_writes = handle->pending_writes.load();
+    out_status->pending_deletes = handle->pending_deletes.load();
+
+    std::lock_guard<std::mutex> lock(handle->optimizer_mutex);
+    if (!handle->optimizer) return ok_status();
+
+    auto& opt = *handle->optimizer;
+    std::lock_guard<std::mutex> opt_lock(opt.mutex);
+    out_status->state = opt.running ? ZVEC_AUTO_OPTIMIZE_RUNNING
+        : opt.paused ? ZVEC_AUTO_OPTIMIZE_PAUSED
+        : ZVEC_AUTO_OPTIMIZE_IDLE;
+    out_status->last_status_code = opt.last_status_code;
+    out_status->runs = opt.runs;
+    out_status->failures = opt.failures;
+    out_status->last_duration_ms = opt.last_duration_ms;
+    return ok_status();
+}
+
+const char* zvec_collection_get_path(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return nullptr;
     
-    return def;
+    auto result = engine(handle)->Path();
+    if (result.has_value()) {
+        handle->path_cache = result.value();
+        return handle->path_cache.c_str();
+    }
+    return nullptr;
+}
+
+// ===== Warmup =====
+// Helper: read up to limit bytes of a file front to back; false once cancelled
+static bool read_through(zvec_collection_t* col, const std::string& path, uint64_t limit) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return true;  // removed by a concurrent optimize; nothing to warm
+    std::vector<char> block(1 << 20);
+    uint64_t done = 0;
+    bool cancelled = false;
+    while (done < limit) {
+        if (col->warmup_cancelled.load(std::memory_order_relaxed)) {
+            cancelled = true;
+            break;
+        }
+        size_t want = static_cast<size_t>(std::min<uint64_t>(block.size(), limit - done));
+        size_t got = std::fread(block.data(), 1, want, file);
+        if (got == 0) break;
+        done += got;
+        col->warmup.bytes_loaded.fetch_add(got, std::memory_order_relaxed);
+    }
+    std::fclose(file);
+    return !cancelled;
+}
+
+// Helper: one warmup under the handle's warmup lock; a cancel seen at any point ends it
+static zvec_status_t run_warmup(zvec_collection_t* handle, const zvec_warmup_options_t& opts,
+    zvec_warmup_progress_t* out_progress) {
+    namespace fs = std::filesystem;
+    auto col = engine(handle);
+    auto path = col->Path();
+    if (!path.has_value()) return to_c_status(path.error());
+
+    // The engine does not say which files hold which field, so every file is read;
+    // path order keeps a budgeted warmup deterministic.
+    struct File {
+        std::string path;
+        uint64_t size;
+    };
+    std::vector<File> files;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(fs::path(path.value()), ec), end; !ec && it != end; it.increment(ec)) {
+        std::error_code file_ec;
+        if (!it->is_regular_file(file_ec)) continue;
+        uint64_t size = it->file_size(file_ec);
+        if (file_ec || size == 0) continue;
+        files.push_back({it->path().string(), size});
+    }
+    if (ec) return {6, "cannot list collection files"};
+    std::sort(files.begin(), files.end(), [](const File& a, const File& b) { return a.path < b.path; });
+
+    // Trim to the budget; the last file kept may be read only in part
+    uint64_t budget = opts.byte_budget > 0 ? opts.byte_budget : UINT64_MAX;
+    uint64_t bytes_total = 0;
+    size_t kept = 0;
+    for (; kept < files.size() && bytes_total < budget; kept++) {
+        files[kept].size = std::min(files[kept].size, budget - bytes_total);
+        bytes_total += files[kept].size;
+    }
+    files.resize(kept);
+
+    auto& progress = handle->warmup;
+    progress.files_total = files.size();
+    progress.files_loaded = 0;
+    progress.bytes_total = bytes_total;
+    progress.bytes_loaded = 0;
+    progress.queries_total = opts.query_count;
+    progress.queries_run = 0;
+    progress.running = true;
+
+    parallel_for(collection_pool(handle), files.size(), [&](size_t i) {
+        if (read_through(handle, files[i].path, files[i].size)) progress.files_loaded++;
+    });
+
+    if (opts.query_count > 0 && !handle->warmup_cancelled) {
+        VectorQuery base;
+        base.field_name_ = opts.query_field;
+        base.topk_ = opts.topk > 0 ? opts.topk : 10;
+        parallel_for(collection_pool(handle), opts.query_count, [&](size_t i) {
+            if (handle->warmup_cancelled.load(std::memory_order_relaxed)) return;
+            VectorQuery q = base;
+            q.query_vector_.assign(
+                reinterpret_cast<const char*>(opts.queries + i * opts.dimension),
+                opts.dimension * sizeof(float));
+            if (col->Query(q).has_value()) progress.queries_run++;
+        });
+    }
+
+    progress.running = false;
+    if (out_progress) *out_progress = progress.snapshot();
+    if (handle->warmup_cancelled) return {ZVEC_STATUS_CANCELLED, "warmup cancelled"};
+    return ok_status();
+}
+
+zvec_status_t zvec_collection_warmup(
+    zvec_collection_handle_t handle,
+    const zvec_warmup_options_t* options,
+    zvec_warmup_progress_t* out_progress)
+{
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    zvec_warmup_options_t opts = options ? *options : zvec_warmup_options_t{};
+    if (opts.query_count > 0 && (!opts.queries || opts.dimension == 0 || !opts.query_field)) {
+        return {2, "null queries"};
+    }
+
+    std::unique_lock<std::mutex> lock(handle->warmup_mutex, std::try_to_lock);
+    if (!lock.owns_lock()) return {2, "warmup already running"};
+    OpTimer timer(ZVEC_OP_WARMUP);
+    auto status = run_warmup(handle, opts, out_progress);
+    // Consumed here rather than reset at the start, so a cancel issued just before
+    // this warmup took the lock still stops it.
+    handle->warmup_cancelled = false;
+    return timer.finish(status);
 }
 
-// ===== Query =====
-zvec_query_handle_t zvec_query_create() {
-    return new zvec_query_t();
+zvec_status_t zvec_collection_get_warmup_progress(zvec_collection_handle_t handle, zvec_warmup_progress_t* out) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!out) return {2, "null out"};
+    *out = handle->warmup.snapshot();
+    return ok_status();
 }
 
-void zvec_query_destroy(zvec_query_handle_t handle) {
-    delete handle;
+zvec_status_t zvec_collection_cancel_warmup(zvec_collection_handle_t handle) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    handle->warmup_cancelled = true;
+    return ok_status();
 }
 
-void zvec_query_set_topk(zvec_query_handle_t handle, int32_t topk) {
-    if (handle) handle->query.topk_ = topk;
+// ===== Import =====
+// Helper: the ZVEC_IMPORT_* format named by the file extension, or AUTO if unknown
+static int32_t import_format_from_extension(const std::string& path) {
+    std::string ext = std::filesystem::path(path).extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+    if (ext == ".fvecs") return ZVEC_IMPORT_FVECS;
+    if (ext == ".bvecs") return ZVEC_IMPORT_BVECS;
+    if (ext == ".npy") return ZVEC_IMPORT_NPY;
+    if (ext == ".parquet" || ext == ".pq") return ZVEC_IMPORT_PARQUET;
+    if (ext == ".arrow" || ext == ".arrows" || ext == ".ipc" || ext == ".feather") return ZVEC_IMPORT_ARROW_IPC;
+    return ZVEC_IMPORT_AUTO;
 }
 
-void zvec_query_set_field_name(zvec_query_handle_t handle, const char* field_name) {
-    if (handle && field_name) {
-        handle->field_name_cache = field_name;
-        handle->query.field_name_ = handle->field_name_cache;
+// Helper: open the reader for format; error explains a failure
+static std::unique_ptr<ImportReader> open_import_reader(const std::string& path, int32_t format,
+    const zvec_import_mapping_t& mapping, size_t chunk_rows, std::string& error) {
+    if (format == ZVEC_IMPORT_PARQUET || format == ZVEC_IMPORT_ARROW_IPC) {
+#ifdef ZVEC_C_WITH_ARROW
+        auto reader = std::make_unique<ArrowReader>(mapping);
+        bool opened = format == ZVEC_IMPORT_PARQUET
+            ? reader->open_parquet(path, chunk_rows, error)
+            : reader->open_ipc(path, error);
+        if (!opened) return nullptr;
+        return reader;
+#else
+        (void)chunk_rows;
+        error = "Parquet and Arrow IPC import need a build with ZVEC_C_WITH_ARROW";
+        return nullptr;
+#endif
+    }
+    if (format != ZVEC_IMPORT_FVECS && format != ZVEC_IMPORT_BVECS && format != ZVEC_IMPORT_NPY) {
+        error = "unknown import format";
+        return nullptr;
+    }
+    if (mapping.pk_column || mapping.scalar_column_count > 0) {
+        error = "pk_column and scalar_columns need a Parquet or Arrow IPC file";
+        return nullptr;
     }
-}
 
-void zvec_query_set_vector(zvec_query_handle_t handle, const float* data, size_t len) {
-    if (handle && data) {
-        handle->vector_cache.assign(data, data + len);
-        // Convert float vector to string for zvec
-        handle->query.query_vector_.assign(
-            reinterpret_cast<const char*>(handle->vector_cache.data()),
-            len * sizeof(float)
-        );
+    ImportFile file(std::fopen(path.c_str(), "rb"), &std::fclose);
+    if (!file) {
+        error = "cannot open " + path;
+        return nullptr;
+    }
+    if (format == ZVEC_IMPORT_NPY) {
+        auto reader = std::make_unique<NpyReader>(std::move(file), mapping.vector_field);
+        if (!reader->open(error)) return nullptr;
+        return reader;
     }
+    auto reader = std::make_unique<VecsReader>(std::move(file), mapping.vector_field, format == ZVEC_IMPORT_BVECS);
+    if (!reader->open(error)) return nullptr;
+    return reader;
 }
 
-void zvec_query_set_filter(zvec_query_handle_t handle, const char* filter) {
-    if (handle && filter) {
-        handle->filter_cache = filter;
-        handle->query.filter_ = handle->filter_cache;
+// Helper: keys prefix + row number for a chunk whose file has no key column
+static void generate_import_pks(ImportChunk& chunk, const std::string& prefix, uint64_t first) {
+    chunk.pk_offsets.assign(1, 0);
+    chunk.pk_offsets.reserve(chunk.rows + 1);
+    chunk.pk_data.reserve(chunk.rows * (prefix.size() + 8));
+    for (size_t i = 0; i < chunk.rows; i++) {
+        auto pk = prefix + std::to_string(first + i);
+        chunk.pk_data.insert(chunk.pk_data.end(), pk.begin(), pk.end());
+        chunk.pk_offsets.push_back(static_cast<int32_t>(chunk.pk_data.size()));
     }
 }
 
-void zvec_query_set_include_vector(zvec_query_handle_t handle, int include) {
-    if (handle) handle->query.include_vector_ = include != 0;
-}
+zvec_status_t zvec_collection_import(
+    zvec_collection_handle_t handle,
+    const char* path,
+    int32_t format,
+    const zvec_import_mapping_t* mapping,
+    const zvec_import_options_t* options,
+    zvec_import_report_t* out_report) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (!path) return {2, "null path"};
+    if (!mapping || !mapping->vector_field) return {2, "null vector_field"};
+    if (mapping->scalar_column_count > 0 && !mapping->scalar_columns) return {2, "null scalar_columns"};
+    if (out_report) *out_report = {};
+    OpTimer import_timer(ZVEC_OP_IMPORT);
 
-void zvec_query_set_output_fields(zvec_query_handle_t handle, const char** fields, size_t count) {
-    if (handle && fields) {
-        handle->output_fields_cache.clear();
-        handle->output_fields_ptrs.clear();
-        for (size_t i = 0; i < count; i++) {
-            handle->output_fields_cache.push_back(fields[i]);
+    const size_t chunk_rows = options && options->chunk_rows > 0 ? options->chunk_rows : kImportChunkRows;
+    const uint64_t max_rows = options ? options->max_rows : 0;
+    auto write = options && options->upsert ? &Collection::Upsert : &Collection::Insert;
+    if (format == ZVEC_IMPORT_AUTO) {
+        format = import_format_from_extension(path);
+        if (format == ZVEC_IMPORT_AUTO) return import_timer.finish({2, "cannot tell the import format from the file extension"});
+    }
+
+    std::string error;
+    auto reader = open_import_reader(path, format, *mapping, chunk_rows, error);
+    if (!reader) return import_timer.finish(message_status(error));
+
+    const std::string prefix = mapping->pk_prefix ? mapping->pk_prefix : "";
+    const auto start = std::chrono::steady_clock::now();
+    zvec_import_report_t report{};
+    thread_local std::string first_error;
+    first_error.clear();
+
+    // The next chunk is read while the current one is converted and written.
+    auto read_ahead = [&](uint64_t rows_read) {
+        size_t limit = chunk_rows;
+        if (max_rows > 0) limit = static_cast<size_t>(std::min<uint64_t>(limit, max_rows - rows_read));
+        return std::async(std::launch::async, [&reader, limit] {
+            auto chunk = std::make_unique<ImportChunk>();
+            if (limit > 0 && !reader->read(limit, *chunk)) chunk->rows = 0;
+            return chunk;
+        });
+    };
+
+    zvec_status_t status = ok_status();
+    auto pending = read_ahead(0);
+    while (true) {
+        auto chunk = pending.get();
+        if (!chunk->error.empty()) {
+            status = message_status(chunk->error);
+            break;
+        }
+        if (chunk->rows == 0) break;
+
+        if (!chunk->has_pks) generate_import_pks(*chunk, prefix, mapping->pk_start + report.rows_read);
+        report.rows_read += chunk->rows;
+        report.chunks++;
+        pending = read_ahead(report.rows_read);
+
+        OpTimer timer(write_op(write));
+        zvec_column_batch_t batch{chunk->rows, chunk->pk_data.data(), chunk->pk_data.size(),
+            chunk->pk_offsets.data(), chunk->columns.data(), chunk->columns.size()};
+        std::vector<Doc> docs;
+        status = timed(ZVEC_OP_WRITE_CONVERT, [&] { return build_columnar_docs(collection_pool(handle), &batch, docs); });
+        if (status.code != 0) {
+            timer.finish(status);
+            break;
+        }
+
+        auto result = timed(ZVEC_OP_WRITE_ENGINE, [&] { return ((*engine(handle)).*write)(docs); });
+        handle->pending_writes += docs.size();
+        bump_write_epoch(handle);
+        if (!result.has_value()) {
+            status = timer.finish(to_c_status(result.error()));
+            break;
+        }
+        timer.finish(ok_status());
+        for (const auto& s : result.value()) {
+            if (s.ok()) {
+                report.rows_written++;
+                continue;
+            }
+            if (report.rows_failed++ == 0) {
+                report.first_error_code = static_cast<int32_t>(s.code());
+                first_error = s.c_str();
+            }
         }
-        handle->query.output_fields_ = handle->output_fields_cache;
     }
-}
+    // An early stop leaves the read-ahead running; wait for it before the reader goes away.
+    if (pending.valid()) pending.wait();
 
-void zvec_query_set_ef_search(zvec_query_handle_t handle, int32_t ef) {
-    if (handle && handle->query.query_params_) {
-        auto* hnsw = dynamic_cast<HnswQueryParams*>(handle->query.query_params_.get());
-        if (hnsw) hnsw->set_ef(ef);
+    if (report.rows_written > 0 && handle->auto_flush && !handle->bulk_loading) {
+        OpTimer timer(ZVEC_OP_FLUSH);
+        auto flushed = timer.finish(to_c_status(engine(handle)->Flush()));
+        if (status.code == 0) status = flushed;
     }
-}
 
-void zvec_query_set_n_probe(zvec_query_handle_t handle, int32_t n_probe) {
-    if (handle && handle->query.query_params_) {
-        auto* ivf = dynamic_cast<IVFQueryParams*>(handle->query.query_params_.get());
-        if (ivf) ivf->set_nprobe(n_probe);
+    if (out_report) {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        report.elapsed_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+        const double seconds = std::chrono::duration<double>(elapsed).count();
+        report.rows_per_second = seconds > 0 ? report.rows_written / seconds : 0;
+        report.first_error_message = report.rows_failed > 0 ? first_error.c_str() : nullptr;
+        *out_report = report;
     }
+    return import_timer.finish(status);
 }
 
-// ===== Collection =====
-zvec_status_t zvec_collection_create_and_open(
+// ===== Export =====
+zvec_status_t zvec_collection_export(
+    zvec_collection_handle_t handle,
     const char* path,
-    zvec_schema_handle_t schema,
-    const zvec_collection_options_t* options,
-    zvec_collection_handle_t* out)
-{
-    if (!path || !out) {
-        return {2, "null argument"};
+    int32_t format,
+    const zvec_export_options_t* options,
+    zvec_export_report_t* out_report) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!path) return {2, "null path"};
+    if (options && options->field_count > 0 && !options->fields) return {2, "null fields"};
+    if (options && options->concurrency < 0) return {2, "concurrency must not be negative"};
+    if (out_report) *out_report = {};
+
+    if (format == ZVEC_EXPORT_AUTO) format = import_format_from_extension(path);
+    if (format != ZVEC_EXPORT_PARQUET && format != ZVEC_EXPORT_ARROW_IPC) {
+        return {2, "export writes Parquet (.parquet, .pq) or Arrow IPC (.arrow, .arrows, .ipc, .feather) files"};
     }
-    if (!schema) {
-        return {2, "null schema"};
+#ifdef ZVEC_C_WITH_ARROW
+    OpTimer timer(ZVEC_OP_EXPORT);
+    const auto start = std::chrono::steady_clock::now();
+    zvec_export_report_t report{};
+    auto error = run_export(engine(handle), path, format, options ? *options : zvec_export_options_t{}, report);
+    if (!error.empty()) {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+        return timer.finish(message_status(error));
     }
-    
-    (void)options;  // CollectionOptions has different fields in zvec
-    
-    auto result = Collection::CreateAndOpen(std::string(path), schema->schema, CollectionOptions{});
-    
-    if (result.has_value()) {
-        auto* col = new zvec_collection_t();
-        col->ptr = result.value();
-        col->path_cache = path;
-        *out = col;
-        return ok_status();
+
+    if (out_report) {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        report.elapsed_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+        const double seconds = std::chrono::duration<double>(elapsed).count();
+        report.rows_per_second = seconds > 0 ? report.rows / seconds : 0;
+        *out_report = report;
     }
-    
-    return to_c_status(result.error());
+    return timer.finish(ok_status());
+#else
+    return {2, "export needs a build with ZVEC_C_WITH_ARROW"};
+#endif
 }
 
-zvec_status_t zvec_collection_open(
-    const char* path,
-    const zvec_collection_options_t* options,
-    zvec_collection_handle_t* out)
-{
-    if (!path || !out) {
-        return {2, "null argument"};
-    }
-    
-    (void)options;  // CollectionOptions has different fields in zvec
-    
-    auto result = Collection::Open(std::string(path), CollectionOptions{});
-    
-    if (result.has_value()) {
-        auto* col = new zvec_collection_t();
-        col->ptr = result.value();
-        col->path_cache = path;
-        *out = col;
-        return ok_status();
-    }
-    
-    return to_c_status(result.error());
+// ===== Async =====
+zvec_status_t zvec_collection_query_async(zvec_collection_handle_t handle, zvec_query_handle_t query,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!query) return {2, "null query"};
+    if (!callback) return {2, "null callback"};
+
+    std::string key;
+    auto params_status = timed(ZVEC_OP_QUERY_PREPARE, [&] {
+        auto status = prepare_query(handle, query);
+        if (status.code == 0 && handle->query_cache) key = query_cache_key(query);
+        return status;
+    });
+    if (params_status.code != 0) return params_status;
+
+    submit_async(handle, out_op, callback, user_data,
+        [handle, q = query->query, filter = query->id_filter, key = std::move(key)](zvec_result_t** out) -> zvec_status_t {
+            OpTimer timer(ZVEC_OP_QUERY);
+            bool truncated = false;
+            auto result = timed(ZVEC_OP_QUERY_ENGINE, [&] { return run_cached_query(handle, q, filter, key, &truncated); });
+            if (!result.has_value()) return timer.finish(to_c_status(result.error()));
+            *out = timed(ZVEC_OP_QUERY_MATERIALIZE, [&] { return to_c_result(result.value(), truncated); });
+            return ok_status();
+        });
+    return ok_status();
 }
 
-void zvec_collection_destroy(zvec_collection_handle_t handle) {
-    if (handle) {
-        handle->ptr.reset();
-        delete handle;
-    }
+zvec_status_t zvec_collection_insert_async(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op) {
+    return submit_doc_write(handle, docs, count, &Collection::Insert, callback, user_data, out_op);
 }
 
-zvec_status_t zvec_collection_destroy_data(zvec_collection_handle_t handle) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    return to_c_status(handle->ptr->Destroy());
+zvec_status_t zvec_collection_upsert_async(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op) {
+    return submit_doc_write(handle, docs, count, &Collection::Upsert, callback, user_data, out_op);
 }
 
-zvec_status_t zvec_collection_flush(zvec_collection_handle_t handle) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    return to_c_status(handle->ptr->Flush());
+zvec_status_t zvec_collection_update_async(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op) {
+    return submit_doc_write(handle, docs, count, &Collection::Update, callback, user_data, out_op);
 }
 
-zvec_status_t zvec_collection_optimize(zvec_collection_handle_t handle) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    return to_c_status(handle->ptr->Optimize());
+zvec_status_t zvec_collection_insert_columnar_async(zvec_collection_handle_t handle, const zvec_column_batch_t* batch,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op) {
+    return submit_columnar_write(handle, batch, &Collection::Insert, callback, user_data, out_op);
 }
 
-zvec_status_t zvec_collection_create_index(
-    zvec_collection_handle_t handle,
-    const char* field_name,
-    const zvec_field_def_t* index_def)
-{
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    if (!field_name) return {2, "null field_name"};
-    if (!index_def) return {2, "null index_def"};
-    
-    auto index_params = create_index_params(index_def);
-    if (!index_params) return {2, "invalid index definition"};
-    
-    return to_c_status(handle->ptr->CreateIndex(std::string(field_name), index_params));
+zvec_status_t zvec_collection_upsert_columnar_async(zvec_collection_handle_t handle, const zvec_column_batch_t* batch,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op) {
+    return submit_columnar_write(handle, batch, &Collection::Upsert, callback, user_data, out_op);
 }
 
-zvec_status_t zvec_collection_drop_index(
+zvec_status_t zvec_collection_delete_async(zvec_collection_handle_t handle, const char** ids, size_t count,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op) {
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (handle->read_only) return read_only_status();
+    if (!callback) return {2, "null callback"};
+    if (!ids && count > 0) return {2, "null ids"};
+
+    submit_async(handle, out_op, callback, user_data,
+        [handle, pks = copy_pks(ids, count)](zvec_result_t**) -> zvec_status_t {
+            if (pks.empty()) return ok_status();
+            OpTimer timer(ZVEC_OP_DELETE);
+            auto result = timed(ZVEC_OP_WRITE_ENGINE, [&] { return engine(handle)->Delete(pks); });
+            handle->pending_deletes += pks.size();
+            return timer.finish(finish_write(handle, result));
+        });
+    return ok_status();
+}
+
+void zvec_async_cancel(zvec_async_op_handle_t op) {
+    if (op) op->cancelled = true;
+}
+
+void zvec_async_release(zvec_async_op_handle_t op) {
+    if (op) release_async_op(op);
+}
+
+// ===== Scan =====
+zvec_status_t zvec_collection_scan_open(
     zvec_collection_handle_t handle,
-    const char* field_name)
+    const char* filter,
+    const char** output_fields,
+    size_t output_field_count,
+    int include_vector,
+    size_t batch_size,
+    zvec_scan_handle_t* out_scan)
 {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    if (!field_name) return {2, "null field_name"};
-    
-    return to_c_status(handle->ptr->DropIndex(std::string(field_name)));
-}
+    if (!handle || !engine(handle)) return {2, "null handle"};
+    if (!out_scan) return {2, "null out"};
+    if (batch_size == 0) return {2, "batch_size must be positive"};
+    if (!output_fields && output_field_count > 0) return {2, "null output fields"};
 
-zvec_status_t zvec_collection_insert(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    if (!docs || count == 0) return ok_status();
-    
-    std::vector<Doc> zvec_docs;
-    zvec_docs.reserve(count);
-    for (size_t i = 0; i < count; i++) {
-        zvec_docs.push_back(docs[i]->doc);
-    }
-    
-    auto result = handle->ptr->Insert(zvec_docs);
-    if (result.has_value()) {
-        for (const auto& s : result.value()) {
-            if (!s.ok()) return to_c_status(s);
+    // The engine has no segment iterator: the scan takes the matching keys once and
+    // fetches one page of documents per zvec_scan_next.
+    auto scan = std::make_unique<zvec_scan_t>();
+    scan->col = engine(handle);
+    scan->batch_size = batch_size;
+
+    auto schema = scan->col->Schema();
+    if (!schema.has_value()) return to_c_status(schema.error());
+    if (output_fields) {
+        std::unordered_set<std::string> wanted(output_fields, output_fields + output_field_count);
+        for (const auto& f : schema.value().forward_fields()) {
+            if (!wanted.count(f->name())) scan->hidden_fields.push_back(f->name());
         }
-        return ok_status();
     }
-    return to_c_status(result.error());
+    if (!include_vector) {
+        for (const auto& f : schema.value().vector_fields()) scan->hidden_fields.push_back(f->name());
+    }
+
+    auto status = collect_keys(scan->col, filter ? filter : "", scan->keys);
+    if (status.code != 0) return status;
+
+    *out_scan = scan.release();
+    return ok_status();
 }
 
-zvec_status_t zvec_collection_upsert(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    if (!docs || count == 0) return ok_status();
-    
-    std::vector<Doc> zvec_docs;
-    zvec_docs.reserve(count);
-    for (size_t i = 0; i < count; i++) {
-        zvec_docs.push_back(docs[i]->doc);
-    }
-    
-    auto result = handle->ptr->Upsert(zvec_docs);
-    if (result.has_value()) {
-        for (const auto& s : result.value()) {
-            if (!s.ok()) return to_c_status(s);
+zvec_status_t zvec_scan_next(zvec_scan_handle_t scan, zvec_result_handle_t* out_result) {
+    if (!scan) return {2, "null scan"};
+    if (!out_result) return {2, "null out"};
+
+    *out_result = nullptr;
+    OpTimer timer(ZVEC_OP_SCAN_NEXT);
+    // A page whose documents were all deleted since the scan opened is skipped.
+    while (scan->next < scan->keys.size()) {
+        const size_t begin = scan->next;
+        const size_t end = std::min(scan->keys.size(), begin + scan->batch_size);
+        auto res = std::make_unique<zvec_result_t>();
+        auto status = fetch_key_page(scan->col, scan->keys, begin, end, res->hits);
+        if (status.code != 0) return timer.finish(status);
+        scan->next = end;
+        if (res->hits.empty()) continue;
+
+        for (auto& hit : res->hits) {
+            for (const auto& name : scan->hidden_fields) hit->set_null(name);
         }
+        *out_result = res.release();
         return ok_status();
     }
-    return to_c_status(result.error());
+    return ok_status();
 }
 
-zvec_status_t zvec_collection_update(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    if (!docs || count == 0) return ok_status();
-    
-    std::vector<Doc> zvec_docs;
-    zvec_docs.reserve(count);
-    for (size_t i = 0; i < count; i++) {
-        zvec_docs.push_back(docs[i]->doc);
-    }
-    
-    auto result = handle->ptr->Update(zvec_docs);
-    if (result.has_value()) {
-        for (const auto& s : result.value()) {
-            if (!s.ok()) return to_c_status(s);
-        }
-        return ok_status();
-    }
-    return to_c_status(result.error());
+void zvec_scan_close(zvec_scan_handle_t scan) {
+    delete scan;
 }
 
-zvec_status_t zvec_collection_delete(zvec_collection_handle_t handle, const char** ids, size_t count) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    if (!ids || count == 0) return ok_status();
-    
-    std::vector<std::string> pks;
-    pks.reserve(count);
-    for (size_t i = 0; i < count; i++) {
-        pks.push_back(std::string(ids[i]));
-    }
-    
-    auto result = handle->ptr->Delete(pks);
-    if (result.has_value()) {
-        for (const auto& s : result.value()) {
-            if (!s.ok()) return to_c_status(s);
-        }
-        return ok_status();
-    }
-    return to_c_status(result.error());
+// ===== Result =====
+void zvec_result_destroy(zvec_result_handle_t handle) {
+    delete handle;
 }
 
-zvec_status_t zvec_collection_delete_by_filter(zvec_collection_handle_t handle, const char* filter) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    if (!filter) return {2, "null filter"};
-    
-    return to_c_status(handle->ptr->DeleteByFilter(std::string(filter)));
+size_t zvec_result_count(zvec_result_handle_t handle) {
+    return handle ? handle->hits.size() : 0;
 }
 
-zvec_status_t zvec_collection_query(zvec_collection_handle_t handle, zvec_query_handle_t query, zvec_result_handle_t* out) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    if (!query) return {2, "null query"};
-    if (!out) return {2, "null out"};
-    
-    auto result = handle->ptr->Query(query->query);
-    if (result.has_value()) {
-        auto* res = new zvec_result_t();
-        for (const auto& doc_ptr : result.value()) {
-            if (doc_ptr) {
-                zvec_doc_t d;
-                d.doc = *doc_ptr;
-                d.pk_cache = doc_ptr->pk();
-                res->docs.push_back(std::move(d));
-            }
+int zvec_result_truncated(zvec_result_handle_t handle) {
+    return handle && handle->truncated ? 1 : 0;
+}
+
+zvec_doc_handle_t zvec_result_get_doc(zvec_result_handle_t handle, size_t index) {
+    if (!handle || index >= handle->hits.size()) return nullptr;
+    if (handle->docs.empty()) {
+        handle->docs.resize(handle->hits.size());
+        for (size_t i = 0; i < handle->hits.size(); i++) {
+            handle->docs[i].doc = *handle->hits[i];
+            handle->docs[i].pk_cache = handle->hits[i]->pk();
         }
-        *out = res;
-        return ok_status();
     }
-    
-    return to_c_status(result.error());
+    return &handle->docs[index];
 }
 
-zvec_status_t zvec_collection_fetch(zvec_collection_handle_t handle, const char** ids, size_t count, zvec_result_handle_t* out) {
-    if (!handle || !handle->ptr) return {2, "null handle"};
-    if (!out) return {2, "null out"};
-    
-    std::vector<std::string> pks;
-    if (ids && count > 0) {
-        pks.reserve(count);
-        for (size_t i = 0; i < count; i++) {
-            pks.push_back(std::string(ids[i]));
+zvec_status_t zvec_result_export(
+    zvec_result_handle_t handle,
+    zvec_column_t* columns,
+    size_t column_count,
+    zvec_result_export_t* out_export)
+{
+    if (!handle) return {2, "null handle"};
+    if (!out_export) return {2, "null out"};
+    if (column_count > 0 && !columns) return {2, "null columns"};
+
+    for (size_t c = 0; c < column_count; c++) {
+        if (!columns[c].name) return {2, "null column name"};
+        if (columns[c].data_type != ZVEC_DATA_TYPE_STRING &&
+            export_row_size(columns[c].data_type, columns[c].dimension) == 0) {
+            return {2, "unsupported column data type"};
         }
     }
-    
-    auto result = handle->ptr->Fetch(pks);
-    if (result.has_value()) {
-        auto* res = new zvec_result_t();
-        for (const auto& [pk, doc_ptr] : result.value()) {
-            if (doc_ptr) {
-                zvec_doc_t d;
-                d.doc = *doc_ptr;
-                d.pk_cache = pk;
-                res->docs.push_back(std::move(d));
-            }
-        }
-        *out = res;
-        return ok_status();
+
+    OpTimer timer(ZVEC_OP_RESULT_EXPORT);
+    const auto& hits = handle->hits;
+    handle->pk_data.clear();
+    handle->pk_offsets.assign(1, 0);
+    handle->pk_offsets.reserve(hits.size() + 1);
+    handle->scores.resize(hits.size());
+    for (size_t i = 0; i < hits.size(); i++) {
+        handle->pk_data += hits[i]->pk();
+        handle->pk_offsets.push_back(static_cast<int32_t>(handle->pk_data.size()));
+        handle->scores[i] = hits[i]->score();
     }
-    
-    return to_c_status(result.error());
+
+    handle->columns.resize(column_count);
+    for (size_t c = 0; c < column_count; c++) {
+        auto& buffer = handle->columns[c];
+        export_column(hits, columns[c], buffer);
+        columns[c].values = buffer.values.data();
+        columns[c].offsets = buffer.offsets.empty() ? nullptr : buffer.offsets.data();
+        columns[c].values_size = buffer.values.size();
+        columns[c].null_bitmap = buffer.null_bitmap.data();
+    }
+
+    out_export->row_count = hits.size();
+    out_export->pk_data = handle->pk_data.data();
+    out_export->pk_offsets = handle->pk_offsets.data();
+    out_export->scores = handle->scores.data();
+    return ok_status();
 }
 
-const char* zvec_collection_get_path(zvec_collection_handle_t handle) {
-    if (!handle || !handle->ptr) return nullptr;
-    
-    auto result = handle->ptr->Path();
-    if (result.has_value()) {
-        handle->path_cache = result.value();
-        return handle->path_cache.c_str();
+// ===== Metrics =====
+zvec_status_t zvec_metrics_snapshot(zvec_op_metrics_t* out_metrics, size_t count) {
+    if (!out_metrics && count > 0) return {2, "null out_metrics"};
+
+    auto& metrics = Metrics::instance();
+    for (size_t op = 0; op < std::min<size_t>(count, ZVEC_OP_COUNT); op++) {
+        metrics.snapshot(static_cast<int>(op), out_metrics[op]);
     }
-    return nullptr;
+    return ok_status();
 }
 
-// ===== Result =====
-void zvec_result_destroy(zvec_result_handle_t handle) {
-    delete handle;
+void zvec_metrics_reset(void) {
+    Metrics::instance().reset();
 }
 
-size_t zvec_result_count(zvec_result_handle_t handle) {
-    return handle ? handle->docs.size() : 0;
+const char* zvec_metrics_op_name(int32_t op) {
+    static const char* const names[ZVEC_OP_COUNT] = {
+        "query", "query.prepare", "query.engine", "query.materialize", "query.batch",
+        "query.multi", "fetch", "insert", "upsert", "update", "delete", "write.convert",
+        "write.engine", "delete_by_filter", "flush", "optimize", "create_index",
+        "drop_index", "open", "scan.open", "scan.next", "result.export", "async.queue",
+        "import", "export", "warmup", "tune", "snapshot.create", "refresh", "prepared.execute",
+        "id_set.create", "bulk_load.begin", "bulk_load.end",
+    };
+    if (op < 0 || op >= ZVEC_OP_COUNT) return nullptr;
+    return names[op];
 }
 
-zvec_doc_handle_t zvec_result_get_doc(zvec_result_handle_t handle, size_t index) {
-    if (!handle || index >= handle->docs.size()) return nullptr;
-    return &handle->docs[index];
+uint64_t zvec_metrics_bucket_upper_ns(size_t bucket) {
+    return Metrics::bucket_upper(std::min<size_t>(bucket, ZVEC_METRIC_BUCKETS - 1));
 }
 
 }  // extern "C"
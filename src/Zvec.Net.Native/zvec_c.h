@@ -60,9 +60,14 @@ typedef int32_t zvec_quantize_type_t;
 /* ===== Handles ===== */
 typedef struct zvec_collection_t* zvec_collection_handle_t;
 typedef struct zvec_doc_t* zvec_doc_handle_t;
+typedef struct zvec_doc_batch_t* zvec_doc_batch_handle_t;
+typedef const struct zvec_field_t* zvec_field_id_t;
+typedef struct zvec_scan_t* zvec_scan_handle_t;
 typedef struct zvec_result_t* zvec_result_handle_t;
 typedef struct zvec_schema_t* zvec_schema_handle_t;
 typedef struct zvec_query_t* zvec_query_handle_t;
+typedef struct zvec_id_set_t* zvec_id_set_handle_t;
+typedef struct zvec_prepared_query_t* zvec_prepared_query_handle_t;
 
 /* ===== Field Definition ===== */
 typedef struct {
@@ -78,13 +83,69 @@ typedef struct {
     int32_t quantize_type;
 } zvec_field_def_t;
 
-/* ===== Collection Options ===== */
+/* ===== Collection Options =====
+ * segment_max_docs only applies when a collection is created. index_build_parallel
+ * is the thread count for index builds and optimize (0 = engine default). With
+ * auto_flush set, every successful write is followed by a flush; leave it off
+ * (the default) and call zvec_collection_flush to batch flushes. query_cache_size
+ * bounds an LRU of single-query results, keyed on everything that decides the hits;
+ * every write, delete, optimize or index change invalidates all cached results. */
 typedef struct {
     int32_t segment_max_docs;
     int32_t index_build_parallel;
     int auto_flush;
+    int32_t query_parallel;     /* batch query workers; 0 = hardware concurrency */
+    int32_t query_cache_size;   /* cached query results; 0 = cache off */
 } zvec_collection_options_t;
 
+/* ===== Query Cache Stats ===== */
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;     /* includes lookups that found an entry from before the last write */
+    uint64_t evictions;
+    uint64_t entries;
+} zvec_query_cache_stats_t;
+
+/* ===== Columnar Batch =====
+ * One column of a columnar write. Layout of `values` depends on data_type:
+ *   BOOL                    uint8_t[row_count]
+ *   INT32/INT64/UINT32/UINT64/FLOAT/DOUBLE   typed array [row_count]
+ *   STRING                  UTF-8 bytes, row i spans [offsets[i], offsets[i + 1])
+ *   VECTOR_FP16/FP32/FP64/INT8/INT16   row-major matrix [row_count * dimension]
+ * Bit i of null_bitmap (LSB first) set means row i is null; may be NULL.
+ * String offsets must start at 0 or above, never decrease, and end at or below
+ * values_size; a write with offsets outside that range fails with status 2. */
+typedef struct {
+    const char* name;
+    int32_t data_type;
+    int32_t dimension;
+    const void* values;
+    const int32_t* offsets;
+    size_t values_size;         /* byte length of values; checked for STRING columns */
+    const uint8_t* null_bitmap;
+} zvec_column_t;
+
+/* Primary keys use the same offsets + bytes encoding as STRING columns, bounded by
+ * pk_data_size. */
+typedef struct {
+    size_t row_count;
+    const char* pk_data;
+    size_t pk_data_size;
+    const int32_t* pk_offsets;
+    const zvec_column_t* columns;
+    size_t column_count;
+} zvec_column_batch_t;
+
+/* ===== Result Export =====
+ * Filled by zvec_result_export. All buffers are owned by the result and stay
+ * valid until it is destroyed or exported again. */
+typedef struct {
+    size_t row_count;
+    const char* pk_data;
+    const int32_t* pk_offsets;
+    const double* scores;
+} zvec_result_export_t;
+
 /* ===== Query Definition ===== */
 typedef struct {
     int32_t topk;
@@ -101,6 +162,41 @@ typedef struct {
     int32_t n_probe;
 } zvec_query_def_t;
 
+/* ===== Query Params =====
+ * Search knobs for one query. index_type UNDEFINED builds the params for the
+ * target field's index. Zero ef / n_probe / refine_factor keep engine defaults. */
+typedef struct {
+    int32_t index_type;
+    int32_t ef;               /* HNSW */
+    int32_t n_probe;          /* IVF */
+    float radius;             /* 0 = no radius limit */
+    int is_linear;            /* brute-force scan instead of the index */
+    int is_using_refiner;
+    float refine_factor;      /* IVF / FLAT refiner scale factor */
+} zvec_query_params_t;
+
+/* ===== Fusion =====
+ * How zvec_collection_query_multi merges per-field candidate lists.
+ *   RRF       score = sum over lists of 1 / (rrf_k + rank), rank starting at 1
+ *   WEIGHTED  score = sum over lists of weights[i] * metric-normalized score
+ *
+ * WEIGHTED maps each raw score onto [0, 1], higher is better, by the metric of
+ * its field's index:
+ *   L2        1 - 2 * atan(distance) / pi
+ *   IP        0.5 + atan(score) / pi
+ *   COSINE    1 - distance / 2   (cosine distance in [0, 2])
+ * A field without a vector index keeps its raw score. */
+#define ZVEC_FUSION_RRF      0
+#define ZVEC_FUSION_WEIGHTED 1
+
+typedef struct {
+    int32_t method;
+    double rrf_k;
+    const double* weights;    /* WEIGHTED: one per query */
+    size_t weight_count;      /* WEIGHTED: must equal query_count */
+    int32_t topk;             /* size of the merged result */
+} zvec_fusion_t;
+
 /* ===== Document ===== */
 zvec_doc_handle_t zvec_doc_create();
 void zvec_doc_destroy(zvec_doc_handle_t handle);
@@ -118,13 +214,19 @@ zvec_status_t zvec_doc_set_double(zvec_doc_handle_t handle, const char* field, d
 zvec_status_t zvec_doc_set_bool(zvec_doc_handle_t handle, const char* field, int value);
 zvec_status_t zvec_doc_set_null(zvec_doc_handle_t handle, const char* field);
 
-/* Vector setters */
+/* Vector setters; f16 data is IEEE 754 binary16 bit patterns, stored without conversion */
 zvec_status_t zvec_doc_set_vector_f32(zvec_doc_handle_t handle, const char* field, const float* data, size_t len);
+zvec_status_t zvec_doc_set_vector_f16(zvec_doc_handle_t handle, const char* field, const uint16_t* data, size_t len);
+zvec_status_t zvec_doc_set_vector_i8(zvec_doc_handle_t handle, const char* field, const int8_t* data, size_t len);
+zvec_status_t zvec_doc_set_vector_i16(zvec_doc_handle_t handle, const char* field, const int16_t* data, size_t len);
 zvec_status_t zvec_doc_set_sparse_vector_f32(zvec_doc_handle_t handle, const char* field, 
     const uint32_t* indices, const float* values, size_t len);
 
 /* Vector getters */
 size_t zvec_doc_get_vector_f32(zvec_doc_handle_t handle, const char* field, float* out_data, size_t max_len);
+size_t zvec_doc_get_vector_f16(zvec_doc_handle_t handle, const char* field, uint16_t* out_data, size_t max_len);
+size_t zvec_doc_get_vector_i8(zvec_doc_handle_t handle, const char* field, int8_t* out_data, size_t max_len);
+size_t zvec_doc_get_vector_i16(zvec_doc_handle_t handle, const char* field, int16_t* out_data, size_t max_len);
 
 /* Field getters */
 int zvec_doc_has_field(zvec_doc_handle_t handle, const char* field);
@@ -133,6 +235,49 @@ int64_t zvec_doc_get_int64(zvec_doc_handle_t handle, const char* field);
 double zvec_doc_get_double(zvec_doc_handle_t handle, const char* field);
 int zvec_doc_get_bool(zvec_doc_handle_t handle, const char* field);
 
+/* ===== Document Batch =====
+ * A reusable set of documents for repeated small writes. The slots, their pk and vector
+ * caches and the staging vector handed to the engine are kept across
+ * zvec_doc_batch_clear, and a write moves documents to the engine instead of copying
+ * them. This is not an arena: zvec_doc_batch_add resets its slot to an empty document,
+ * so every field value set afterwards (strings, vectors) is allocated again on each fill.
+ * Handles returned by zvec_doc_batch_add belong to the batch: fill them with the
+ * zvec_doc_set_* functions, never pass them to zvec_doc_destroy, and do not use them
+ * after the next clear. */
+zvec_doc_batch_handle_t zvec_doc_batch_create(size_t capacity);
+void zvec_doc_batch_destroy(zvec_doc_batch_handle_t batch);
+zvec_doc_handle_t zvec_doc_batch_add(zvec_doc_batch_handle_t batch);
+void zvec_doc_batch_clear(zvec_doc_batch_handle_t batch);
+size_t zvec_doc_batch_count(zvec_doc_batch_handle_t batch);
+
+/* ===== Resolved Fields =====
+ * zvec_collection_resolve_field looks a field up in the collection's schema and interns
+ * its name, data type and dimension once per collection; the returned id stays valid until
+ * the collection is destroyed and can be shared across threads. An unknown field fails, and
+ * so does a data_type (ZVEC_DATA_TYPE_*) other than the schema's; pass
+ * ZVEC_DATA_TYPE_UNDEFINED to accept any type.
+ *
+ * The _by_id setters skip the per-call UTF-8 marshalling and std::string construction for
+ * the field name, and return status 2 for a value of another type than the field's or a
+ * dense vector whose length is not the field's dimension. The document still stores fields
+ * by name, so each set hashes the name as before. */
+zvec_status_t zvec_collection_resolve_field(zvec_collection_handle_t handle, const char* name,
+    int32_t data_type, zvec_field_id_t* out_field);
+
+zvec_status_t zvec_doc_set_string_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const char* value);
+zvec_status_t zvec_doc_set_int32_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, int32_t value);
+zvec_status_t zvec_doc_set_int64_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, int64_t value);
+zvec_status_t zvec_doc_set_float_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, float value);
+zvec_status_t zvec_doc_set_double_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, double value);
+zvec_status_t zvec_doc_set_bool_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, int value);
+zvec_status_t zvec_doc_set_null_by_id(zvec_doc_handle_t handle, zvec_field_id_t field);
+zvec_status_t zvec_doc_set_vector_f32_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const float* data, size_t len);
+zvec_status_t zvec_doc_set_vector_f16_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const uint16_t* data, size_t len);
+zvec_status_t zvec_doc_set_vector_i8_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const int8_t* data, size_t len);
+zvec_status_t zvec_doc_set_vector_i16_by_id(zvec_doc_handle_t handle, zvec_field_id_t field, const int16_t* data, size_t len);
+zvec_status_t zvec_doc_set_sparse_vector_f32_by_id(zvec_doc_handle_t handle, zvec_field_id_t field,
+    const uint32_t* indices, const float* values, size_t len);
+
 /* ===== Schema Creation ===== */
 zvec_schema_handle_t zvec_schema_create(const char* name);
 void zvec_schema_destroy(zvec_schema_handle_t handle);
@@ -156,11 +301,42 @@ void zvec_query_destroy(zvec_query_handle_t handle);
 void zvec_query_set_topk(zvec_query_handle_t handle, int32_t topk);
 void zvec_query_set_field_name(zvec_query_handle_t handle, const char* field_name);
 void zvec_query_set_vector(zvec_query_handle_t handle, const float* data, size_t len);
+/* Native-precision query vectors; must match the target field's data type */
+void zvec_query_set_vector_f16(zvec_query_handle_t handle, const uint16_t* data, size_t len);
+void zvec_query_set_vector_i8(zvec_query_handle_t handle, const int8_t* data, size_t len);
+void zvec_query_set_vector_i16(zvec_query_handle_t handle, const int16_t* data, size_t len);
+/* Sparse query for SPARSE_FP32 / SPARSE_FP16 fields; values are narrowed to fp16
+ * at execution when the target field is SPARSE_FP16. */
+void zvec_query_set_sparse_vector(zvec_query_handle_t handle, const uint32_t* indices, const float* values, size_t len);
 void zvec_query_set_filter(zvec_query_handle_t handle, const char* filter);
 void zvec_query_set_include_vector(zvec_query_handle_t handle, int include);
 void zvec_query_set_output_fields(zvec_query_handle_t handle, const char** fields, size_t count);
 void zvec_query_set_ef_search(zvec_query_handle_t handle, int32_t ef);
 void zvec_query_set_n_probe(zvec_query_handle_t handle, int32_t n_probe);
+void zvec_query_set_params(zvec_query_handle_t handle, const zvec_query_params_t* params);
+
+/* ===== Id Sets =====
+ * An immutable set of primary keys, resolved once and shared by any number of
+ * queries and threads. A query restricted by a set keeps only hits whose pk is
+ * in it (ALLOW) or not in it (DENY), in addition to its filter string.
+ *
+ * This is post-filtering, not a predicate inside the index traversal: the
+ * engine takes no candidate set, so each pass is a full search whose hits
+ * outside the set are dropped, repeated with topk x4 until topk hits pass, the
+ * engine runs out, or 2^20 candidates were asked for. A selective ALLOW set
+ * therefore costs several full searches, and a search stopped by the cap
+ * returns fewer than topk hits; zvec_result_truncated reports that.
+ * Queries keep their own reference, so a set may be destroyed while in use. */
+#define ZVEC_ID_FILTER_NONE  0
+#define ZVEC_ID_FILTER_ALLOW 1
+#define ZVEC_ID_FILTER_DENY  2
+
+zvec_status_t zvec_id_set_create(const char** pks, size_t count, zvec_id_set_handle_t* out_set);
+void zvec_id_set_destroy(zvec_id_set_handle_t set);
+/* Distinct pks in the set */
+size_t zvec_id_set_count(zvec_id_set_handle_t set);
+/* A NULL set or ZVEC_ID_FILTER_NONE clears the query's id filter */
+void zvec_query_set_id_filter(zvec_query_handle_t handle, zvec_id_set_handle_t set, int32_t mode);
 
 /* ===== Collection ===== */
 zvec_status_t zvec_collection_create_and_open(
@@ -174,12 +350,54 @@ zvec_status_t zvec_collection_open(
     const zvec_collection_options_t* options,
     zvec_collection_handle_t* out_handle);
 
+/* Opens for queries only, without the write path; segment and index files are
+ * mapped shared and read-only, so processes opening the same collection share
+ * them through the page cache. Writes, flush, optimize, index changes and bulk
+ * loads fail on the handle. It sees the segments published when it was opened
+ * or last refreshed: zvec_collection_refresh reopens the collection to pick up
+ * the writer's later flushes, letting calls already running finish first. */
+zvec_status_t zvec_collection_open_readonly(
+    const char* path,
+    const zvec_collection_options_t* options,
+    zvec_collection_handle_t* out_handle);
+zvec_status_t zvec_collection_refresh(zvec_collection_handle_t handle);
+
+/* Snapshot: a read-only handle pinned to the collection's data as of the call.
+ * On a writable handle, pending writes are flushed (serialized with optimize)
+ * and the collection is reopened read-only, so the snapshot holds the current
+ * segments and delete bitmap. While a snapshot of a writable handle is open,
+ * that handle refuses optimize, index creation and drops, begin_bulk_load and
+ * destroy_data (status 2), the background optimizer and end_bulk_load skip
+ * their optimize, so no segment or index file the snapshot reads is deleted;
+ * writes and flushes continue. On a read-only handle the snapshot shares the
+ * data that handle currently sees and pins nothing. Queries,
+ * fetches and scans on the snapshot use its own engine instance and query cache,
+ * so they never wait on the writer and pages of a scan stay consistent. It
+ * cannot be written or refreshed; release it with zvec_collection_snapshot_release. */
+zvec_status_t zvec_collection_snapshot_create(zvec_collection_handle_t handle, zvec_collection_handle_t* out_snapshot);
+zvec_status_t zvec_collection_snapshot_release(zvec_collection_handle_t snapshot);
+
 void zvec_collection_destroy(zvec_collection_handle_t handle);
 zvec_status_t zvec_collection_destroy_data(zvec_collection_handle_t handle);
 
 zvec_status_t zvec_collection_flush(zvec_collection_handle_t handle);
 zvec_status_t zvec_collection_optimize(zvec_collection_handle_t handle);
 
+/* Bulk load: begin suspends auto-flush and drops vector indexes (their
+ * parameters are kept); end rebuilds them with index_build_parallel threads,
+ * then optimizes and flushes. Writes during the load are only searchable
+ * by brute force.
+ *
+ * If a drop fails, begin recreates the indexes it already dropped; any it
+ * cannot recreate leave the load active so end can retry them. If a rebuild
+ * fails, end keeps the load active with the remaining indexes and can be
+ * called again. The kept parameters are written to "<path>.bulk_load" before
+ * the first drop and rewritten as indexes are rebuilt; zvec_collection_open
+ * reads that file back, so after a crash or close during the load the reopened
+ * handle is still in the bulk load and end rebuilds the indexes. */
+zvec_status_t zvec_collection_begin_bulk_load(zvec_collection_handle_t handle);
+zvec_status_t zvec_collection_end_bulk_load(zvec_collection_handle_t handle);
+
 zvec_status_t zvec_collection_create_index(
     zvec_collection_handle_t handle,
     const char* field_name,
@@ -192,19 +410,489 @@ zvec_status_t zvec_collection_drop_index(
 zvec_status_t zvec_collection_insert(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count);
 zvec_status_t zvec_collection_upsert(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count);
 zvec_status_t zvec_collection_update(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count);
+/* Writes the batch's documents without copying them; the batch is unchanged and may be cleared afterwards */
+zvec_status_t zvec_collection_insert_doc_batch(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch);
+zvec_status_t zvec_collection_upsert_doc_batch(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch);
+zvec_status_t zvec_collection_update_doc_batch(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch);
+zvec_status_t zvec_collection_insert_columnar(zvec_collection_handle_t handle, const zvec_column_batch_t* batch);
+zvec_status_t zvec_collection_upsert_columnar(zvec_collection_handle_t handle, const zvec_column_batch_t* batch);
 zvec_status_t zvec_collection_delete(zvec_collection_handle_t handle, const char** ids, size_t count);
 zvec_status_t zvec_collection_delete_by_filter(zvec_collection_handle_t handle, const char* filter);
 
+/* ===== Per-Document Write Status =====
+ * Variants of the writes above that report every document's outcome instead of
+ * returning the first failure. out_statuses must hold one entry per document
+ * (row, or id for delete), in input order; out_failed (may be NULL) receives the
+ * number of failed entries. A failed document does not stop the others, and the
+ * written ones are flushed as usual. The call returns non-zero only when the
+ * write could not run at all (bad arguments, read-only handle, a whole-batch
+ * engine error or a failed flush); entries are still filled for engine errors. */
+typedef struct {
+    int32_t code;                 /* 0 = written */
+    int32_t message_index;        /* -1 when written; see zvec_write_status_message */
+} zvec_doc_status_t;
+
+zvec_status_t zvec_collection_insert_with_status(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_doc_status_t* out_statuses, size_t* out_failed);
+zvec_status_t zvec_collection_upsert_with_status(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_doc_status_t* out_statuses, size_t* out_failed);
+zvec_status_t zvec_collection_update_with_status(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_doc_status_t* out_statuses, size_t* out_failed);
+zvec_status_t zvec_collection_insert_doc_batch_with_status(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed);
+zvec_status_t zvec_collection_upsert_doc_batch_with_status(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed);
+zvec_status_t zvec_collection_update_doc_batch_with_status(zvec_collection_handle_t handle, zvec_doc_batch_handle_t batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed);
+zvec_status_t zvec_collection_insert_columnar_with_status(zvec_collection_handle_t handle, const zvec_column_batch_t* batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed);
+zvec_status_t zvec_collection_upsert_columnar_with_status(zvec_collection_handle_t handle, const zvec_column_batch_t* batch,
+    zvec_doc_status_t* out_statuses, size_t* out_failed);
+zvec_status_t zvec_collection_delete_with_status(zvec_collection_handle_t handle, const char** ids, size_t count,
+    zvec_doc_status_t* out_statuses, size_t* out_failed);
+/* Message of a failed entry. Distinct messages are stored once per call and stay
+ * valid until the next *_with_status call on the same thread; NULL if out of range. */
+const char* zvec_write_status_message(int32_t index);
+
 zvec_status_t zvec_collection_query(zvec_collection_handle_t handle, zvec_query_handle_t query, zvec_result_handle_t* out_result);
+/* Runs query_count searches that share query's field, filter, topk and params.
+ * vectors is a row-major [query_count * dimension] matrix; out_results must hold
+ * query_count handles and receives one result per row, each freed with zvec_result_destroy.
+ * The field must be VECTOR_FP32 with the given dimension; other vector types fail with
+ * status 2 and are searched one vector at a time with zvec_collection_query. */
+zvec_status_t zvec_collection_query_batch(
+    zvec_collection_handle_t handle,
+    zvec_query_handle_t query,
+    const float* vectors,
+    size_t query_count,
+    size_t dimension,
+    zvec_result_handle_t* out_results);
+/* Runs query_count queries concurrently (typically one per vector field) and
+ * fuses their hits into one result of at most fusion->topk documents. */
+zvec_status_t zvec_collection_query_multi(
+    zvec_collection_handle_t handle,
+    const zvec_query_handle_t* queries,
+    size_t query_count,
+    const zvec_fusion_t* fusion,
+    zvec_result_handle_t* out_result);
 zvec_status_t zvec_collection_fetch(zvec_collection_handle_t handle, const char** ids, size_t count, zvec_result_handle_t* out_result);
 
 const char* zvec_collection_get_path(zvec_collection_handle_t handle);
+/* All zeros when the collection was opened without a query cache */
+zvec_status_t zvec_collection_get_query_cache_stats(zvec_collection_handle_t handle, zvec_query_cache_stats_t* out_stats);
+
+/* ===== Prepared Queries =====
+ * A dense query's shape (field, filter, topk, output fields, params and id
+ * filter) bound to a collection once; query's vector is ignored and query may
+ * be destroyed afterwards. Field defaults are resolved at prepare time.
+ * Executing supplies only the vector, read from the caller's buffer during the
+ * call. Prepared queries are immutable and may be executed from several threads
+ * at once; destroy them before their collection. */
+zvec_status_t zvec_collection_prepare_query(
+    zvec_collection_handle_t handle,
+    zvec_query_handle_t query,
+    zvec_prepared_query_handle_t* out_prepared);
+void zvec_prepared_query_destroy(zvec_prepared_query_handle_t prepared);
+zvec_status_t zvec_prepared_query_execute(
+    zvec_prepared_query_handle_t prepared,
+    const float* vector,
+    size_t len,
+    zvec_result_handle_t* out_result);
+
+/* ===== Query Tuning =====
+ * zvec_collection_tune sweeps the query-time knob of a vector field's index (HNSW ef or
+ * IVF n_probe) over a sample of query vectors. Ground truth is a linear scan of the same
+ * field with the same filter, so recall@topk is exact for the sample. Each value runs the
+ * whole sample once, one query at a time, after an untimed warm-up pass; the query cache
+ * is bypassed. Build-time parameters (m, ef_construction, quantize type) need an index
+ * rebuild and are not swept.
+ *
+ * The recommendation is the smallest value whose recall reaches target_recall, or the
+ * smallest value with the best recall when none does. With apply set it becomes the field's query
+ * default (see zvec_collection_set_query_defaults). */
+typedef struct {
+    const char* field_name;
+    const float* queries;         /* row-major [query_count * dimension] */
+    size_t query_count;
+    size_t dimension;
+    int32_t topk;
+    double target_recall;         /* in (0, 1] */
+    const int32_t* candidates;    /* values to try; NULL = a built-in ladder */
+    size_t candidate_count;
+    const char* filter;           /* may be NULL */
+    int apply;
+} zvec_tune_request_t;
+
+typedef struct {
+    int32_t value;                /* ef (HNSW) or n_probe (IVF) */
+    double recall;
+    double mean_latency_us;
+    double p99_latency_us;
+    int pareto;                   /* no other value has higher recall at lower mean latency */
+} zvec_tune_point_t;
+
+typedef struct {
+    int32_t index_type;
+    int32_t recommended;
+    int target_met;
+    size_t point_count;           /* values measured; min(point_count, capacity) points are written */
+} zvec_tune_report_t;
+
+zvec_status_t zvec_collection_tune(
+    zvec_collection_handle_t handle,
+    const zvec_tune_request_t* request,
+    zvec_tune_point_t* out_points,
+    size_t point_capacity,
+    zvec_tune_report_t* out_report);
+
+/* Search params used for queries on field_name that set none of their own; NULL clears
+ * them. They live as long as the handle and are not saved with the collection. */
+zvec_status_t zvec_collection_set_query_defaults(
+    zvec_collection_handle_t handle,
+    const char* field_name,
+    const zvec_query_params_t* params);
+
+/* ===== Background Optimize =====
+ * An opt-in thread per collection that runs Optimize once enough work has piled up
+ * since the last optimize: pending_writes documents written, or deletes reaching
+ * deleted_ratio of the live documents. The engine reports neither segment counts nor
+ * tombstones, so both are tracked by this layer; writes during a bulk load are
+ * counted but never trigger a run before it ends.
+ *
+ * Runs use concurrency threads (0 = 1) and are spaced at least min_interval_ms apart.
+ * budget_percent caps the share of wall time spent optimizing: after a run of d ms the
+ * next one waits d * (100 - budget) / budget ms (0 = 100, no cap). Queries are not
+ * blocked; a manual optimize waits for a background run and resets the pending counts.
+ * Pausing skips future runs but lets a running one finish. */
+#define ZVEC_AUTO_OPTIMIZE_OFF     0
+#define ZVEC_AUTO_OPTIMIZE_IDLE    1
+#define ZVEC_AUTO_OPTIMIZE_RUNNING 2
+#define ZVEC_AUTO_OPTIMIZE_PAUSED  3
+
+typedef struct {
+    uint64_t check_interval_ms;   /* how often the thresholds are checked; 0 = 1000 */
+    uint64_t min_interval_ms;     /* minimum time between two runs */
+    uint64_t pending_writes;      /* 0 = writes never trigger a run */
+    double deleted_ratio;         /* 0 = deletes never trigger a run */
+    int32_t concurrency;
+    int32_t budget_percent;
+} zvec_optimize_policy_t;
+
+typedef struct {
+    int32_t state;
+    int32_t last_status_code;     /* of the last background run */
+    uint64_t runs;
+    uint64_t failures;
+    uint64_t pending_writes;
+    uint64_t pending_deletes;
+    uint64_t last_duration_ms;
+} zvec_optimize_status_t;
+
+zvec_status_t zvec_collection_start_auto_optimize(zvec_collection_handle_t handle, const zvec_optimize_policy_t* policy);
+/* Waits for a running optimize to finish */
+zvec_status_t zvec_collection_stop_auto_optimize(zvec_collection_handle_t handle);
+zvec_status_t zvec_collection_pause_auto_optimize(zvec_collection_handle_t handle);
+zvec_status_t zvec_collection_resume_auto_optimize(zvec_collection_handle_t handle);
+zvec_status_t zvec_collection_get_auto_optimize_status(zvec_collection_handle_t handle, zvec_optimize_status_t* out_status);
+
+/* ===== Warmup =====
+ * Reads a freshly opened collection's files into the OS page cache so the first
+ * queries do not fault index pages in one at a time. Files are read front to back
+ * in 1 MiB blocks with fread, several at once on the collection's worker pool, in
+ * path order. The engine does not say which files belong to which field, so every
+ * file is read; byte_budget caps the bytes read (0 = no limit).
+ *
+ * The file pass only warms the OS page cache. That is what a read-only handle
+ * (which maps segments) serves queries from; a writable handle reads through the
+ * engine's own buffers, which stay cold. Afterwards query_count rows of queries
+ * ([query_count * dimension], row-major) are run against query_field with topk
+ * hits; they warm the engine's caches for that field, and their results are dropped.
+ *
+ * One warmup runs per handle at a time; progress can be read while it runs and
+ * cancel stops it after the blocks in flight, returning status 9. A cancel issued
+ * while no warmup runs applies to the next one, so one issued just before a
+ * warmup starts is not lost. */
+typedef struct {
+    uint64_t byte_budget;
+    const char* query_field;
+    const float* queries;
+    size_t query_count;
+    size_t dimension;
+    int32_t topk;                 /* 0 = 10 */
+} zvec_warmup_options_t;
+
+typedef struct {
+    uint64_t files_total;         /* files selected within the budget */
+    uint64_t files_loaded;
+    uint64_t bytes_total;
+    uint64_t bytes_loaded;
+    uint64_t queries_total;
+    uint64_t queries_run;
+    int running;
+} zvec_warmup_progress_t;
+
+/* options may be NULL: every file, no budget, no queries. out_progress may be NULL. */
+zvec_status_t zvec_collection_warmup(
+    zvec_collection_handle_t handle,
+    const zvec_warmup_options_t* options,
+    zvec_warmup_progress_t* out_progress);
+/* Progress of the running warmup, or of the last one */
+zvec_status_t zvec_collection_get_warmup_progress(zvec_collection_handle_t handle, zvec_warmup_progress_t* out_progress);
+zvec_status_t zvec_collection_cancel_warmup(zvec_collection_handle_t handle);
+
+/* ===== Import =====
+ * Streams rows from a file straight into the collection in chunks of chunk_rows:
+ * the next chunk is read while the current one is converted (on several threads
+ * for large chunks) and written, so no row passes through the caller's memory.
+ *
+ *   FVECS / BVECS   per record an int32 dimension, then float32 / uint8 values;
+ *                   bvecs is widened to float32
+ *   NPY             2-D C-order array of <f4, <f8, <f2, |i1, <i2 or |u1 (widened
+ *                   to float32)
+ *   PARQUET / ARROW_IPC   record batches (IPC file or stream format); only in
+ *                   builds with ZVEC_C_WITH_ARROW, otherwise status 2
+ *
+ * Each row becomes a document with its vector in vector_field. Primary keys are
+ * pk_prefix + row number counted from pk_start, or for Parquet/IPC the pk_column
+ * (string or integer) when set. Parquet/IPC take the vector from vector_column, a
+ * fixed_size_list or list of float, double, half_float, int8 or int16, and copy
+ * scalar_columns (bool, integers, float, double, string) to fields of the same name.
+ *
+ * Rows the engine rejects are counted in rows_failed and the import goes on; a
+ * malformed file or a chunk the engine rejects as a whole stops it, and the report
+ * covers the rows before. With auto-flush on, the collection is flushed once at
+ * the end instead of after every chunk. */
+#define ZVEC_IMPORT_AUTO       0   /* from the extension: .fvecs .bvecs .npy .parquet .arrow .arrows .ipc .feather */
+#define ZVEC_IMPORT_FVECS      1
+#define ZVEC_IMPORT_BVECS      2
+#define ZVEC_IMPORT_NPY        3
+#define ZVEC_IMPORT_PARQUET    4
+#define ZVEC_IMPORT_ARROW_IPC  5
+
+typedef struct {
+    const char* vector_field;
+    const char* vector_column;    /* Parquet/IPC; NULL = vector_field */
+    const char* pk_column;        /* Parquet/IPC; NULL = generated */
+    const char* pk_prefix;        /* generated keys; NULL = "" */
+    uint64_t pk_start;
+    const char** scalar_columns;  /* Parquet/IPC */
+    size_t scalar_column_count;
+} zvec_import_mapping_t;
+
+typedef struct {
+    size_t chunk_rows;            /* 0 = 16384; IPC files keep their own batches */
+    uint64_t max_rows;            /* 0 = every row */
+    int upsert;                   /* write with upsert instead of insert */
+} zvec_import_options_t;
+
+typedef struct {
+    uint64_t rows_read;
+    uint64_t rows_written;
+    uint64_t rows_failed;
+    uint64_t chunks;
+    uint64_t elapsed_ms;
+    double rows_per_second;       /* rows_written over the whole import */
+    int32_t first_error_code;     /* first rejected row; 0 if none */
+    const char* first_error_message;  /* valid until the next import on this thread */
+} zvec_import_report_t;
+
+/* options and out_report may be NULL */
+zvec_status_t zvec_collection_import(
+    zvec_collection_handle_t handle,
+    const char* path,
+    int32_t format,
+    const zvec_import_mapping_t* mapping,
+    const zvec_import_options_t* options,
+    zvec_import_report_t* out_report);
+
+/* ===== Export =====
+ * Writes every document matching filter to a Parquet or Arrow IPC file: a
+ * string primary key column followed by one column per field, vectors as
+ * fixed_size_list columns that zvec_collection_import reads back. Needs a build
+ * with ZVEC_C_WITH_ARROW; otherwise returns status 2.
+ *
+ * The engine has no segment iterator, so the keys are gathered by one filter
+ * query that loads no fields, then fetched batch_rows at a time, as for scans.
+ * Up to concurrency batches are fetched and converted at once and each is
+ * written as it arrives, in key order, so memory holds the keys (one string per
+ * matching document) plus concurrency + 1 batches. The key pass is O(N) in the
+ * matching documents and has no cap; only the documents are streamed. Parquet
+ * gets one row group per batch. Export from a snapshot for a consistent dump; on a live
+ * collection, documents deleted after the key query are skipped. On failure the
+ * partial file is removed. */
+#define ZVEC_EXPORT_AUTO       0   /* from the extension: .parquet .pq .arrow .arrows .ipc .feather */
+#define ZVEC_EXPORT_PARQUET    4   /* same values as ZVEC_IMPORT_* */
+#define ZVEC_EXPORT_ARROW_IPC  5   /* IPC file format */
+
+typedef struct {
+    const char** fields;          /* NULL or empty = every scalar and dense vector field */
+    size_t field_count;
+    const char* filter;           /* NULL = every document */
+    const char* pk_column;        /* NULL = "pk" */
+    size_t batch_rows;            /* 0 = 16384 */
+    int32_t concurrency;          /* batches fetched at once; 0 = hardware threads */
+} zvec_export_options_t;
+
+typedef struct {
+    uint64_t rows;
+    uint64_t batches;
+    uint64_t bytes_written;
+    uint64_t elapsed_ms;
+    double rows_per_second;
+} zvec_export_report_t;
+
+/* options and out_report may be NULL */
+zvec_status_t zvec_collection_export(
+    zvec_collection_handle_t handle,
+    const char* path,
+    int32_t format,
+    const zvec_export_options_t* options,
+    zvec_export_report_t* out_report);
+
+/* ===== Async =====
+ * Async calls copy their inputs, queue the work on the collection's worker pool
+ * (query_parallel threads) and return at once; the caller may free docs, ids,
+ * batches and queries as soon as the call returns. Queued operations run
+ * concurrently and in no particular order.
+ *
+ * callback runs exactly once, on a pool thread. status is only valid during the
+ * callback. For queries, result (NULL on error) is owned by the callee and must be
+ * freed with zvec_result_destroy; writes always pass NULL.
+ *
+ * zvec_async_cancel stops an operation that has not started yet; its callback then
+ * receives ZVEC_STATUS_CANCELLED. Running operations finish normally. out_op may be
+ * NULL; a returned op must be released with zvec_async_release. Destroying the
+ * collection waits for all queued operations. */
+#define ZVEC_STATUS_CANCELLED 9
+
+typedef struct zvec_async_op_t* zvec_async_op_handle_t;
+typedef void (*zvec_async_callback_t)(void* user_data, zvec_status_t status, zvec_result_handle_t result);
+
+zvec_status_t zvec_collection_query_async(zvec_collection_handle_t handle, zvec_query_handle_t query,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op);
+zvec_status_t zvec_collection_insert_async(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op);
+zvec_status_t zvec_collection_upsert_async(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op);
+zvec_status_t zvec_collection_update_async(zvec_collection_handle_t handle, zvec_doc_handle_t* docs, size_t count,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op);
+zvec_status_t zvec_collection_insert_columnar_async(zvec_collection_handle_t handle, const zvec_column_batch_t* batch,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op);
+zvec_status_t zvec_collection_upsert_columnar_async(zvec_collection_handle_t handle, const zvec_column_batch_t* batch,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op);
+zvec_status_t zvec_collection_delete_async(zvec_collection_handle_t handle, const char** ids, size_t count,
+    zvec_async_callback_t callback, void* user_data, zvec_async_op_handle_t* out_op);
+
+void zvec_async_cancel(zvec_async_op_handle_t op);
+void zvec_async_release(zvec_async_op_handle_t op);
+
+/* ===== Scan =====
+ * A cursor over every document matching filter (NULL or "" for all), handed out in pages of
+ * at most batch_size documents. output_fields (NULL for all) and include_vector are applied
+ * as for queries. Each zvec_scan_next fetches the next batch_size documents by key, but
+ * this is not a constant-memory cursor: the engine has no segment iterator, so opening the
+ * scan runs one query with no vector and topk = doc_count (capped at INT32_MAX). That pass
+ * is O(N) in the number of matches: the engine builds a Doc for every match while the key
+ * list is copied out, and the cursor then holds one key per match until it is closed.
+ * It relies on the engine answering a vector-less, filter-only query with that topk.
+ * Pages come in the order that query returns, not segment order. Documents inserted later
+ * are not seen, deleted ones are skipped and updated ones are read as of their page.
+ * zvec_scan_next sets *out_result to NULL once the scan is exhausted; pages are freed with
+ * zvec_result_destroy and may outlive the scan. A scan must not outlive its collection and
+ * is not thread-safe. */
+zvec_status_t zvec_collection_scan_open(
+    zvec_collection_handle_t handle,
+    const char* filter,
+    const char** output_fields,
+    size_t output_field_count,
+    int include_vector,
+    size_t batch_size,
+    zvec_scan_handle_t* out_scan);
+zvec_status_t zvec_scan_next(zvec_scan_handle_t scan, zvec_result_handle_t* out_result);
+void zvec_scan_close(zvec_scan_handle_t scan);
 
 /* ===== Result ===== */
 void zvec_result_destroy(zvec_result_handle_t handle);
 size_t zvec_result_count(zvec_result_handle_t handle);
+/* 1 when an id-filtered search hit its candidate cap before topk hits passed */
+int zvec_result_truncated(zvec_result_handle_t handle);
 zvec_doc_handle_t zvec_result_get_doc(zvec_result_handle_t handle, size_t index);
 
+/* Exports pks, scores and the requested columns in one pass. For each column the
+ * caller sets name, data_type and (vectors) dimension; values, offsets (STRING),
+ * values_size and null_bitmap are filled with result-owned buffers in the
+ * zvec_column_t layout. Missing fields and vectors of another dimension are marked null. */
+zvec_status_t zvec_result_export(
+    zvec_result_handle_t handle,
+    zvec_column_t* columns,
+    size_t column_count,
+    zvec_result_export_t* out_export);
+
+/* ===== Metrics =====
+ * Every collection-level call is timed into a process-wide latency histogram, and
+ * queries and writes are also timed per phase. Per-document and per-result accessors
+ * are not timed. Recording is lock-free on per-thread stripes; a snapshot sums the
+ * stripes, so calls finishing while it is taken may or may not be included.
+ *
+ * Histograms are log-linear: four buckets per power of two of nanoseconds, so a
+ * bucket's width is at most a quarter of its lower bound. Percentiles are the upper
+ * bound of the bucket holding them, capped at max_ns. */
+#define ZVEC_OP_QUERY             0
+#define ZVEC_OP_QUERY_PREPARE     1   /* query params, vector setup and cache key */
+#define ZVEC_OP_QUERY_ENGINE      2   /* engine Query, filter parsing included; cache hits too */
+#define ZVEC_OP_QUERY_MATERIALIZE 3   /* wrapping the hits in a result */
+#define ZVEC_OP_QUERY_BATCH       4
+#define ZVEC_OP_QUERY_MULTI       5
+#define ZVEC_OP_FETCH             6
+#define ZVEC_OP_INSERT            7
+#define ZVEC_OP_UPSERT            8
+#define ZVEC_OP_UPDATE            9
+#define ZVEC_OP_DELETE            10
+#define ZVEC_OP_WRITE_CONVERT     11  /* doc handles or columns to engine documents */
+#define ZVEC_OP_WRITE_ENGINE      12  /* engine Insert/Upsert/Update/Delete */
+#define ZVEC_OP_DELETE_BY_FILTER  13
+#define ZVEC_OP_FLUSH             14  /* explicit flushes and auto-flush after writes */
+#define ZVEC_OP_OPTIMIZE          15
+#define ZVEC_OP_CREATE_INDEX      16
+#define ZVEC_OP_DROP_INDEX        17
+#define ZVEC_OP_OPEN              18  /* create_and_open, open and open_readonly */
+#define ZVEC_OP_SCAN_OPEN         19
+#define ZVEC_OP_SCAN_NEXT         20
+#define ZVEC_OP_RESULT_EXPORT     21
+#define ZVEC_OP_ASYNC_QUEUE       22  /* async submit until a worker starts the operation */
+#define ZVEC_OP_IMPORT            23  /* whole import; chunks are also timed as writes */
+#define ZVEC_OP_EXPORT            24
+#define ZVEC_OP_WARMUP            25
+#define ZVEC_OP_TUNE              26
+#define ZVEC_OP_SNAPSHOT_CREATE   27
+#define ZVEC_OP_REFRESH           28
+#define ZVEC_OP_PREPARED_EXECUTE  29  /* phases are timed as query.prepare/engine/materialize */
+#define ZVEC_OP_ID_SET_CREATE     30
+#define ZVEC_OP_BULK_BEGIN        31
+#define ZVEC_OP_BULK_END          32  /* index rebuilds, optimize and flush */
+#define ZVEC_OP_COUNT             33
+
+#define ZVEC_METRIC_BUCKETS 160
+
+typedef struct {
+    uint64_t count;
+    uint64_t errors;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t p50_ns;
+    uint64_t p90_ns;
+    uint64_t p99_ns;
+    uint64_t buckets[ZVEC_METRIC_BUCKETS];
+} zvec_op_metrics_t;
+
+/* Fills out_metrics[i] for op i < min(count, ZVEC_OP_COUNT) */
+zvec_status_t zvec_metrics_snapshot(zvec_op_metrics_t* out_metrics, size_t count);
+void zvec_metrics_reset(void);
+/* Dotted name such as "query.engine"; NULL for an unknown op */
+const char* zvec_metrics_op_name(int32_t op);
+/* Largest latency in nanoseconds that falls into bucket */
+uint64_t zvec_metrics_bucket_upper_ns(size_t bucket);
+
 /* ===== Version ===== */
 const char* zvec_version();
 
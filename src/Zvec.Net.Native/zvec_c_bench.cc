@@ -0,0 +1,674 @@
+// zvec_c_bench: end-to-end benchmark of the C API.
+//
+// Builds a collection from a synthetic dataset (or fvecs/ivecs files), then measures
+// insert throughput, index build time, query QPS and latency at several thread
+// counts, fetch throughput and recall@topk, and prints the results as JSON so runs
+// can be diffed between builds. Only zvec_c.h is used.
+
+#include "zvec_c.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    int32_t dim = 128;
+    size_t count = 100000;
+    size_t queries = 1000;
+    int32_t metric = ZVEC_METRIC_TYPE_L2;
+    int32_t index = ZVEC_INDEX_TYPE_HNSW;
+    int32_t m = 16;
+    int32_t ef_construction = 200;
+    int32_t ef = 64;
+    int32_t n_lists = 1024;
+    int32_t n_probe = 64;
+    int32_t topk = 10;
+    std::vector<int> threads = {1, 2, 4, 8};
+    size_t batch = 1000;
+    size_t fetch = 10000;
+    size_t fetch_batch = 100;
+    uint32_t seed = 42;
+    std::string base_path;
+    std::string query_path;
+    std::string gt_path;
+    std::string path;
+    std::string output;
+    bool keep = false;
+};
+
+struct Dataset {
+    int32_t dim = 0;
+    size_t count = 0;
+    std::vector<float> data;   // row-major [count * dim]
+
+    const float* row(size_t i) const { return data.data() + i * dim; }
+};
+
+struct LatencySummary {
+    double p50_us = 0;
+    double p99_us = 0;
+    double max_us = 0;
+};
+
+[[noreturn]] void fail(const std::string& message) {
+    std::fprintf(stderr, "zvec_c_bench: %s\n", message.c_str());
+    std::exit(1);
+}
+
+void check(zvec_status_t status, const char* what) {
+    if (status.code != 0) {
+        fail(std::string(what) + " failed (" + std::to_string(status.code) + "): " +
+             (status.message ? status.message : ""));
+    }
+}
+
+double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Helper: nearest-rank percentiles over latencies in nanoseconds
+LatencySummary summarize(std::vector<uint64_t> ns) {
+    LatencySummary s;
+    if (ns.empty()) return s;
+    std::sort(ns.begin(), ns.end());
+    auto at = [&](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p * ns.size()));
+        return ns[std::min(ns.size() - 1, rank == 0 ? 0 : rank - 1)] / 1000.0;
+    };
+    s.p50_us = at(0.50);
+    s.p99_us = at(0.99);
+    s.max_us = ns.back() / 1000.0;
+    return s;
+}
+
+// ===== Arguments =====
+
+const char* kUsage =
+    "usage: zvec_c_bench [options]\n"
+    "  --dim N              vector dimension of the synthetic dataset (128)\n"
+    "  --count N            documents to insert (100000)\n"
+    "  --queries N          queries per run (1000)\n"
+    "  --metric M           l2 | ip | cosine (l2)\n"
+    "  --index I            hnsw | ivf | flat (hnsw)\n"
+    "  --m N                HNSW graph degree (16)\n"
+    "  --ef-construction N  HNSW build candidate list (200)\n"
+    "  --ef N               HNSW search candidate list (64)\n"
+    "  --n-lists N          IVF clusters (1024)\n"
+    "  --n-probe N          IVF clusters searched (64)\n"
+    "  --topk N             hits per query (10)\n"
+    "  --threads LIST       comma-separated query thread counts (1,2,4,8)\n"
+    "  --batch N            documents per insert call (1000)\n"
+    "  --fetch N            documents fetched in the fetch run (10000)\n"
+    "  --fetch-batch N      ids per fetch call (100)\n"
+    "  --seed N             random seed (42)\n"
+    "  --base FILE          base vectors (.fvecs) instead of synthetic data\n"
+    "  --query FILE         query vectors (.fvecs); default: synthetic, or rows of --base\n"
+    "  --gt FILE            ground truth ids (.ivecs); default: brute force\n"
+    "  --path DIR           collection directory (a fresh temp directory)\n"
+    "  --keep               keep the collection directory\n"
+    "  --output FILE        write the JSON report to FILE instead of stdout\n";
+
+int32_t parse_metric(const std::string& v) {
+    if (v == "l2") return ZVEC_METRIC_TYPE_L2;
+    if (v == "ip") return ZVEC_METRIC_TYPE_IP;
+    if (v == "cosine") return ZVEC_METRIC_TYPE_COSINE;
+    fail("unknown metric '" + v + "'");
+}
+
+int32_t parse_index(const std::string& v) {
+    if (v == "hnsw") return ZVEC_INDEX_TYPE_HNSW;
+    if (v == "ivf") return ZVEC_INDEX_TYPE_IVF;
+    if (v == "flat") return ZVEC_INDEX_TYPE_FLAT;
+    fail("unknown index '" + v + "'");
+}
+
+const char* metric_name(int32_t metric) {
+    switch (metric) {
+        case ZVEC_METRIC_TYPE_IP: return "ip";
+        case ZVEC_METRIC_TYPE_COSINE: return "cosine";
+        default: return "l2";
+    }
+}
+
+const char* index_name(int32_t index) {
+    switch (index) {
+        case ZVEC_INDEX_TYPE_IVF: return "ivf";
+        case ZVEC_INDEX_TYPE_FLAT: return "flat";
+        default: return "hnsw";
+    }
+}
+
+long long parse_int(const std::string& name, const std::string& v, long long min) {
+    char* end = nullptr;
+    long long n = std::strtoll(v.c_str(), &end, 10);
+    if (v.empty() || *end != '\0' || n < min) {
+        fail("invalid value '" + v + "' for " + name);
+    }
+    return n;
+}
+
+Options parse_args(int argc, char** argv) {
+    Options o;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            std::fputs(kUsage, stdout);
+            std::exit(0);
+        }
+        if (arg == "--keep") {
+            o.keep = true;
+            continue;
+        }
+        if (i + 1 >= argc) fail("missing value for " + arg);
+        std::string v = argv[++i];
+        if (arg == "--dim") o.dim = static_cast<int32_t>(parse_int(arg, v, 1));
+        else if (arg == "--count") o.count = parse_int(arg, v, 1);
+        else if (arg == "--queries") o.queries = parse_int(arg, v, 1);
+        else if (arg == "--metric") o.metric = parse_metric(v);
+        else if (arg == "--index") o.index = parse_index(v);
+        else if (arg == "--m") o.m = static_cast<int32_t>(parse_int(arg, v, 1));
+        else if (arg == "--ef-construction") o.ef_construction = static_cast<int32_t>(parse_int(arg, v, 1));
+        else if (arg == "--ef") o.ef = static_cast<int32_t>(parse_int(arg, v, 1));
+        else if (arg == "--n-lists") o.n_lists = static_cast<int32_t>(parse_int(arg, v, 1));
+        else if (arg == "--n-probe") o.n_probe = static_cast<int32_t>(parse_int(arg, v, 1));
+        else if (arg == "--topk") o.topk = static_cast<int32_t>(parse_int(arg, v, 1));
+        else if (arg == "--batch") o.batch = parse_int(arg, v, 1);
+        else if (arg == "--fetch") o.fetch = parse_int(arg, v, 0);
+        else if (arg == "--fetch-batch") o.fetch_batch = parse_int(arg, v, 1);
+        else if (arg == "--seed") o.seed = static_cast<uint32_t>(parse_int(arg, v, 0));
+        else if (arg == "--base") o.base_path = v;
+        else if (arg == "--query") o.query_path = v;
+        else if (arg == "--gt") o.gt_path = v;
+        else if (arg == "--path") o.path = v;
+        else if (arg == "--output") o.output = v;
+        else if (arg == "--threads") {
+            o.threads.clear();
+            size_t start = 0;
+            while (start <= v.size()) {
+                size_t comma = v.find(',', start);
+                if (comma == std::string::npos) comma = v.size();
+                o.threads.push_back(static_cast<int>(parse_int(arg, v.substr(start, comma - start), 1)));
+                start = comma + 1;
+            }
+        } else {
+            fail("unknown option " + arg + "\n" + kUsage);
+        }
+    }
+    return o;
+}
+
+// ===== Datasets =====
+
+// Helper: reads .fvecs / .ivecs (per row: int32 dimension, then dimension 4-byte values)
+template <typename T>
+std::vector<T> read_vecs(const std::string& path, size_t max_rows, int32_t& dim, size_t& rows) {
+    FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) fail("cannot open " + path);
+    std::vector<T> data;
+    dim = 0;
+    rows = 0;
+    int32_t d = 0;
+    while (rows < max_rows && std::fread(&d, sizeof(d), 1, f) == 1) {
+        if (d <= 0 || (dim != 0 && d != dim)) {
+            std::fclose(f);
+            fail(path + ": inconsistent row dimension at row " + std::to_string(rows));
+        }
+        dim = d;
+        data.resize((rows + 1) * d);
+        if (std::fread(data.data() + rows * d, sizeof(T), d, f) != static_cast<size_t>(d)) {
+            std::fclose(f);
+            fail(path + ": truncated row " + std::to_string(rows));
+        }
+        rows++;
+    }
+    std::fclose(f);
+    if (rows == 0) fail(path + ": no rows");
+    return data;
+}
+
+Dataset load_fvecs(const std::string& path, size_t max_rows) {
+    Dataset ds;
+    ds.data = read_vecs<float>(path, max_rows, ds.dim, ds.count);
+    return ds;
+}
+
+Dataset synthetic(int32_t dim, size_t count, uint32_t seed) {
+    Dataset ds;
+    ds.dim = dim;
+    ds.count = count;
+    ds.data.resize(count * dim);
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    for (auto& x : ds.data) x = normal(rng);
+    return ds;
+}
+
+// ===== Ground Truth =====
+
+// Helper: higher is better for every metric
+float similarity(int32_t metric, const float* a, const float* b, int32_t dim) {
+    double dot = 0, na = 0, nb = 0, l2 = 0;
+    for (int32_t i = 0; i < dim; i++) {
+        double x = a[i], y = b[i];
+        dot += x * y;
+        na += x * x;
+        nb += y * y;
+        l2 += (x - y) * (x - y);
+    }
+    switch (metric) {
+        case ZVEC_METRIC_TYPE_IP: return static_cast<float>(dot);
+        case ZVEC_METRIC_TYPE_COSINE:
+            return na == 0 || nb == 0 ? 0.0f : static_cast<float>(dot / std::sqrt(na * nb));
+        default: return static_cast<float>(-l2);
+    }
+}
+
+std::vector<std::vector<int64_t>> brute_force(const Dataset& base, const Dataset& queries,
+                                              int32_t metric, size_t topk, size_t threads) {
+    std::vector<std::vector<int64_t>> truth(queries.count);
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        std::vector<std::pair<float, int64_t>> scored(base.count);
+        for (size_t q; (q = next.fetch_add(1)) < queries.count;) {
+            for (size_t i = 0; i < base.count; i++) {
+                scored[i] = {similarity(metric, queries.row(q), base.row(i), base.dim), static_cast<int64_t>(i)};
+            }
+            size_t k = std::min(topk, scored.size());
+            std::partial_sort(scored.begin(), scored.begin() + k, scored.end(),
+                              [](const auto& a, const auto& b) { return a.first > b.first; });
+            truth[q].resize(k);
+            for (size_t i = 0; i < k; i++) truth[q][i] = scored[i].second;
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 0; t < threads; t++) pool.emplace_back(worker);
+    for (auto& t : pool) t.join();
+    return truth;
+}
+
+std::vector<std::vector<int64_t>> load_ivecs(const std::string& path, size_t rows, size_t topk) {
+    int32_t dim = 0;
+    size_t read = 0;
+    std::vector<int32_t> ids = read_vecs<int32_t>(path, rows, dim, read);
+    if (read < rows) fail(path + ": fewer ground truth rows than queries");
+    size_t k = std::min(topk, static_cast<size_t>(dim));
+    std::vector<std::vector<int64_t>> truth(rows);
+    for (size_t q = 0; q < rows; q++) {
+        truth[q].assign(ids.begin() + q * dim, ids.begin() + q * dim + k);
+    }
+    return truth;
+}
+
+// ===== Benchmark =====
+
+struct QueryRun {
+    int threads = 0;
+    size_t queries = 0;
+    double seconds = 0;
+    LatencySummary latency;
+};
+
+class Bench {
+public:
+    explicit Bench(const Options& options) : o_(options) {}
+
+    ~Bench() { close(); }
+
+    void close() {
+        if (col_) zvec_collection_destroy(col_);
+        col_ = nullptr;
+    }
+
+    void open(const std::string& path) {
+        zvec_schema_handle_t schema = zvec_schema_create("bench");
+        zvec_field_def_t field{};
+        field.name = "vec";
+        field.data_type = ZVEC_DATA_TYPE_VECTOR_FP32;
+        field.dimension = dim_;
+        field.index_type = o_.index;
+        field.metric_type = o_.metric;
+        field.m = o_.m;
+        field.ef_construction = o_.ef_construction;
+        field.n_lists = o_.n_lists;
+        check(zvec_schema_add_vector_field(schema, &field), "add vector field");
+
+        zvec_collection_options_t options{};
+        options.index_build_parallel = static_cast<int32_t>(max_threads());
+        zvec_status_t status = zvec_collection_create_and_open(path.c_str(), schema, &options, &col_);
+        zvec_schema_destroy(schema);
+        check(status, "create collection");
+    }
+
+    // Columnar inserts under a bulk load, so the index is built once by end_bulk_load
+    void load(const Dataset& base) {
+        check(zvec_collection_begin_bulk_load(col_), "begin bulk load");
+
+        std::vector<uint64_t> batch_ns;
+        std::string pks;
+        std::vector<int32_t> offsets;
+        auto start = Clock::now();
+        for (size_t first = 0; first < base.count; first += o_.batch) {
+            size_t rows = std::min(o_.batch, base.count - first);
+            pks.clear();
+            offsets.assign(1, 0);
+            for (size_t i = first; i < first + rows; i++) {
+                pks += std::to_string(i);
+                offsets.push_back(static_cast<int32_t>(pks.size()));
+            }
+            zvec_column_t column{};
+            column.name = "vec";
+            column.data_type = ZVEC_DATA_TYPE_VECTOR_FP32;
+            column.dimension = base.dim;
+            column.values = base.row(first);
+            zvec_column_batch_t batch{rows, pks.data(), pks.size(), offsets.data(), &column, 1};
+
+            auto t0 = Clock::now();
+            check(zvec_collection_insert_columnar(col_, &batch), "insert");
+            batch_ns.push_back(elapsed_ns(t0));
+        }
+        insert_seconds_ = seconds_since(start);
+        insert_latency_ = summarize(std::move(batch_ns));
+
+        start = Clock::now();
+        check(zvec_collection_end_bulk_load(col_), "end bulk load");
+        build_seconds_ = seconds_since(start);
+    }
+
+    // Untimed pass that also warms the index; returns each query's hits as row numbers
+    std::vector<std::vector<int64_t>> collect_hits(const Dataset& queries) {
+        std::vector<std::vector<int64_t>> hits(queries.count);
+        zvec_query_handle_t query = make_query();
+        for (size_t q = 0; q < queries.count; q++) {
+            zvec_query_set_vector(query, queries.row(q), queries.dim);
+            zvec_result_handle_t result = nullptr;
+            check(zvec_collection_query(col_, query, &result), "query");
+            zvec_result_export_t out{};
+            check(zvec_result_export(result, nullptr, 0, &out), "result export");
+            for (size_t i = 0; i < out.row_count; i++) {
+                std::string pk(out.pk_data + out.pk_offsets[i], out.pk_offsets[i + 1] - out.pk_offsets[i]);
+                hits[q].push_back(std::strtoll(pk.c_str(), nullptr, 10));
+            }
+            zvec_result_destroy(result);
+        }
+        zvec_query_destroy(query);
+        return hits;
+    }
+
+    QueryRun run_queries(const Dataset& queries, int threads) {
+        std::vector<std::vector<uint64_t>> latencies(threads);
+        std::atomic<size_t> next{0};
+        auto worker = [&](int t) {
+            zvec_query_handle_t query = make_query();
+            latencies[t].reserve(queries.count / threads + 1);
+            for (size_t q; (q = next.fetch_add(1)) < queries.count;) {
+                zvec_query_set_vector(query, queries.row(q), queries.dim);
+                zvec_result_handle_t result = nullptr;
+                auto t0 = Clock::now();
+                check(zvec_collection_query(col_, query, &result), "query");
+                latencies[t].push_back(elapsed_ns(t0));
+                zvec_result_destroy(result);
+            }
+            zvec_query_destroy(query);
+        };
+
+        auto start = Clock::now();
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++) pool.emplace_back(worker, t);
+        for (auto& t : pool) t.join();
+
+        QueryRun run;
+        run.threads = threads;
+        run.queries = queries.count;
+        run.seconds = seconds_since(start);
+        std::vector<uint64_t> all;
+        for (auto& l : latencies) all.insert(all.end(), l.begin(), l.end());
+        run.latency = summarize(std::move(all));
+        return run;
+    }
+
+    void run_fetch(size_t count) {
+        fetch_docs_ = 0;
+        if (count == 0) return;
+        std::mt19937 rng(o_.seed + 2);
+        std::uniform_int_distribution<size_t> pick(0, doc_count_ - 1);
+        std::vector<std::string> ids(o_.fetch_batch);
+        std::vector<const char*> id_ptrs(o_.fetch_batch);
+        std::vector<uint64_t> batch_ns;
+
+        auto start = Clock::now();
+        for (size_t done = 0; done < count; done += o_.fetch_batch) {
+            size_t n = std::min(o_.fetch_batch, count - done);
+            for (size_t i = 0; i < n; i++) {
+                ids[i] = std::to_string(pick(rng));
+                id_ptrs[i] = ids[i].c_str();
+            }
+            zvec_result_handle_t result = nullptr;
+            auto t0 = Clock::now();
+            check(zvec_collection_fetch(col_, id_ptrs.data(), n, &result), "fetch");
+            batch_ns.push_back(elapsed_ns(t0));
+            fetch_docs_ += zvec_result_count(result);
+            zvec_result_destroy(result);
+        }
+        fetch_seconds_ = seconds_since(start);
+        fetch_latency_ = summarize(std::move(batch_ns));
+    }
+
+    void set_dataset(int32_t dim, size_t count) {
+        dim_ = dim;
+        doc_count_ = count;
+    }
+
+    size_t max_threads() const {
+        int m = 1;
+        for (int t : o_.threads) m = std::max(m, t);
+        return static_cast<size_t>(m);
+    }
+
+    double insert_seconds_ = 0;
+    LatencySummary insert_latency_;
+    double build_seconds_ = 0;
+    double fetch_seconds_ = 0;
+    size_t fetch_docs_ = 0;
+    LatencySummary fetch_latency_;
+
+private:
+    static uint64_t elapsed_ns(Clock::time_point start) {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }
+
+    zvec_query_handle_t make_query() const {
+        zvec_query_handle_t query = zvec_query_create();
+        zvec_query_set_field_name(query, "vec");
+        zvec_query_set_topk(query, o_.topk);
+        zvec_query_params_t params{};
+        params.index_type = o_.index;
+        params.ef = o_.ef;
+        params.n_probe = o_.n_probe;
+        zvec_query_set_params(query, &params);
+        return query;
+    }
+
+    const Options& o_;
+    zvec_collection_handle_t col_ = nullptr;
+    int32_t dim_ = 0;
+    size_t doc_count_ = 0;
+};
+
+double recall(const std::vector<std::vector<int64_t>>& hits,
+              const std::vector<std::vector<int64_t>>& truth) {
+    double sum = 0;
+    size_t counted = 0;
+    for (size_t q = 0; q < truth.size(); q++) {
+        if (truth[q].empty()) continue;
+        std::unordered_set<int64_t> expected(truth[q].begin(), truth[q].end());
+        size_t found = 0;
+        for (int64_t id : hits[q]) found += expected.count(id);
+        sum += static_cast<double>(found) / truth[q].size();
+        counted++;
+    }
+    return counted == 0 ? 0.0 : sum / counted;
+}
+
+// ===== JSON =====
+
+std::string json_string(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out += buf;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    return out + "\"";
+}
+
+std::string json_number(double v) {
+    if (!std::isfinite(v)) return "null";
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.6g", v);
+    return buf;
+}
+
+std::string json_latency(const LatencySummary& s) {
+    return "\"p50_us\": " + json_number(s.p50_us) + ", \"p99_us\": " + json_number(s.p99_us) +
+           ", \"max_us\": " + json_number(s.max_us);
+}
+
+double per_second(double n, double seconds) {
+    return seconds > 0 ? n / seconds : 0.0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options o = parse_args(argc, argv);
+
+    Dataset base = o.base_path.empty() ? synthetic(o.dim, o.count, o.seed) : load_fvecs(o.base_path, o.count);
+    Dataset queries;
+    if (!o.query_path.empty()) {
+        queries = load_fvecs(o.query_path, o.queries);
+    } else if (!o.base_path.empty()) {
+        // Real data without a query file: query with (a prefix of) the base rows
+        queries.dim = base.dim;
+        queries.count = std::min(o.queries, base.count);
+        queries.data.assign(base.data.begin(), base.data.begin() + queries.count * base.dim);
+    } else {
+        queries = synthetic(o.dim, o.queries, o.seed + 1);
+    }
+    if (queries.dim != base.dim) fail("query and base dimensions differ");
+
+    namespace fs = std::filesystem;
+    fs::path path = o.path.empty()
+        ? fs::temp_directory_path() / ("zvec_c_bench_" + std::to_string(Clock::now().time_since_epoch().count()))
+        : fs::path(o.path);
+    if (fs::exists(path)) fail("collection path " + path.string() + " already exists");
+
+    zvec_metrics_reset();
+
+    std::vector<QueryRun> runs;
+    std::vector<std::vector<int64_t>> hits;
+    Bench bench(o);
+    bench.set_dataset(base.dim, base.count);
+    bench.open(path.string());
+    bench.load(base);
+    hits = bench.collect_hits(queries);
+    for (int threads : o.threads) runs.push_back(bench.run_queries(queries, threads));
+    bench.run_fetch(o.fetch);
+
+    std::vector<zvec_op_metrics_t> native(ZVEC_OP_COUNT);
+    check(zvec_metrics_snapshot(native.data(), native.size()), "metrics snapshot");
+
+    bool brute = o.gt_path.empty();
+    auto truth = brute
+        ? brute_force(base, queries, o.metric, static_cast<size_t>(o.topk), bench.max_threads())
+        : load_ivecs(o.gt_path, queries.count, static_cast<size_t>(o.topk));
+
+    std::string j = "{\n";
+    j += "  \"version\": " + json_string(zvec_version()) + ",\n";
+    j += "  \"config\": {\"index\": " + json_string(index_name(o.index)) +
+         ", \"metric\": " + json_string(metric_name(o.metric)) +
+         ", \"topk\": " + std::to_string(o.topk) + ", \"m\": " + std::to_string(o.m) +
+         ", \"ef_construction\": " + std::to_string(o.ef_construction) +
+         ", \"ef\": " + std::to_string(o.ef) + ", \"n_lists\": " + std::to_string(o.n_lists) +
+         ", \"n_probe\": " + std::to_string(o.n_probe) + ", \"batch\": " + std::to_string(o.batch) +
+         ", \"seed\": " + std::to_string(o.seed) + "},\n";
+    j += "  \"dataset\": {\"source\": " + json_string(o.base_path.empty() ? "synthetic" : o.base_path) +
+         ", \"dim\": " + std::to_string(base.dim) + ", \"count\": " + std::to_string(base.count) +
+         ", \"queries\": " + std::to_string(queries.count) + "},\n";
+    j += "  \"insert\": {\"docs\": " + std::to_string(base.count) +
+         ", \"seconds\": " + json_number(bench.insert_seconds_) +
+         ", \"docs_per_sec\": " + json_number(per_second(base.count, bench.insert_seconds_)) +
+         ", \"batch\": {" + json_latency(bench.insert_latency_) + "}},\n";
+    j += "  \"index_build\": {\"seconds\": " + json_number(bench.build_seconds_) + "},\n";
+    j += "  \"query\": [";
+    for (size_t i = 0; i < runs.size(); i++) {
+        const QueryRun& r = runs[i];
+        j += std::string(i == 0 ? "\n" : ",\n") + "    {\"threads\": " + std::to_string(r.threads) +
+             ", \"queries\": " + std::to_string(r.queries) + ", \"seconds\": " + json_number(r.seconds) +
+             ", \"qps\": " + json_number(per_second(r.queries, r.seconds)) + ", " + json_latency(r.latency) + "}";
+    }
+    j += "\n  ],\n";
+    j += "  \"fetch\": {\"docs\": " + std::to_string(bench.fetch_docs_) +
+         ", \"batch_size\": " + std::to_string(o.fetch_batch) +
+         ", \"seconds\": " + json_number(bench.fetch_seconds_) +
+         ", \"docs_per_sec\": " + json_number(per_second(bench.fetch_docs_, bench.fetch_seconds_)) +
+         ", \"batch\": {" + json_latency(bench.fetch_latency_) + "}},\n";
+    j += "  \"recall\": {\"k\": " + std::to_string(o.topk) +
+         ", \"ground_truth\": " + json_string(brute ? "brute_force" : "ivecs") +
+         ", \"value\": " + json_number(recall(hits, truth)) + "},\n";
+    j += "  \"native\": {";
+    bool first = true;
+    for (int32_t op = 0; op < ZVEC_OP_COUNT; op++) {
+        const zvec_op_metrics_t& m = native[op];
+        if (m.count == 0) continue;
+        j += std::string(first ? "\n" : ",\n") + "    " + json_string(zvec_metrics_op_name(op)) +
+             ": {\"count\": " + std::to_string(m.count) + ", \"errors\": " + std::to_string(m.errors) +
+             ", \"p50_us\": " + json_number(m.p50_ns / 1000.0) +
+             ", \"p99_us\": " + json_number(m.p99_ns / 1000.0) +
+             ", \"max_us\": " + json_number(m.max_ns / 1000.0) + "}";
+        first = false;
+    }
+    j += first ? "}\n" : "\n  }\n";
+    j += "}\n";
+
+    if (o.output.empty()) {
+        std::fputs(j.c_str(), stdout);
+    } else {
+        FILE* f = std::fopen(o.output.c_str(), "w");
+        if (!f) fail("cannot write " + o.output);
+        std::fputs(j.c_str(), f);
+        std::fclose(f);
+    }
+
+    bench.close();
+    if (!o.keep) {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    }
+    return 0;
+}
@@ -6,7 +6,7 @@ namespace Zvec.Net.Attributes;
 /// Marks a property as a vector field in a document.
 /// </summary>
 /// <remarks>
-/// Supported types: float[], double[], Half[], sbyte[], and <see cref="Models.SparseVector"/>.
+/// Supported types: float[], double[], Half[], sbyte[], short[], and <see cref="Models.SparseVector"/>.
 /// The dimension must match the actual vector length at runtime.
 /// </remarks>
 [AttributeUsage(AttributeTargets.Property, AllowMultiple = false, Inherited = true)]
@@ -44,6 +44,12 @@ public sealed class Collection : IVectorCollection
     /// </summary>
     public CollectionSchema Schema => _schema;
 
+    /// <summary>
+    /// Gets whether the collection is read-only. Untyped collections are always opened for writing;
+    /// use <see cref="OpenReadOnly{T}"/> for read-only access.
+    /// </summary>
+    public bool IsReadOnly => false;
+
     /// <summary>
     /// Gets statistics about the collection.
     /// </summary>
@@ -56,6 +62,28 @@ public sealed class Collection : IVectorCollection
         }
     }
 
+    /// <summary>
+    /// Gets the hit, miss and eviction counts of the native query result cache.
+    /// </summary>
+    /// <remarks>
+    /// All zero unless the collection was opened with <see cref="CollectionOptions.QueryCacheSize"/> set.
+    /// </remarks>
+    public QueryCacheStats QueryCacheStats
+    {
+        get
+        {
+            ThrowIfDisposed();
+            _native.zvec_collection_get_query_cache_stats(_handle, out var stats).ThrowIfError("Query cache stats");
+            return new QueryCacheStats
+            {
+                Hits = (long)stats.Hits,
+                Misses = (long)stats.Misses,
+                Evictions = (long)stats.Evictions,
+                Entries = (long)stats.Entries
+            };
+        }
+    }
+
     // ===== Generic Factory Methods =====
 
     /// <summary>
@@ -84,6 +112,19 @@ public sealed class Collection : IVectorCollection
         return Collection<T>.Open(path, options);
     }
 
+    /// <summary>
+    /// Opens an existing typed vector collection for queries only.
+    /// </summary>
+    /// <typeparam name="T">The document type.</typeparam>
+    /// <param name="path">The filesystem path where the collection is stored.</param>
+    /// <param name="options">Optional collection configuration.</param>
+    /// <returns>A read-only typed collection instance.</returns>
+    public static Collection<T> OpenReadOnly<T>(string path, CollectionOptions? options = null)
+        where T : class, IDocument, new()
+    {
+        return Collection<T>.OpenReadOnly(path, options);
+    }
+
     // ===== Non-Generic Factory Methods =====
 
     /// <summary>
@@ -105,7 +146,9 @@ public sealed class Collection : IVectorCollection
         var nativeOptions = NativeCollectionOptions.Create(
             options?.SegmentMaxDocs ?? 1_000_000,
             options?.IndexBuildParallel ?? 0,
-            options?.AutoFlush ?? true);
+            options?.AutoFlush ?? false,
+            options?.QueryParallel ?? 0,
+            options?.QueryCacheSize ?? 0);
 
         var nativeSchemaPtr = CreateNativeSchema(schema, native);
         try
@@ -146,7 +189,9 @@ public sealed class Collection : IVectorCollection
         var nativeOptions = NativeCollectionOptions.Create(
             options?.SegmentMaxDocs ?? 1_000_000,
             options?.IndexBuildParallel ?? 0,
-            options?.AutoFlush ?? true);
+            options?.AutoFlush ?? false,
+            options?.QueryParallel ?? 0,
+            options?.QueryCacheSize ?? 0);
 
         var status = native.zvec_collection_open(path, in nativeOptions, out var handle);
 
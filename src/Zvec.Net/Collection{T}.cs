@@ -1,8 +1,10 @@
 using System.Collections.Concurrent;
 using System.Linq.Expressions;
 using System.Reflection;
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using Zvec.Net.Attributes;
+using Zvec.Net.Diagnostics;
 using Zvec.Net.Index;
 using Zvec.Net.Internal;
 using Zvec.Net.Models;
@@ -21,18 +23,43 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
 {
     private readonly INativeMethods _native;
     private IntPtr _handle;
+    private IntPtr _docBatch;
+    private ResolvedField[]? _writeFields;
     private readonly CollectionSchema _schema;
     private volatile bool _disposed;
 
     private static readonly ConcurrentDictionary<Type, PropertyInfo[]> PropertyCache = new();
     private static readonly ConcurrentDictionary<Type, Dictionary<string, PropertyInfo>> VectorPropertyCache = new();
     private static readonly ConcurrentDictionary<Type, Dictionary<string, PropertyInfo>> FieldPropertyCache = new();
+    private static readonly TimeSpan WarmupPollInterval = TimeSpan.FromMilliseconds(100);
 
-    private Collection(IntPtr handle, CollectionSchema schema, INativeMethods native)
+    /// <summary>
+    /// Minimum batch size for which inserts and upserts use the columnar native entry points.
+    /// </summary>
+    internal const int ColumnarBatchThreshold = 1024;
+
+    /// <summary>
+    /// A document property bound to its native field id; <see cref="Precision"/> is null for scalar fields.
+    /// </summary>
+    private readonly record struct ResolvedField(string Name, IntPtr Id, PropertyInfo Property, VectorPrecision? Precision);
+
+    private delegate NativeStatus ColumnarOperation(IntPtr handle, in NativeColumnBatch batch);
+
+    private delegate NativeStatus ColumnarAsyncOperation(IntPtr handle, in NativeColumnBatch batch, IntPtr callback, IntPtr userData, out IntPtr op);
+
+    private delegate NativeStatus DocumentAsyncOperation(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op);
+
+    private delegate NativeStatus ColumnarStatusOperation(IntPtr handle, in NativeColumnBatch batch, NativeDocStatus[] statuses, out nuint failed);
+
+    private delegate NativeStatus DocumentStatusOperation(IntPtr handle, IntPtr batch, NativeDocStatus[] statuses, out nuint failed);
+
+    private Collection(IntPtr handle, CollectionSchema schema, INativeMethods native, bool readOnly = false, bool snapshot = false)
     {
         _handle = handle;
         _schema = schema;
         _native = native;
+        IsReadOnly = readOnly || snapshot;
+        IsSnapshot = snapshot;
     }
 
     /// <summary>
@@ -53,6 +80,16 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     /// </summary>
     public CollectionSchema Schema => _schema;
 
+    /// <summary>
+    /// Gets whether the collection was opened with <see cref="OpenReadOnly(string, CollectionOptions?)"/>.
+    /// </summary>
+    public bool IsReadOnly { get; }
+
+    /// <summary>
+    /// Gets whether the collection is a snapshot created with <see cref="CreateSnapshot"/>.
+    /// </summary>
+    public bool IsSnapshot { get; }
+
     /// <summary>
     /// Gets statistics about the collection.
     /// </summary>
@@ -65,6 +102,28 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
         }
     }
 
+    /// <summary>
+    /// Gets the hit, miss and eviction counts of the native query result cache.
+    /// </summary>
+    /// <remarks>
+    /// All zero unless the collection was opened with <see cref="CollectionOptions.QueryCacheSize"/> set.
+    /// </remarks>
+    public QueryCacheStats QueryCacheStats
+    {
+        get
+        {
+            ThrowIfDisposed();
+            _native.zvec_collection_get_query_cache_stats(_handle, out var stats).ThrowIfError("Query cache stats");
+            return new QueryCacheStats
+            {
+                Hits = (long)stats.Hits,
+                Misses = (long)stats.Misses,
+                Evictions = (long)stats.Evictions,
+                Entries = (long)stats.Entries
+            };
+        }
+    }
+
     // ===== Factory Methods =====
 
     /// <summary>
@@ -139,6 +198,43 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
         return new Collection<T>(handle, schema, native);
     }
 
+    /// <summary>
+    /// Opens an existing vector collection for queries only.
+    /// </summary>
+    /// <remarks>
+    /// Segment and index files are memory-mapped shared and read-only, so processes that open the
+    /// same collection share one copy through the page cache, and no write path is set up. Writes,
+    /// flushes, optimizes and index changes throw. The collection sees the data published when it
+    /// was opened; call <see cref="Refresh"/> to pick up segments the writer has flushed since.
+    /// </remarks>
+    /// <param name="path">The filesystem path where the collection is stored.</param>
+    /// <param name="options">Optional collection configuration; write-side settings are ignored.</param>
+    /// <returns>A read-only collection instance.</returns>
+    /// <exception cref="ArgumentNullException">Thrown when path is null or empty.</exception>
+    /// <exception cref="ZvecException">Thrown when opening the collection fails.</exception>
+    public static Collection<T> OpenReadOnly(string path, CollectionOptions? options = null)
+    {
+        return OpenReadOnly(path, options, NativeMethodsWrapper.Instance);
+    }
+
+    internal static Collection<T> OpenReadOnly(string path, CollectionOptions? options, INativeMethods native)
+    {
+        ThrowHelper.ThrowIfNullOrEmpty(path, nameof(path));
+
+        var nativeOptions = CreateNativeOptions(options);
+        var status = native.zvec_collection_open_readonly(path, in nativeOptions, out var handle);
+
+        if (!status.IsOk)
+        {
+            throw new ZvecException((StatusCode)status.Code, status.GetMessage() ?? "Failed to open collection");
+        }
+
+        var schemaPtr = native.zvec_collection_get_schema(handle);
+        var schema = NativeSchemaHelper.ReadSchemaFromNative(native, schemaPtr);
+
+        return new Collection<T>(handle, schema, native, readOnly: true);
+    }
+
     // ===== Insert =====
 
     /// <summary>
@@ -153,30 +249,47 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     /// </summary>
     /// <param name="documents">The documents to insert.</param>
     /// <returns>A status indicating success or failure.</returns>
+    /// <remarks>
+    /// Batches of 1,024 or more documents are sent to the native layer
+    /// as one columnar batch instead of one native document per row.
+    /// </remarks>
     public Status Insert(IEnumerable<T> documents)
     {
         ThrowIfDisposed();
+        using var timer = ZvecMetrics.Time("insert");
         var docList = documents.ToList();
         if (docList.Count == 0) return Status.Ok;
 
-        return ExecuteDocumentOperation(docList, (handle, docs, count) =>
-            _native.zvec_collection_insert(handle, docs, count));
+        if (TryExecuteColumnarOperation(docList, _native.zvec_collection_insert_columnar, out var columnarStatus))
+        {
+            return columnarStatus;
+        }
+
+        return ExecuteDocumentOperation(docList, _native.zvec_collection_insert_doc_batch);
     }
 
     /// <summary>
     /// Asynchronously inserts documents into the collection.
     /// </summary>
     /// <remarks>
-    /// This method wraps the synchronous operation in Task.Run. The underlying native library
-    /// does not provide true async I/O. Use this for offloading to background threads, not for
-    /// improving I/O scalability.
+    /// The operation is queued on the collection's native worker pool and the task completes from
+    /// the native completion callback, so no managed thread is blocked while it runs. Cancellation
+    /// only skips operations that have not started yet.
     /// </remarks>
     /// <param name="documents">The documents to insert.</param>
     /// <param name="cancellationToken">A cancellation token.</param>
     /// <returns>A task representing the asynchronous operation.</returns>
     public Task<Status> InsertAsync(IEnumerable<T> documents, CancellationToken cancellationToken = default)
     {
-        return Task.Run(() => Insert(documents), cancellationToken);
+        ThrowIfDisposed();
+        var docList = documents.ToList();
+        if (docList.Count == 0) return Task.FromResult(Status.Ok);
+
+        return ExecuteWriteAsync(
+            docList,
+            _native.zvec_collection_insert_columnar_async,
+            _native.zvec_collection_insert_async,
+            cancellationToken);
     }
 
     // ===== Upsert =====
@@ -193,30 +306,47 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     /// </summary>
     /// <param name="documents">The documents to upsert.</param>
     /// <returns>A status indicating success or failure.</returns>
+    /// <remarks>
+    /// Batches of 1,024 or more documents are sent to the native layer
+    /// as one columnar batch instead of one native document per row.
+    /// </remarks>
     public Status Upsert(IEnumerable<T> documents)
     {
         ThrowIfDisposed();
+        using var timer = ZvecMetrics.Time("upsert");
         var docList = documents.ToList();
         if (docList.Count == 0) return Status.Ok;
 
-        return ExecuteDocumentOperation(docList, (handle, docs, count) =>
-            _native.zvec_collection_upsert(handle, docs, count));
+        if (TryExecuteColumnarOperation(docList, _native.zvec_collection_upsert_columnar, out var columnarStatus))
+        {
+            return columnarStatus;
+        }
+
+        return ExecuteDocumentOperation(docList, _native.zvec_collection_upsert_doc_batch);
     }
 
     /// <summary>
     /// Asynchronously upserts documents into the collection.
     /// </summary>
     /// <remarks>
-    /// This method wraps the synchronous operation in Task.Run. The underlying native library
-    /// does not provide true async I/O. Use this for offloading to background threads, not for
-    /// improving I/O scalability.
+    /// The operation is queued on the collection's native worker pool and the task completes from
+    /// the native completion callback, so no managed thread is blocked while it runs. Cancellation
+    /// only skips operations that have not started yet.
     /// </remarks>
     /// <param name="documents">The documents to upsert.</param>
     /// <param name="cancellationToken">A cancellation token.</param>
     /// <returns>A task representing the asynchronous operation.</returns>
     public Task<Status> UpsertAsync(IEnumerable<T> documents, CancellationToken cancellationToken = default)
     {
-        return Task.Run(() => Upsert(documents), cancellationToken);
+        ThrowIfDisposed();
+        var docList = documents.ToList();
+        if (docList.Count == 0) return Task.FromResult(Status.Ok);
+
+        return ExecuteWriteAsync(
+            docList,
+            _native.zvec_collection_upsert_columnar_async,
+            _native.zvec_collection_upsert_async,
+            cancellationToken);
     }
 
     // ===== Update =====
@@ -236,27 +366,31 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     public Status Update(IEnumerable<T> documents)
     {
         ThrowIfDisposed();
+        using var timer = ZvecMetrics.Time("update");
         var docList = documents.ToList();
         if (docList.Count == 0) return Status.Ok;
 
-        return ExecuteDocumentOperation(docList, (handle, docs, count) =>
-            _native.zvec_collection_update(handle, docs, count));
+        return ExecuteDocumentOperation(docList, _native.zvec_collection_update_doc_batch);
     }
 
     /// <summary>
     /// Asynchronously updates existing documents in the collection.
     /// </summary>
     /// <remarks>
-    /// This method wraps the synchronous operation in Task.Run. The underlying native library
-    /// does not provide true async I/O. Use this for offloading to background threads, not for
-    /// improving I/O scalability.
+    /// The operation is queued on the collection's native worker pool and the task completes from
+    /// the native completion callback, so no managed thread is blocked while it runs. Cancellation
+    /// only skips operations that have not started yet.
     /// </remarks>
     /// <param name="documents">The documents to update.</param>
     /// <param name="cancellationToken">A cancellation token.</param>
     /// <returns>A task representing the asynchronous operation.</returns>
     public Task<Status> UpdateAsync(IEnumerable<T> documents, CancellationToken cancellationToken = default)
     {
-        return Task.Run(() => Update(documents), cancellationToken);
+        ThrowIfDisposed();
+        var docList = documents.ToList();
+        if (docList.Count == 0) return Task.FromResult(Status.Ok);
+
+        return ExecuteWriteAsync(docList, null, _native.zvec_collection_update_async, cancellationToken);
     }
 
     // ===== Delete =====
@@ -276,6 +410,7 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     public Status Delete(IEnumerable<string> ids)
     {
         ThrowIfDisposed();
+        using var timer = ZvecMetrics.Time("delete");
         var idList = ids.ToList();
         if (idList.Count == 0) return Status.Ok;
 
@@ -289,16 +424,25 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     /// Asynchronously deletes documents by their IDs.
     /// </summary>
     /// <remarks>
-    /// This method wraps the synchronous operation in Task.Run. The underlying native library
-    /// does not provide true async I/O. Use this for offloading to background threads, not for
-    /// improving I/O scalability.
+    /// The operation is queued on the collection's native worker pool and the task completes from
+    /// the native completion callback, so no managed thread is blocked while it runs. Cancellation
+    /// only skips operations that have not started yet.
     /// </remarks>
     /// <param name="ids">The IDs of documents to delete.</param>
     /// <param name="cancellationToken">A cancellation token.</param>
     /// <returns>A task representing the asynchronous operation.</returns>
     public Task<Status> DeleteAsync(IEnumerable<string> ids, CancellationToken cancellationToken = default)
     {
-        return Task.Run(() => Delete(ids), cancellationToken);
+        ThrowIfDisposed();
+        var idArray = ids.ToArray();
+        if (idArray.Length == 0) return Task.FromResult(Status.Ok);
+
+        return NativeAsyncOperation<Status>.Run(
+            _native,
+            (IntPtr callback, IntPtr userData, out IntPtr op) =>
+                _native.zvec_collection_delete_async(_handle, idArray, (nuint)idArray.Length, callback, userData, out op),
+            static (status, _) => status.ToStatus(),
+            cancellationToken);
     }
 
     /// <summary>
@@ -329,6 +473,125 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
         return Task.Run(() => DeleteByFilter(filter), cancellationToken);
     }
 
+    // ===== Per-Document Write Status =====
+
+    /// <summary>
+    /// Inserts documents and reports each document's outcome instead of the first failure.
+    /// </summary>
+    /// <remarks>
+    /// A failed document (for example a duplicate id) does not stop the others, and the written
+    /// ones are flushed as usual. Retry only <see cref="BatchWriteResult.SelectFailed{TItem}"/>.
+    /// </remarks>
+    /// <param name="documents">The documents to insert.</param>
+    /// <returns>The overall status and one status per document, in input order.</returns>
+    public BatchWriteResult InsertWithStatus(IEnumerable<T> documents)
+    {
+        ThrowIfDisposed();
+        using var timer = ZvecMetrics.Time("insert");
+        return ExecuteWriteWithStatus(
+            documents.ToList(),
+            _native.zvec_collection_insert_columnar_with_status,
+            _native.zvec_collection_insert_doc_batch_with_status);
+    }
+
+    /// <summary>
+    /// Upserts documents and reports each document's outcome instead of the first failure.
+    /// </summary>
+    /// <param name="documents">The documents to upsert.</param>
+    /// <returns>The overall status and one status per document, in input order.</returns>
+    public BatchWriteResult UpsertWithStatus(IEnumerable<T> documents)
+    {
+        ThrowIfDisposed();
+        using var timer = ZvecMetrics.Time("upsert");
+        return ExecuteWriteWithStatus(
+            documents.ToList(),
+            _native.zvec_collection_upsert_columnar_with_status,
+            _native.zvec_collection_upsert_doc_batch_with_status);
+    }
+
+    /// <summary>
+    /// Updates existing documents and reports each document's outcome instead of the first failure.
+    /// </summary>
+    /// <param name="documents">The documents to update.</param>
+    /// <returns>The overall status and one status per document, in input order.</returns>
+    public BatchWriteResult UpdateWithStatus(IEnumerable<T> documents)
+    {
+        ThrowIfDisposed();
+        using var timer = ZvecMetrics.Time("update");
+        return ExecuteWriteWithStatus(documents.ToList(), null, _native.zvec_collection_update_doc_batch_with_status);
+    }
+
+    /// <summary>
+    /// Deletes documents by their IDs and reports each ID's outcome instead of the first failure.
+    /// </summary>
+    /// <param name="ids">The IDs of documents to delete.</param>
+    /// <returns>The overall status and one status per ID, in input order.</returns>
+    public BatchWriteResult DeleteWithStatus(IEnumerable<string> ids)
+    {
+        ThrowIfDisposed();
+        using var timer = ZvecMetrics.Time("delete");
+        var idArray = ids.ToArray();
+        if (idArray.Length == 0) return new BatchWriteResult();
+
+        var statuses = new NativeDocStatus[idArray.Length];
+        var status = _native.zvec_collection_delete_with_status(_handle, idArray, (nuint)idArray.Length, statuses, out _);
+        return CreateBatchWriteResult(status, statuses);
+    }
+
+    private BatchWriteResult ExecuteWriteWithStatus(
+        IReadOnlyList<T> documents,
+        ColumnarStatusOperation? columnarOperation,
+        DocumentStatusOperation documentOperation)
+    {
+        if (documents.Count == 0) return new BatchWriteResult();
+
+        var statuses = new NativeDocStatus[documents.Count];
+        NativeStatus status = default;
+        if (columnarOperation != null && documents.Count >= ColumnarBatchThreshold)
+        {
+            using var batch = TryCreateColumnarBatch(documents);
+            if (batch != null)
+            {
+                var nativeBatch = batch.Build();
+                status = columnarOperation(_handle, in nativeBatch, statuses, out _);
+                return CreateBatchWriteResult(status, statuses);
+            }
+        }
+
+        ExecuteDocumentOperation(documents, (handle, batch) => status = documentOperation(handle, batch, statuses, out _));
+        return CreateBatchWriteResult(status, statuses);
+    }
+
+    /// <summary>
+    /// Converts native per-document statuses; must run on the thread that made the write,
+    /// since the native message table is per thread.
+    /// </summary>
+    private BatchWriteResult CreateBatchWriteResult(NativeStatus status, NativeDocStatus[] statuses)
+    {
+        var items = new Status[statuses.Length];
+        var failed = new List<int>();
+        var messages = new Dictionary<int, string>();
+        for (int i = 0; i < statuses.Length; i++)
+        {
+            var doc = statuses[i];
+            if (doc.Code == 0)
+            {
+                items[i] = Status.Ok;
+                continue;
+            }
+
+            if (!messages.TryGetValue(doc.MessageIndex, out var message))
+            {
+                message = Marshal.PtrToStringUTF8(_native.zvec_write_status_message(doc.MessageIndex)) ?? string.Empty;
+                messages[doc.MessageIndex] = message;
+            }
+            items[i] = Status.From((StatusCode)doc.Code, message);
+            failed.Add(i);
+        }
+
+        return new BatchWriteResult { Status = status.ToStatus(), Items = items, FailedIndices = failed };
+    }
+
     // ===== Query =====
 
     /// <summary>
@@ -361,9 +624,9 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     /// Asynchronously executes a vector similarity query.
     /// </summary>
     /// <remarks>
-    /// This method wraps the synchronous operation in Task.Run. The underlying native library
-    /// does not provide true async I/O. Use this for offloading to background threads, not for
-    /// improving I/O scalability.
+    /// The operation is queued on the collection's native worker pool and the task completes from
+    /// the native completion callback, so no managed thread is blocked while it runs. Cancellation
+    /// only skips operations that have not started yet.
     /// </remarks>
     /// <param name="vectorQuery">The vector query to execute.</param>
     /// <param name="options">Optional query options.</param>
@@ -371,19 +634,42 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     /// <returns>A task representing the asynchronous operation.</returns>
     public Task<IReadOnlyList<T>> QueryAsync(VectorQuery vectorQuery, QueryOptions? options = null, CancellationToken cancellationToken = default)
     {
-        return Task.Run(() => Query(vectorQuery, options), cancellationToken);
+        ThrowIfDisposed();
+        options ??= QueryOptions.Default;
+
+        vectorQuery.Validate();
+
+        return ExecuteQueryAsync(new[] { vectorQuery }, options, cancellationToken);
     }
 
-    internal IReadOnlyList<T> ExecuteQuery(IReadOnlyList<VectorQuery> vectorQueries, QueryOptions options)
+    /// <summary>
+    /// Executes one similarity search per query vector against the same field.
+    /// </summary>
+    /// <remarks>
+    /// All searches share <paramref name="options"/> and <paramref name="param"/> and run in a
+    /// single native call, spread across the collection's query worker pool
+    /// (see <see cref="CollectionOptions.QueryParallel"/>). The field must store float32
+    /// vectors of the given dimension; search other precisions with <see cref="Query(VectorQuery, QueryOptions?)"/>.
+    /// </remarks>
+    /// <param name="fieldName">The vector field to search.</param>
+    /// <param name="vectors">The query vectors; all must have the same dimension.</param>
+    /// <param name="options">Optional query options applied to every search.</param>
+    /// <param name="param">Optional index query parameters applied to every search.</param>
+    /// <returns>One result list per query vector, in input order.</returns>
+    public IReadOnlyList<IReadOnlyList<T>> QueryBatch(string fieldName, IReadOnlyList<float[]> vectors, QueryOptions? options = null, IndexQueryParam? param = null)
     {
         ThrowIfDisposed();
+        ThrowHelper.ThrowIfNullOrEmpty(fieldName, nameof(fieldName));
+        ThrowHelper.ThrowIfNull(vectors, nameof(vectors));
+        options ??= QueryOptions.Default;
 
-        if (vectorQueries.Count == 0)
+        if (vectors.Count == 0)
         {
-            return new List<T>();
+            return Array.Empty<IReadOnlyList<T>>();
         }
 
-        var firstQuery = vectorQueries[0];
+        using var timer = ZvecMetrics.Time("query.batch");
+        var matrix = FlattenQueryVectors(vectors, out var dimension);
 
         var queryPtr = _native.zvec_query_create();
         if (queryPtr == IntPtr.Zero)
@@ -393,8 +679,8 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
 
         try
         {
-            BuildNativeQuery(queryPtr, firstQuery, options);
-            return ExecuteNativeQuery(queryPtr);
+            BuildNativeQuery(queryPtr, new VectorQuery(fieldName) { Param = param }, options);
+            return ExecuteNativeQueryBatch(queryPtr, matrix, vectors.Count, dimension, options.IncludeVectors);
         }
         finally
         {
@@ -402,109 +688,438 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
         }
     }
 
-    private void BuildNativeQuery(IntPtr queryPtr, VectorQuery vectorQuery, QueryOptions options)
+    /// <summary>
+    /// Asynchronously executes one similarity search per query vector against the same field.
+    /// </summary>
+    /// <remarks>
+    /// This method wraps the synchronous operation in Task.Run. The underlying native library
+    /// does not provide true async I/O. Use this for offloading to background threads, not for
+    /// improving I/O scalability.
+    /// </remarks>
+    /// <param name="fieldName">The vector field to search.</param>
+    /// <param name="vectors">The query vectors; all must have the same dimension.</param>
+    /// <param name="options">Optional query options applied to every search.</param>
+    /// <param name="param">Optional index query parameters applied to every search.</param>
+    /// <param name="cancellationToken">A cancellation token.</param>
+    /// <returns>A task representing the asynchronous operation.</returns>
+    public Task<IReadOnlyList<IReadOnlyList<T>>> QueryBatchAsync(string fieldName, IReadOnlyList<float[]> vectors, QueryOptions? options = null, IndexQueryParam? param = null, CancellationToken cancellationToken = default)
     {
-        _native.zvec_query_set_topk(queryPtr, options.TopK);
-        _native.zvec_query_set_field_name(queryPtr, vectorQuery.FieldName);
+        return Task.Run(() => QueryBatch(fieldName, vectors, options, param), cancellationToken);
+    }
 
-        SetQueryVector(queryPtr, vectorQuery.Vector);
+    /// <summary>
+    /// Prepares a single-vector query shape that can be executed repeatedly with different vectors.
+    /// </summary>
+    /// <remarks>
+    /// The field, <paramref name="options"/> and <paramref name="param"/> are marshalled and
+    /// resolved once; each <see cref="IPreparedQuery{T}.Execute"/> passes only the query vector,
+    /// read in place from the caller's memory. The prepared query can be executed from several
+    /// threads at once and must be disposed before the collection.
+    /// </remarks>
+    /// <param name="fieldName">The dense vector field to search.</param>
+    /// <param name="options">Optional query options applied to every execution.</param>
+    /// <param name="param">Optional index query parameters applied to every execution.</param>
+    /// <returns>The prepared query.</returns>
+    public IPreparedQuery<T> Prepare(string fieldName, QueryOptions? options = null, IndexQueryParam? param = null)
+    {
+        ThrowIfDisposed();
+        ThrowHelper.ThrowIfNullOrEmpty(fieldName, nameof(fieldName));
+        options ??= QueryOptions.Default;
 
-        if (!string.IsNullOrEmpty(options.Filter))
+        var queryPtr = _native.zvec_query_create();
+        if (queryPtr == IntPtr.Zero)
         {
-            _native.zvec_query_set_filter(queryPtr, options.Filter);
+            throw new ZvecException(StatusCode.InternalError, "Failed to create query");
         }
 
-        _native.zvec_query_set_include_vector(queryPtr, options.IncludeVectors ? 1 : 0);
-
-        SetQueryOutputFields(queryPtr, options.OutputFields);
-        SetQueryParamOptions(queryPtr, vectorQuery.Param);
-    }
-
-    private void SetQueryVector(IntPtr queryPtr, float[]? vector)
-    {
-        if (vector == null || vector.Length == 0) return;
-
-        var handle = GCHandle.Alloc(vector, GCHandleType.Pinned);
         try
         {
-            unsafe
-            {
-                var ptr = (float*)handle.AddrOfPinnedObject();
-                _native.zvec_query_set_vector(queryPtr, in *ptr, (nuint)vector.Length);
-            }
+            BuildNativeQuery(queryPtr, new VectorQuery(fieldName) { Param = param }, options);
+            _native.zvec_collection_prepare_query(_handle, queryPtr, out var preparedPtr).ThrowIfError("Prepare");
+            return new PreparedQuery<T>(this, _native, preparedPtr, options.IncludeVectors);
         }
         finally
         {
-            handle.Free();
+            _native.zvec_query_destroy(queryPtr);
         }
     }
 
-    private void SetQueryOutputFields(IntPtr queryPtr, IReadOnlyList<string>? outputFields)
+    internal unsafe IReadOnlyList<T> ExecutePreparedQuery(IntPtr preparedPtr, ReadOnlySpan<float> vector, bool includeVectors)
     {
-        if (outputFields == null || outputFields.Count == 0) return;
+        ThrowIfDisposed();
+        if (vector.IsEmpty)
+        {
+            throw new ArgumentException("Query vector cannot be empty", nameof(vector));
+        }
 
-        var fieldPtrs = new IntPtr[outputFields.Count];
-        try
+        using var timer = ZvecMetrics.Time("prepared.execute");
+        IntPtr resultPtr;
+        fixed (float* ptr = vector)
         {
-            for (int i = 0; i < outputFields.Count; i++)
-            {
-                fieldPtrs[i] = Marshal.StringToHGlobalAnsi(outputFields[i]);
-            }
+            _native.zvec_prepared_query_execute(preparedPtr, in *ptr, (nuint)vector.Length, out resultPtr)
+                .ThrowIfError("Query");
+        }
 
-            unsafe
-            {
-                fixed (IntPtr* ptr = fieldPtrs)
-                {
-                    _native.zvec_query_set_output_fields(queryPtr, (IntPtr)ptr, (nuint)fieldPtrs.Length);
-                }
-            }
+        try
+        {
+            return ReadResults(resultPtr, includeVectors);
         }
         finally
         {
-            foreach (var ptr in fieldPtrs)
-            {
-                if (ptr != IntPtr.Zero)
-                {
-                    Marshal.FreeHGlobal(ptr);
-                }
-            }
+            _native.zvec_result_destroy(resultPtr);
         }
     }
 
-    private void SetQueryParamOptions(IntPtr queryPtr, IndexQueryParam? param)
+    internal IReadOnlyList<T> ExecuteQuery(IReadOnlyList<VectorQuery> vectorQueries, QueryOptions options)
     {
-        switch (param)
+        ThrowIfDisposed();
+
+        if (vectorQueries.Count == 0)
         {
-            case HnswQueryParam hnswParam:
-                _native.zvec_query_set_ef_search(queryPtr, hnswParam.Ef);
-                break;
-            case IvfQueryParam ivfParam:
-                _native.zvec_query_set_n_probe(queryPtr, ivfParam.NProbe);
-                break;
+            return new List<T>();
         }
-    }
 
-    private IReadOnlyList<T> ExecuteNativeQuery(IntPtr queryPtr)
-    {
-        var status = _native.zvec_collection_query(_handle, queryPtr, out var resultPtr);
+        if (vectorQueries.Count > 1)
+        {
+            return ExecuteMultiQuery(vectorQueries, options);
+        }
 
-        if (!status.IsOk)
+        var firstQuery = vectorQueries[0];
+
+        using var timer = ZvecMetrics.Time("query");
+        var queryPtr = _native.zvec_query_create();
+        if (queryPtr == IntPtr.Zero)
         {
-            throw new ZvecException((StatusCode)status.Code, status.GetMessage() ?? "Query failed");
+            throw new ZvecException(StatusCode.InternalError, "Failed to create query");
         }
 
         try
         {
-            return ReadResults(resultPtr);
+            BuildNativeQuery(queryPtr, firstQuery, options);
+            return ExecuteNativeQuery(queryPtr, options.IncludeVectors);
         }
         finally
         {
-            _native.zvec_result_destroy(resultPtr);
+            _native.zvec_query_destroy(queryPtr);
         }
     }
 
-    // ===== Fetch =====
-
+    internal Task<IReadOnlyList<T>> ExecuteQueryAsync(IReadOnlyList<VectorQuery> vectorQueries, QueryOptions options, CancellationToken cancellationToken)
+    {
+        ThrowIfDisposed();
+
+        if (vectorQueries.Count != 1)
+        {
+            // Fused multi-vector queries have no native async entry point yet.
+            return Task.Run(() => ExecuteQuery(vectorQueries, options), cancellationToken);
+        }
+
+        var queryPtr = _native.zvec_query_create();
+        if (queryPtr == IntPtr.Zero)
+        {
+            throw new ZvecException(StatusCode.InternalError, "Failed to create query");
+        }
+
+        try
+        {
+            BuildNativeQuery(queryPtr, vectorQueries[0], options);
+
+            // The native side copies the query on submission, so it can be destroyed right after.
+            return NativeAsyncOperation<IReadOnlyList<T>>.Run(
+                _native,
+                (IntPtr callback, IntPtr userData, out IntPtr op) =>
+                    _native.zvec_collection_query_async(_handle, queryPtr, callback, userData, out op),
+                (status, resultPtr) =>
+                {
+                    if (!status.IsOk)
+                    {
+                        throw new ZvecException((StatusCode)status.Code, status.GetMessage() ?? "Query failed");
+                    }
+                    return ReadResults(resultPtr, options.IncludeVectors);
+                },
+                cancellationToken);
+        }
+        finally
+        {
+            _native.zvec_query_destroy(queryPtr);
+        }
+    }
+
+    private IReadOnlyList<T> ExecuteMultiQuery(IReadOnlyList<VectorQuery> vectorQueries, QueryOptions options)
+    {
+        using var timer = ZvecMetrics.Time("query.multi");
+        var reRanker = options.ReRanker ?? new RrfReRanker();
+        var weights = new double[vectorQueries.Count];
+        var fusion = new NativeFusion { TopK = options.TopK };
+
+        switch (reRanker)
+        {
+            case RrfReRanker rrf:
+                fusion.Method = NativeFusion.Rrf;
+                fusion.RrfK = rrf.K;
+                break;
+            case WeightedReRanker weighted:
+                fusion.Method = NativeFusion.Weighted;
+                for (int i = 0; i < vectorQueries.Count; i++)
+                {
+                    weights[i] = weighted.Weights.TryGetValue(vectorQueries[i].FieldName, out var weight)
+                        ? weight
+                        : vectorQueries[i].Weight;
+                }
+                break;
+            default:
+                throw new NotSupportedException($"Reranker '{reRanker.Name}' is not supported");
+        }
+
+        var queryPtrs = new IntPtr[vectorQueries.Count];
+        try
+        {
+            for (int i = 0; i < vectorQueries.Count; i++)
+            {
+                queryPtrs[i] = _native.zvec_query_create();
+                if (queryPtrs[i] == IntPtr.Zero)
+                {
+                    throw new ZvecException(StatusCode.InternalError, "Failed to create query");
+                }
+                BuildNativeQuery(queryPtrs[i], vectorQueries[i], options);
+            }
+
+            IntPtr resultPtr;
+            unsafe
+            {
+                fixed (double* weightsPtr = weights)
+                {
+                    fusion.Weights = (IntPtr)weightsPtr;
+                    fusion.WeightCount = (nuint)weights.Length;
+                    _native.zvec_collection_query_multi(_handle, queryPtrs, (nuint)queryPtrs.Length, in fusion, out resultPtr)
+                        .ThrowIfError("Multi-vector query");
+                }
+            }
+
+            try
+            {
+                return ReadResults(resultPtr, options.IncludeVectors);
+            }
+            finally
+            {
+                _native.zvec_result_destroy(resultPtr);
+            }
+        }
+        finally
+        {
+            foreach (var queryPtr in queryPtrs)
+            {
+                if (queryPtr != IntPtr.Zero)
+                {
+                    _native.zvec_query_destroy(queryPtr);
+                }
+            }
+        }
+    }
+
+    private void BuildNativeQuery(IntPtr queryPtr, VectorQuery vectorQuery, QueryOptions options)
+    {
+        _native.zvec_query_set_topk(queryPtr, options.TopK);
+        _native.zvec_query_set_field_name(queryPtr, vectorQuery.FieldName);
+
+        SetQueryVector(queryPtr, vectorQuery.Vector);
+        SetQueryNativeVector(queryPtr, vectorQuery.NativeVector);
+        SetQuerySparseVector(queryPtr, vectorQuery.SparseVector);
+
+        if (!string.IsNullOrEmpty(options.Filter))
+        {
+            _native.zvec_query_set_filter(queryPtr, options.Filter);
+        }
+
+        _native.zvec_query_set_include_vector(queryPtr, options.IncludeVectors ? 1 : 0);
+
+        SetQueryIdFilter(queryPtr, options);
+        SetQueryOutputFields(queryPtr, options.OutputFields);
+        SetQueryParamOptions(queryPtr, vectorQuery.Param);
+    }
+
+    private void SetQueryIdFilter(IntPtr queryPtr, QueryOptions options)
+    {
+        if (options.AllowedIds != null && options.DeniedIds != null)
+        {
+            throw new ArgumentException("AllowedIds and DeniedIds cannot both be set", nameof(options));
+        }
+
+        if (options.AllowedIds != null)
+        {
+            _native.zvec_query_set_id_filter(queryPtr, options.AllowedIds.Handle, IdSet.AllowMode);
+        }
+        else if (options.DeniedIds != null)
+        {
+            _native.zvec_query_set_id_filter(queryPtr, options.DeniedIds.Handle, IdSet.DenyMode);
+        }
+    }
+
+    private void SetQueryVector(IntPtr queryPtr, float[]? vector)
+    {
+        if (vector == null || vector.Length == 0) return;
+
+        var handle = GCHandle.Alloc(vector, GCHandleType.Pinned);
+        try
+        {
+            unsafe
+            {
+                var ptr = (float*)handle.AddrOfPinnedObject();
+                _native.zvec_query_set_vector(queryPtr, in *ptr, (nuint)vector.Length);
+            }
+        }
+        finally
+        {
+            handle.Free();
+        }
+    }
+
+    private unsafe void SetQueryNativeVector(IntPtr queryPtr, Array? vector)
+    {
+        switch (vector)
+        {
+            case Half[] { Length: > 0 } f16:
+                fixed (Half* ptr = f16) _native.zvec_query_set_vector_f16(queryPtr, in *(ushort*)ptr, (nuint)f16.Length);
+                break;
+            case sbyte[] { Length: > 0 } i8:
+                fixed (sbyte* ptr = i8) _native.zvec_query_set_vector_i8(queryPtr, in *ptr, (nuint)i8.Length);
+                break;
+            case short[] { Length: > 0 } i16:
+                fixed (short* ptr = i16) _native.zvec_query_set_vector_i16(queryPtr, in *ptr, (nuint)i16.Length);
+                break;
+        }
+    }
+
+    private void SetQuerySparseVector(IntPtr queryPtr, SparseVector? vector)
+    {
+        if (vector == null || vector.Count == 0) return;
+
+        unsafe
+        {
+            fixed (uint* indices = vector.IndicesSpan)
+            fixed (float* values = vector.ValuesSpan)
+            {
+                _native.zvec_query_set_sparse_vector(queryPtr, in *indices, in *values, (nuint)vector.Count);
+            }
+        }
+    }
+
+    private void SetQueryOutputFields(IntPtr queryPtr, IReadOnlyList<string>? outputFields)
+    {
+        if (outputFields == null || outputFields.Count == 0) return;
+
+        var fieldPtrs = new IntPtr[outputFields.Count];
+        try
+        {
+            for (int i = 0; i < outputFields.Count; i++)
+            {
+                fieldPtrs[i] = Marshal.StringToHGlobalAnsi(outputFields[i]);
+            }
+
+            unsafe
+            {
+                fixed (IntPtr* ptr = fieldPtrs)
+                {
+                    _native.zvec_query_set_output_fields(queryPtr, (IntPtr)ptr, (nuint)fieldPtrs.Length);
+                }
+            }
+        }
+        finally
+        {
+            foreach (var ptr in fieldPtrs)
+            {
+                if (ptr != IntPtr.Zero)
+                {
+                    Marshal.FreeHGlobal(ptr);
+                }
+            }
+        }
+    }
+
+    private void SetQueryParamOptions(IntPtr queryPtr, IndexQueryParam? param)
+    {
+        if (param == null) return;
+
+        var nativeParams = NativeQueryParams.FromParam(param);
+        _native.zvec_query_set_params(queryPtr, in nativeParams);
+    }
+
+    private IReadOnlyList<T> ExecuteNativeQuery(IntPtr queryPtr, bool includeVectors)
+    {
+        var status = _native.zvec_collection_query(_handle, queryPtr, out var resultPtr);
+
+        if (!status.IsOk)
+        {
+            throw new ZvecException((StatusCode)status.Code, status.GetMessage() ?? "Query failed");
+        }
+
+        try
+        {
+            return ReadResults(resultPtr, includeVectors);
+        }
+        finally
+        {
+            _native.zvec_result_destroy(resultPtr);
+        }
+    }
+
+    private static float[] FlattenQueryVectors(IReadOnlyList<float[]> vectors, out int dimension)
+    {
+        dimension = vectors[0]?.Length ?? 0;
+        if (dimension == 0)
+        {
+            throw new ArgumentException("Query vectors cannot be null or empty", nameof(vectors));
+        }
+
+        var matrix = new float[vectors.Count * dimension];
+        for (int i = 0; i < vectors.Count; i++)
+        {
+            var vector = vectors[i];
+            if (vector == null || vector.Length != dimension)
+            {
+                throw new ArgumentException($"Query vector {i} does not have dimension {dimension}", nameof(vectors));
+            }
+
+            vector.CopyTo(matrix, i * dimension);
+        }
+
+        return matrix;
+    }
+
+    private IReadOnlyList<IReadOnlyList<T>> ExecuteNativeQueryBatch(IntPtr queryPtr, float[] matrix, int queryCount, int dimension, bool includeVectors)
+    {
+        var resultPtrs = new IntPtr[queryCount];
+        var status = _native.zvec_collection_query_batch(
+            _handle, queryPtr, in matrix[0], (nuint)queryCount, (nuint)dimension, resultPtrs);
+
+        if (!status.IsOk)
+        {
+            throw new ZvecException((StatusCode)status.Code, status.GetMessage() ?? "Batch query failed");
+        }
+
+        try
+        {
+            var results = new IReadOnlyList<T>[queryCount];
+            for (int i = 0; i < queryCount; i++)
+            {
+                results[i] = ReadResults(resultPtrs[i], includeVectors);
+            }
+            return results;
+        }
+        finally
+        {
+            foreach (var resultPtr in resultPtrs)
+            {
+                if (resultPtr != IntPtr.Zero)
+                {
+                    _native.zvec_result_destroy(resultPtr);
+                }
+            }
+        }
+    }
+
+    // ===== Fetch =====
+
     /// <summary>
     /// Fetches documents by their IDs.
     /// </summary>
@@ -520,6 +1135,7 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     public IReadOnlyDictionary<string, T> Fetch(IEnumerable<string> ids)
     {
         ThrowIfDisposed();
+        using var timer = ZvecMetrics.Time("fetch");
         var idList = ids.ToList();
         if (idList.Count == 0) return new Dictionary<string, T>();
 
@@ -533,7 +1149,7 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
 
         try
         {
-            var results = ReadResults(resultPtr);
+            var results = ReadResults(resultPtr, includeVectors: true);
             return results.ToDictionary(d => d.Id);
         }
         finally
@@ -558,98 +1174,945 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
         return Task.Run(() => Fetch(ids), cancellationToken);
     }
 
-    // ===== DDL =====
+    // ===== Scan =====
 
     /// <summary>
-    /// Flushes pending writes to disk.
+    /// Reads every document matching the scan filter, one native page at a time.
     /// </summary>
-    public void Flush()
+    /// <param name="options">Optional scan options.</param>
+    /// <returns>The matching documents, in the order the engine returns them.</returns>
+    /// <remarks>
+    /// Memory is O(N) in the number of matches, not constant: when enumeration starts, the native
+    /// layer runs one whole-collection query to collect the key of every match (the engine builds
+    /// each matching document during that pass) and holds the keys until the cursor is released.
+    /// Documents are then fetched one page at a time, in that query's order rather than storage
+    /// order. Documents inserted afterwards are not seen, deleted ones are skipped and updated ones
+    /// are read as of their page. Enumerate to the end or dispose the enumerator to release the native cursor.
+    /// </remarks>
+    public IEnumerable<T> Scan(ScanOptions? options = null)
     {
         ThrowIfDisposed();
-        _native.zvec_collection_flush(_handle).ThrowIfError("Flush");
+        options ??= ScanOptions.Default;
+        ValidateScanOptions(options);
+
+        return ScanPages(options);
     }
 
     /// <summary>
-    /// Asynchronously flushes pending writes to disk.
+    /// Asynchronously reads every document matching the scan filter, one native page at a time.
     /// </summary>
     /// <remarks>
-    /// This method wraps the synchronous operation in Task.Run. The underlying native library
-    /// does not provide true async I/O. Use this for offloading to background threads, not for
-    /// improving I/O scalability.
+    /// Opening the scan and reading each page run in Task.Run, so the caller is never blocked
+    /// while the native layer produces a page. As with <see cref="Scan"/>, opening the scan is an
+    /// O(N) pass that collects the key of every match, and those keys are held in memory for the
+    /// whole enumeration; only the documents are fetched a page at a time.
+    /// Cancellation is observed between pages.
     /// </remarks>
+    /// <param name="options">Optional scan options.</param>
     /// <param name="cancellationToken">A cancellation token.</param>
-    /// <returns>A task representing the asynchronous operation.</returns>
-    public Task FlushAsync(CancellationToken cancellationToken = default)
+    /// <returns>The matching documents, in the order the engine returns them.</returns>
+    public IAsyncEnumerable<T> ScanAsync(ScanOptions? options = null, CancellationToken cancellationToken = default)
     {
-        return Task.Run(Flush, cancellationToken);
+        ThrowIfDisposed();
+        options ??= ScanOptions.Default;
+        ValidateScanOptions(options);
+
+        return ScanPagesAsync(options, cancellationToken);
     }
 
-    /// <summary>
-    /// Creates an index on a vector field for faster similarity search.
+    private IEnumerable<T> ScanPages(ScanOptions options)
+    {
+        var scan = OpenScan(options);
+        try
+        {
+            while (ReadScanPage(scan, options.IncludeVectors) is { } page)
+            {
+                foreach (var doc in page)
+                {
+                    yield return doc;
+                }
+            }
+        }
+        finally
+        {
+            _native.zvec_scan_close(scan);
+        }
+    }
+
+    private async IAsyncEnumerable<T> ScanPagesAsync(ScanOptions options, [EnumeratorCancellation] CancellationToken cancellationToken)
+    {
+        var scan = await Task.Run(() => OpenScan(options), cancellationToken).ConfigureAwait(false);
+        try
+        {
+            while (await Task.Run(() => ReadScanPage(scan, options.IncludeVectors), cancellationToken).ConfigureAwait(false) is { } page)
+            {
+                foreach (var doc in page)
+                {
+                    yield return doc;
+                }
+            }
+        }
+        finally
+        {
+            _native.zvec_scan_close(scan);
+        }
+    }
+
+    private static void ValidateScanOptions(ScanOptions options)
+    {
+        if (options.BatchSize <= 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.BatchSize, "Scan batch size must be positive");
+        }
+    }
+
+    private IntPtr OpenScan(ScanOptions options)
+    {
+        ThrowIfDisposed();
+
+        var outputFields = options.OutputFields?.ToArray();
+        _native.zvec_collection_scan_open(
+            _handle,
+            options.Filter,
+            outputFields,
+            (nuint)(outputFields?.Length ?? 0),
+            options.IncludeVectors ? 1 : 0,
+            (nuint)options.BatchSize,
+            out var scan).ThrowIfError("Scan");
+
+        return scan;
+    }
+
+    /// <summary>
+    /// Decodes the next page of a scan, or returns null once the scan is exhausted.
+    /// </summary>
+    private IReadOnlyList<T>? ReadScanPage(IntPtr scan, bool includeVectors)
+    {
+        // The native cursor must not outlive the collection it reads from.
+        ThrowIfDisposed();
+
+        _native.zvec_scan_next(scan, out var resultPtr).ThrowIfError("Scan");
+        if (resultPtr == IntPtr.Zero)
+        {
+            return null;
+        }
+
+        try
+        {
+            return ReadResults(resultPtr, includeVectors);
+        }
+        finally
+        {
+            _native.zvec_result_destroy(resultPtr);
+        }
+    }
+
+    // ===== DDL =====
+
+    /// <summary>
+    /// Flushes pending writes to disk.
+    /// </summary>
+    public void Flush()
+    {
+        ThrowIfDisposed();
+        _native.zvec_collection_flush(_handle).ThrowIfError("Flush");
+    }
+
+    /// <summary>
+    /// Asynchronously flushes pending writes to disk.
+    /// </summary>
+    /// <remarks>
+    /// This method wraps the synchronous operation in Task.Run. The underlying native library
+    /// does not provide true async I/O. Use this for offloading to background threads, not for
+    /// improving I/O scalability.
+    /// </remarks>
+    /// <param name="cancellationToken">A cancellation token.</param>
+    /// <returns>A task representing the asynchronous operation.</returns>
+    public Task FlushAsync(CancellationToken cancellationToken = default)
+    {
+        return Task.Run(Flush, cancellationToken);
+    }
+
+    /// <summary>
+    /// Creates an index on a vector field for faster similarity search.
+    /// </summary>
+    /// <param name="fieldName">The name of the vector field.</param>
+    /// <param name="indexParams">The index parameters.</param>
+    public void CreateIndex(string fieldName, IndexParams indexParams)
+    {
+        ThrowIfDisposed();
+        var nativeFieldDef = NativeFieldDef.Create(fieldName, (int)indexParams.Type);
+        _native.zvec_collection_create_index(_handle, fieldName, in nativeFieldDef).ThrowIfError("CreateIndex");
+    }
+
+    /// <summary>
+    /// Asynchronously creates an index on a vector field.
+    /// </summary>
+    /// <remarks>
+    /// This method wraps the synchronous operation in Task.Run. The underlying native library
+    /// does not provide true async I/O. Use this for offloading to background threads, not for
+    /// improving I/O scalability.
+    /// </remarks>
+    /// <param name="fieldName">The name of the vector field.</param>
+    /// <param name="indexParams">The index parameters.</param>
+    /// <param name="cancellationToken">A cancellation token.</param>
+    /// <returns>A task representing the asynchronous operation.</returns>
+    public Task CreateIndexAsync(string fieldName, IndexParams indexParams, CancellationToken cancellationToken = default)
+    {
+        return Task.Run(() => CreateIndex(fieldName, indexParams), cancellationToken);
+    }
+
+    /// <summary>
+    /// Drops an index from a field.
+    /// </summary>
+    /// <param name="fieldName">The name of the field.</param>
+    public void DropIndex(string fieldName)
+    {
+        ThrowIfDisposed();
+        _native.zvec_collection_drop_index(_handle, fieldName).ThrowIfError("DropIndex");
+    }
+
+    /// <summary>
+    /// Asynchronously drops an index from a field.
+    /// </summary>
+    /// <remarks>
+    /// This method wraps the synchronous operation in Task.Run. The underlying native library
+    /// does not provide true async I/O. Use this for offloading to background threads, not for
+    /// improving I/O scalability.
+    /// </remarks>
+    /// <param name="fieldName">The name of the field.</param>
+    /// <param name="cancellationToken">A cancellation token.</param>
+    /// <returns>A task representing the asynchronous operation.</returns>
+    public Task DropIndexAsync(string fieldName, CancellationToken cancellationToken = default)
+    {
+        return Task.Run(() => DropIndex(fieldName), cancellationToken);
+    }
+
+    /// <summary>
+    /// Optimizes the collection for better query performance.
+    /// </summary>
+    /// <remarks>
+    /// Throws while a snapshot created from this collection is open, since compaction would delete
+    /// the segment files the snapshot reads.
+    /// </remarks>
+    public void Optimize()
+    {
+        ThrowIfDisposed();
+        _native.zvec_collection_optimize(_handle).ThrowIfError("Optimize");
+    }
+
+    /// <summary>
+    /// Asynchronously optimizes the collection.
+    /// </summary>
+    /// <remarks>
+    /// This method wraps the synchronous operation in Task.Run. The underlying native library
+    /// does not provide true async I/O. Use this for offloading to background threads, not for
+    /// improving I/O scalability.
+    /// </remarks>
+    /// <param name="cancellationToken">A cancellation token.</param>
+    /// <returns>A task representing the asynchronous operation.</returns>
+    public Task OptimizeAsync(CancellationToken cancellationToken = default)
+    {
+        return Task.Run(Optimize, cancellationToken);
+    }
+
+    /// <summary>
+    /// Reopens a read-only collection so queries see the segments its writer has flushed since it
+    /// was opened or last refreshed.
+    /// </summary>
+    /// <remarks>
+    /// Queries running during the refresh finish against the previous data; cached query results
+    /// are invalidated.
+    /// </remarks>
+    /// <exception cref="InvalidOperationException">Thrown when the collection is not read-only or is a snapshot.</exception>
+    public void Refresh()
+    {
+        ThrowIfDisposed();
+        if (!IsReadOnly || IsSnapshot)
+        {
+            throw new InvalidOperationException("Only read-only collections that are not snapshots can be refreshed");
+        }
+        _native.zvec_collection_refresh(_handle).ThrowIfError("Refresh");
+    }
+
+    /// <summary>
+    /// Creates a read-only view pinned to the collection's current data.
+    /// </summary>
+    /// <remarks>
+    /// On a writable collection, pending writes are flushed and the collection is reopened
+    /// read-only, so the snapshot keeps the current segments and deletes while writes and flushes
+    /// continue. Until it is disposed, the collection refuses <see cref="Optimize"/>, index creation
+    /// and drops, and <see cref="BeginBulkLoad"/>, and background optimizes are skipped, so no file
+    /// the snapshot reads is deleted. Queries, fetches and scans on it run on their own engine instance and
+    /// never wait on the writer, and pages read from it stay consistent. Each snapshot costs an
+    /// open; hold one per pagination session or read burst rather than per query. Dispose it to
+    /// release the pinned data.
+    /// </remarks>
+    /// <returns>A read-only collection that cannot be refreshed.</returns>
+    public Collection<T> CreateSnapshot()
+    {
+        ThrowIfDisposed();
+        _native.zvec_collection_snapshot_create(_handle, out var snapshot).ThrowIfError("CreateSnapshot");
+        return new Collection<T>(snapshot, _schema, _native, snapshot: true);
+    }
+
+    IVectorCollection<T> IVectorCollection<T>.CreateSnapshot() => CreateSnapshot();
+
+    // ===== Query Tuning =====
+
+    /// <summary>
+    /// Sweeps the query-time parameter of a vector field's index (HNSW ef or IVF nprobe) over sample
+    /// queries and recommends the smallest value that reaches the target recall.
+    /// </summary>
+    /// <remarks>
+    /// Ground truth is a native linear scan of the same field, so recall is exact for the sample.
+    /// Every value runs the whole sample one query at a time, so a few hundred queries are usually
+    /// enough. Build-time parameters such as M, EfConstruction and the quantize type need an index
+    /// rebuild and are not swept. The result also holds every measured point and their
+    /// latency/recall Pareto front.
+    /// </remarks>
+    /// <param name="fieldName">A vector field with an HNSW or IVF index.</param>
+    /// <param name="sampleQueries">Representative query vectors; all must have the same dimension.</param>
+    /// <param name="options">Target recall, TopK and the values to try; defaults to <c>new QueryTuningOptions()</c>.</param>
+    /// <returns>The recommended parameter and the measured points.</returns>
+    /// <exception cref="ArgumentOutOfRangeException">Thrown when an option is out of range.</exception>
+    /// <exception cref="ZvecException">Thrown when the field has no HNSW or IVF index.</exception>
+    public QueryTuningResult TuneQuery(string fieldName, IReadOnlyList<float[]> sampleQueries, QueryTuningOptions? options = null)
+    {
+        ThrowIfDisposed();
+        ThrowHelper.ThrowIfNullOrEmpty(fieldName, nameof(fieldName));
+        ThrowHelper.ThrowIfNull(sampleQueries, nameof(sampleQueries));
+        options ??= new QueryTuningOptions();
+        ValidateTuningOptions(options);
+
+        if (sampleQueries.Count == 0)
+        {
+            throw new ArgumentException("At least one sample query is required", nameof(sampleQueries));
+        }
+
+        var matrix = FlattenQueryVectors(sampleQueries, out var dimension);
+        var candidates = options.Candidates?.ToArray();
+        var points = new NativeTunePoint[candidates?.Length ?? 32];
+        var fieldPtr = Marshal.StringToCoTaskMemUTF8(fieldName);
+        var filterPtr = options.Filter != null ? Marshal.StringToCoTaskMemUTF8(options.Filter) : IntPtr.Zero;
+        NativeTuneReport report;
+        try
+        {
+            unsafe
+            {
+                fixed (float* queriesPtr = matrix)
+                fixed (int* candidatesPtr = candidates)
+                {
+                    var request = new NativeTuneRequest
+                    {
+                        FieldName = fieldPtr,
+                        Queries = (IntPtr)queriesPtr,
+                        QueryCount = (nuint)sampleQueries.Count,
+                        Dimension = (nuint)dimension,
+                        TopK = options.TopK,
+                        TargetRecall = options.TargetRecall,
+                        Candidates = (IntPtr)candidatesPtr,
+                        CandidateCount = (nuint)(candidates?.Length ?? 0),
+                        Filter = filterPtr,
+                        Apply = options.Apply ? 1 : 0
+                    };
+                    _native.zvec_collection_tune(_handle, in request, points, (nuint)points.Length, out report).ThrowIfError("TuneQuery");
+                }
+            }
+        }
+        finally
+        {
+            Marshal.FreeCoTaskMem(fieldPtr);
+            Marshal.FreeCoTaskMem(filterPtr);
+        }
+
+        var indexType = (IndexType)report.IndexType;
+        return new QueryTuningResult
+        {
+            IndexType = indexType,
+            Recommended = indexType == IndexType.Ivf
+                ? IndexQueryParam.Ivf(report.Recommended)
+                : IndexQueryParam.Hnsw(report.Recommended),
+            TargetMet = report.TargetMet != 0,
+            Points = points
+                .Take((int)Math.Min(report.PointCount, (nuint)points.Length))
+                .Select(p => new QueryTuningPoint
+                {
+                    Value = p.Value,
+                    Recall = p.Recall,
+                    MeanLatency = TimeSpan.FromMicroseconds(p.MeanLatencyUs),
+                    P99Latency = TimeSpan.FromMicroseconds(p.P99LatencyUs),
+                    IsPareto = p.Pareto != 0
+                })
+                .ToList()
+        };
+    }
+
+    /// <summary>
+    /// Sets the index query parameters used by queries on a field that do not pass their own.
+    /// </summary>
+    /// <remarks>
+    /// Defaults are held by the open collection and are not saved with it.
+    /// <see cref="TuneQuery"/> sets them when <see cref="QueryTuningOptions.Apply"/> is set.
+    /// </remarks>
+    /// <param name="fieldName">The vector field.</param>
+    /// <param name="param">The default parameters, or null to clear them.</param>
+    public void SetQueryDefaults(string fieldName, IndexQueryParam? param)
+    {
+        ThrowIfDisposed();
+        ThrowHelper.ThrowIfNullOrEmpty(fieldName, nameof(fieldName));
+
+        if (param == null)
+        {
+            _native.zvec_collection_set_query_defaults(_handle, fieldName, IntPtr.Zero).ThrowIfError("SetQueryDefaults");
+            return;
+        }
+
+        var nativeParams = NativeQueryParams.FromParam(param);
+        unsafe
+        {
+            _native.zvec_collection_set_query_defaults(_handle, fieldName, (IntPtr)(&nativeParams)).ThrowIfError("SetQueryDefaults");
+        }
+    }
+
+    private static void ValidateTuningOptions(QueryTuningOptions options)
+    {
+        if (options.TopK <= 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.TopK, "TopK must be positive");
+        }
+        if (options.TargetRecall is <= 0 or > 1)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.TargetRecall, "Target recall must be greater than 0 and at most 1");
+        }
+        if (options.Candidates != null && (options.Candidates.Count == 0 || options.Candidates.Any(c => c <= 0)))
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), "Candidate values must be positive and there must be at least one");
+        }
+    }
+
+    // ===== Background Optimize =====
+
+    /// <summary>
+    /// Starts a native background thread that optimizes the collection once enough writes or
+    /// deletes have piled up since the last optimize.
+    /// </summary>
+    /// <remarks>
+    /// Queries are not blocked while it runs. Each run uses <see cref="AutoOptimizePolicy.Concurrency"/>
+    /// threads and runs are throttled by <see cref="AutoOptimizePolicy.MinInterval"/> and
+    /// <see cref="AutoOptimizePolicy.BudgetPercent"/>. Runs never start during a bulk load.
+    /// Disposing the collection stops the optimizer.
+    /// </remarks>
+    /// <param name="policy">Thresholds and throttling; defaults to <c>new AutoOptimizePolicy()</c>.</param>
+    /// <exception cref="ArgumentOutOfRangeException">Thrown when a policy value is negative.</exception>
+    /// <exception cref="ZvecException">Thrown when the optimizer is already running.</exception>
+    public void StartAutoOptimize(AutoOptimizePolicy? policy = null)
+    {
+        ThrowIfDisposed();
+        policy ??= new AutoOptimizePolicy();
+        ValidateAutoOptimizePolicy(policy);
+
+        var nativePolicy = NativeOptimizePolicy.FromPolicy(policy);
+        _native.zvec_collection_start_auto_optimize(_handle, in nativePolicy).ThrowIfError("StartAutoOptimize");
+    }
+
+    /// <summary>
+    /// Stops the background optimizer, waiting for a running optimize to finish.
+    /// </summary>
+    public void StopAutoOptimize()
+    {
+        ThrowIfDisposed();
+        _native.zvec_collection_stop_auto_optimize(_handle).ThrowIfError("StopAutoOptimize");
+    }
+
+    /// <summary>
+    /// Pauses the background optimizer; a running optimize is allowed to finish.
+    /// </summary>
+    public void PauseAutoOptimize()
+    {
+        ThrowIfDisposed();
+        _native.zvec_collection_pause_auto_optimize(_handle).ThrowIfError("PauseAutoOptimize");
+    }
+
+    /// <summary>
+    /// Resumes a paused background optimizer.
+    /// </summary>
+    public void ResumeAutoOptimize()
+    {
+        ThrowIfDisposed();
+        _native.zvec_collection_resume_auto_optimize(_handle).ThrowIfError("ResumeAutoOptimize");
+    }
+
+    /// <summary>
+    /// Gets the background optimizer's state, run counts and the work pending since the last optimize.
+    /// </summary>
+    public AutoOptimizeStatus AutoOptimizeStatus
+    {
+        get
+        {
+            ThrowIfDisposed();
+            _native.zvec_collection_get_auto_optimize_status(_handle, out var status).ThrowIfError("AutoOptimizeStatus");
+            return new AutoOptimizeStatus
+            {
+                State = (AutoOptimizeState)status.State,
+                Runs = (long)status.Runs,
+                Failures = (long)status.Failures,
+                PendingWrites = (long)status.PendingWrites,
+                PendingDeletes = (long)status.PendingDeletes,
+                LastDuration = TimeSpan.FromMilliseconds(status.LastDurationMs),
+                LastStatus = (StatusCode)status.LastStatusCode
+            };
+        }
+    }
+
+    private static void ValidateAutoOptimizePolicy(AutoOptimizePolicy policy)
+    {
+        if (policy.CheckInterval < TimeSpan.Zero || policy.MinInterval < TimeSpan.Zero)
+        {
+            throw new ArgumentOutOfRangeException(nameof(policy), "Auto optimize intervals must not be negative");
+        }
+        if (policy.PendingWrites < 0 || policy.DeletedRatio < 0 || policy.Concurrency < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(policy), "Auto optimize thresholds must not be negative");
+        }
+        if (policy.BudgetPercent is < 0 or > 100)
+        {
+            throw new ArgumentOutOfRangeException(nameof(policy), policy.BudgetPercent, "Auto optimize budget must be between 0 and 100");
+        }
+    }
+
+    // ===== Warmup =====
+
+    /// <summary>
+    /// Reads the collection's files into the OS page cache and optionally replays representative
+    /// queries, so the first real queries after an open do not fault index pages in one at a time.
+    /// </summary>
+    /// <remarks>
+    /// Files are read front to back in parallel on the collection's worker pool. The engine does
+    /// not report which files belong to which field, so every file is read, in path order, up to
+    /// <see cref="WarmupOptions.ByteBudget"/>. This only fills the OS page cache, which a
+    /// read-only collection serves queries from through mmap; a writable collection's engine
+    /// buffers stay cold until the replayed queries run. Only one warmup runs per collection at a
+    /// time; <see cref="CancelWarmup"/> stops it from another thread.
+    /// </remarks>
+    /// <param name="options">Byte budget and queries to replay; defaults to every file and no queries.</param>
+    /// <returns>The final progress counters.</returns>
+    /// <exception cref="ArgumentOutOfRangeException">Thrown when an option is out of range.</exception>
+    /// <exception cref="ZvecException">Thrown when a warmup is already running or this one is cancelled.</exception>
+    public WarmupProgress Warmup(WarmupOptions? options = null)
+    {
+        ThrowIfDisposed();
+        options ??= new WarmupOptions();
+        ValidateWarmupOptions(options);
+
+        var matrix = Array.Empty<float>();
+        var dimension = 0;
+        if (options.ReplayQueries is { Count: > 0 } queries)
+        {
+            matrix = FlattenQueryVectors(queries, out dimension);
+        }
+
+        var queryFieldPtr = IntPtr.Zero;
+        NativeWarmupProgress progress;
+        try
+        {
+            if (dimension > 0)
+            {
+                queryFieldPtr = Marshal.StringToCoTaskMemUTF8(options.ReplayField);
+            }
+
+            unsafe
+            {
+                fixed (float* queriesPtr = matrix)
+                {
+                    var nativeOptions = new NativeWarmupOptions
+                    {
+                        ByteBudget = (ulong)options.ByteBudget,
+                        QueryField = queryFieldPtr,
+                        Queries = (IntPtr)queriesPtr,
+                        QueryCount = dimension > 0 ? (nuint)options.ReplayQueries!.Count : 0,
+                        Dimension = (nuint)dimension,
+                        TopK = options.TopK
+                    };
+                    _native.zvec_collection_warmup(_handle, in nativeOptions, out progress).ThrowIfError("Warmup");
+                }
+            }
+        }
+        finally
+        {
+            Marshal.FreeCoTaskMem(queryFieldPtr);
+        }
+
+        return ToWarmupProgress(progress);
+    }
+
+    /// <summary>
+    /// Asynchronously warms the collection, reporting progress while it runs.
+    /// </summary>
+    /// <remarks>
+    /// The warmup runs on a thread-pool thread; <paramref name="progress"/> is polled every
+    /// 100 ms and reported once more when it finishes. Cancelling the token calls
+    /// <see cref="CancelWarmup"/>.
+    /// </remarks>
+    /// <param name="options">Byte budget and queries to replay; defaults to every file and no queries.</param>
+    /// <param name="progress">Optional receiver of progress updates.</param>
+    /// <param name="cancellationToken">A cancellation token.</param>
+    /// <returns>The final progress counters.</returns>
+    public async Task<WarmupProgress> WarmupAsync(WarmupOptions? options = null, IProgress<WarmupProgress>? progress = null, CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+        cancellationToken.ThrowIfCancellationRequested();
+
+        using var registration = cancellationToken.Register(static state => ((Collection<T>)state!).CancelWarmup(), this);
+        var warmup = Task.Run(() => Warmup(options), cancellationToken);
+        if (progress != null)
+        {
+            while (await Task.WhenAny(warmup, Task.Delay(WarmupPollInterval, CancellationToken.None)).ConfigureAwait(false) != warmup)
+            {
+                progress.Report(WarmupProgress);
+            }
+        }
+
+        try
+        {
+            var result = await warmup.ConfigureAwait(false);
+            progress?.Report(result);
+            return result;
+        }
+        catch (ZvecException ex) when (ex.StatusCode == StatusCode.Cancelled && cancellationToken.IsCancellationRequested)
+        {
+            throw new OperationCanceledException(ex.Message, ex, cancellationToken);
+        }
+    }
+
+    /// <summary>
+    /// Gets the progress of the running warmup, or of the last one.
+    /// </summary>
+    public WarmupProgress WarmupProgress
+    {
+        get
+        {
+            ThrowIfDisposed();
+            _native.zvec_collection_get_warmup_progress(_handle, out var progress).ThrowIfError("WarmupProgress");
+            return ToWarmupProgress(progress);
+        }
+    }
+
+    /// <summary>
+    /// Stops the running warmup after the reads in flight; it then fails with <see cref="StatusCode.Cancelled"/>.
+    /// </summary>
+    /// <remarks>
+    /// With no warmup running, the next one is cancelled as soon as it starts, so a cancel racing
+    /// the start of <see cref="WarmupAsync"/> is not lost.
+    /// </remarks>
+    public void CancelWarmup()
+    {
+        ThrowIfDisposed();
+        _native.zvec_collection_cancel_warmup(_handle).ThrowIfError("CancelWarmup");
+    }
+
+    private static WarmupProgress ToWarmupProgress(in NativeWarmupProgress progress) => new()
+    {
+        FilesTotal = (long)progress.FilesTotal,
+        FilesLoaded = (long)progress.FilesLoaded,
+        BytesTotal = (long)progress.BytesTotal,
+        BytesLoaded = (long)progress.BytesLoaded,
+        QueriesTotal = (long)progress.QueriesTotal,
+        QueriesRun = (long)progress.QueriesRun,
+        IsRunning = progress.Running != 0
+    };
+
+    private static void ValidateWarmupOptions(WarmupOptions options)
+    {
+        if (options.ByteBudget < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.ByteBudget, "Warmup byte budget must not be negative");
+        }
+        if (options.TopK <= 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.TopK, "TopK must be positive");
+        }
+        if (options.ReplayQueries is { Count: > 0 } && string.IsNullOrEmpty(options.ReplayField))
+        {
+            throw new ArgumentException("ReplayField is required when ReplayQueries is set", nameof(options));
+        }
+    }
+
+    // ===== Import =====
+
+    /// <summary>
+    /// Imports vectors from a file, streaming it through the native library in chunks.
+    /// </summary>
+    /// <remarks>
+    /// Rows are read, converted and written natively without passing through managed memory; the
+    /// next chunk is read while the current one is written. Rows the engine rejects are counted in
+    /// <see cref="ImportResult.RowsFailed"/> and the import goes on. Parquet and Arrow IPC need a
+    /// native library built with Arrow; fvecs, bvecs and .npy files carry vectors only.
+    /// </remarks>
+    /// <param name="path">The file to import.</param>
+    /// <param name="vectorField">The vector field the rows' vectors are written to.</param>
+    /// <param name="options">Format, column mapping and chunking; defaults to the format named by the extension.</param>
+    /// <returns>Row counts, timing and the first rejected row's error.</returns>
+    /// <exception cref="ArgumentOutOfRangeException">Thrown when an option is out of range.</exception>
+    /// <exception cref="ZvecException">Thrown when the file cannot be read or a chunk cannot be written.</exception>
+    public ImportResult Import(string path, string vectorField, ImportOptions? options = null)
+    {
+        ThrowIfDisposed();
+        ThrowHelper.ThrowIfNullOrEmpty(path, nameof(path));
+        ThrowHelper.ThrowIfNullOrEmpty(vectorField, nameof(vectorField));
+        options ??= new ImportOptions();
+        ValidateImportOptions(options);
+
+        var columns = options.ScalarColumns?.ToArray() ?? Array.Empty<string>();
+        var columnPtrs = new IntPtr[columns.Length];
+        var vectorFieldPtr = IntPtr.Zero;
+        var vectorColumnPtr = IntPtr.Zero;
+        var pkColumnPtr = IntPtr.Zero;
+        var pkPrefixPtr = IntPtr.Zero;
+        NativeImportReport report;
+        try
+        {
+            for (int i = 0; i < columns.Length; i++)
+            {
+                columnPtrs[i] = Marshal.StringToCoTaskMemUTF8(columns[i]);
+            }
+            vectorFieldPtr = Marshal.StringToCoTaskMemUTF8(vectorField);
+            vectorColumnPtr = Marshal.StringToCoTaskMemUTF8(options.VectorColumn);
+            pkColumnPtr = Marshal.StringToCoTaskMemUTF8(options.PkColumn);
+            pkPrefixPtr = Marshal.StringToCoTaskMemUTF8(options.PkPrefix);
+
+            unsafe
+            {
+                fixed (IntPtr* columnsPtr = columnPtrs)
+                {
+                    var mapping = new NativeImportMapping
+                    {
+                        VectorField = vectorFieldPtr,
+                        VectorColumn = vectorColumnPtr,
+                        PkColumn = pkColumnPtr,
+                        PkPrefix = pkPrefixPtr,
+                        PkStart = (ulong)options.PkStart,
+                        ScalarColumns = (IntPtr)columnsPtr,
+                        ScalarColumnCount = (nuint)columns.Length
+                    };
+                    var nativeOptions = new NativeImportOptions
+                    {
+                        ChunkRows = (nuint)options.ChunkRows,
+                        MaxRows = (ulong)options.MaxRows,
+                        Upsert = options.Upsert ? 1 : 0
+                    };
+                    _native.zvec_collection_import(_handle, path, (int)options.Format, in mapping, in nativeOptions, out report).ThrowIfError("Import");
+                }
+            }
+        }
+        finally
+        {
+            foreach (var ptr in columnPtrs)
+            {
+                Marshal.FreeCoTaskMem(ptr);
+            }
+            Marshal.FreeCoTaskMem(vectorFieldPtr);
+            Marshal.FreeCoTaskMem(vectorColumnPtr);
+            Marshal.FreeCoTaskMem(pkColumnPtr);
+            Marshal.FreeCoTaskMem(pkPrefixPtr);
+        }
+
+        return new ImportResult
+        {
+            RowsRead = (long)report.RowsRead,
+            RowsWritten = (long)report.RowsWritten,
+            RowsFailed = (long)report.RowsFailed,
+            Chunks = (long)report.Chunks,
+            Elapsed = TimeSpan.FromMilliseconds(report.ElapsedMs),
+            RowsPerSecond = report.RowsPerSecond,
+            FirstError = report.FirstErrorCode == 0
+                ? Status.Ok
+                : Status.From((StatusCode)report.FirstErrorCode, Marshal.PtrToStringUTF8(report.FirstErrorMessage) ?? string.Empty)
+        };
+    }
+
+    /// <summary>
+    /// Asynchronously imports vectors from a file.
+    /// </summary>
+    /// <remarks>
+    /// This method wraps the synchronous operation in Task.Run. The underlying native library
+    /// does not provide true async I/O. Use this for offloading to background threads, not for
+    /// improving I/O scalability.
+    /// </remarks>
+    /// <param name="path">The file to import.</param>
+    /// <param name="vectorField">The vector field the rows' vectors are written to.</param>
+    /// <param name="options">Format, column mapping and chunking; defaults to the format named by the extension.</param>
+    /// <param name="cancellationToken">A cancellation token.</param>
+    /// <returns>Row counts, timing and the first rejected row's error.</returns>
+    public Task<ImportResult> ImportAsync(string path, string vectorField, ImportOptions? options = null, CancellationToken cancellationToken = default)
+    {
+        return Task.Run(() => Import(path, vectorField, options), cancellationToken);
+    }
+
+    private static void ValidateImportOptions(ImportOptions options)
+    {
+        if (options.ChunkRows < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.ChunkRows, "Import chunk size must not be negative");
+        }
+        if (options.MaxRows < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.MaxRows, "Import row limit must not be negative");
+        }
+        if (options.PkStart < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.PkStart, "Import key start must not be negative");
+        }
+        if (options.ScalarColumns != null && options.ScalarColumns.Any(string.IsNullOrEmpty))
+        {
+            throw new ArgumentException("Import scalar columns cannot contain null or empty names", nameof(options));
+        }
+    }
+
+    // ===== Export =====
+
+    /// <summary>
+    /// Writes the collection's documents to a Parquet or Arrow IPC file in batches.
     /// </summary>
-    /// <param name="fieldName">The name of the vector field.</param>
-    /// <param name="indexParams">The index parameters.</param>
-    public void CreateIndex(string fieldName, IndexParams indexParams)
+    /// <remarks>
+    /// The file has a string primary key column followed by one column per field, with vectors as
+    /// fixed-size lists that <see cref="Import"/> reads back. The keys of the matching documents are
+    /// loaded first, an O(N) pass as for <see cref="Scan"/>; documents are then streamed: fetched,
+    /// converted and written natively, and only <see cref="ExportOptions.Concurrency"/> batches plus
+    /// the one being written are held at once. Export a <see cref="CreateSnapshot"/> for a consistent dump. Needs a
+    /// native library built with Arrow.
+    /// </remarks>
+    /// <param name="path">The file to write; a partial file is removed on failure.</param>
+    /// <param name="options">Format, fields, filter and batching; defaults to every field and document.</param>
+    /// <returns>Row and byte counts and timing.</returns>
+    /// <exception cref="ArgumentOutOfRangeException">Thrown when an option is out of range.</exception>
+    /// <exception cref="ZvecException">Thrown when the native library lacks Arrow or the file cannot be written.</exception>
+    public ExportResult Export(string path, ExportOptions? options = null)
     {
         ThrowIfDisposed();
-        var nativeFieldDef = NativeFieldDef.Create(fieldName, (int)indexParams.Type);
-        _native.zvec_collection_create_index(_handle, fieldName, in nativeFieldDef).ThrowIfError("CreateIndex");
+        ThrowHelper.ThrowIfNullOrEmpty(path, nameof(path));
+        options ??= new ExportOptions();
+        ValidateExportOptions(options);
+
+        var fields = options.Fields?.ToArray() ?? Array.Empty<string>();
+        var fieldPtrs = new IntPtr[fields.Length];
+        var filterPtr = IntPtr.Zero;
+        var pkColumnPtr = IntPtr.Zero;
+        NativeExportReport report;
+        try
+        {
+            for (int i = 0; i < fieldPtrs.Length; i++)
+            {
+                fieldPtrs[i] = Marshal.StringToCoTaskMemUTF8(fields[i]);
+            }
+            filterPtr = Marshal.StringToCoTaskMemUTF8(options.Filter);
+            pkColumnPtr = Marshal.StringToCoTaskMemUTF8(options.PkColumn);
+
+            unsafe
+            {
+                fixed (IntPtr* namesPtr = fieldPtrs)
+                {
+                    var nativeOptions = new NativeExportOptions
+                    {
+                        Fields = (IntPtr)namesPtr,
+                        FieldCount = (nuint)fieldPtrs.Length,
+                        Filter = filterPtr,
+                        PkColumn = pkColumnPtr,
+                        BatchRows = (nuint)options.BatchRows,
+                        Concurrency = options.Concurrency
+                    };
+                    _native.zvec_collection_export(_handle, path, (int)options.Format, in nativeOptions, out report).ThrowIfError("Export");
+                }
+            }
+        }
+        finally
+        {
+            foreach (var ptr in fieldPtrs)
+            {
+                Marshal.FreeCoTaskMem(ptr);
+            }
+            Marshal.FreeCoTaskMem(filterPtr);
+            Marshal.FreeCoTaskMem(pkColumnPtr);
+        }
+
+        return new ExportResult
+        {
+            Rows = (long)report.Rows,
+            Batches = (long)report.Batches,
+            BytesWritten = (long)report.BytesWritten,
+            Elapsed = TimeSpan.FromMilliseconds(report.ElapsedMs),
+            RowsPerSecond = report.RowsPerSecond
+        };
     }
 
     /// <summary>
-    /// Asynchronously creates an index on a vector field.
+    /// Asynchronously writes the collection's documents to a Parquet or Arrow IPC file.
     /// </summary>
     /// <remarks>
     /// This method wraps the synchronous operation in Task.Run. The underlying native library
     /// does not provide true async I/O. Use this for offloading to background threads, not for
     /// improving I/O scalability.
     /// </remarks>
-    /// <param name="fieldName">The name of the vector field.</param>
-    /// <param name="indexParams">The index parameters.</param>
+    /// <param name="path">The file to write; a partial file is removed on failure.</param>
+    /// <param name="options">Format, fields, filter and batching; defaults to every field and document.</param>
     /// <param name="cancellationToken">A cancellation token.</param>
-    /// <returns>A task representing the asynchronous operation.</returns>
-    public Task CreateIndexAsync(string fieldName, IndexParams indexParams, CancellationToken cancellationToken = default)
+    /// <returns>Row and byte counts and timing.</returns>
+    public Task<ExportResult> ExportAsync(string path, ExportOptions? options = null, CancellationToken cancellationToken = default)
     {
-        return Task.Run(() => CreateIndex(fieldName, indexParams), cancellationToken);
+        return Task.Run(() => Export(path, options), cancellationToken);
     }
 
-    /// <summary>
-    /// Drops an index from a field.
-    /// </summary>
-    /// <param name="fieldName">The name of the field.</param>
-    public void DropIndex(string fieldName)
+    private static void ValidateExportOptions(ExportOptions options)
     {
-        ThrowIfDisposed();
-        _native.zvec_collection_drop_index(_handle, fieldName).ThrowIfError("DropIndex");
+        if (options.BatchRows < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.BatchRows, "Export batch size must not be negative");
+        }
+        if (options.Concurrency < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), options.Concurrency, "Export concurrency must not be negative");
+        }
+        if (options.Fields != null && options.Fields.Any(string.IsNullOrEmpty))
+        {
+            throw new ArgumentException("Export fields cannot contain null or empty names", nameof(options));
+        }
     }
 
+    // ===== Bulk Load =====
+
     /// <summary>
-    /// Asynchronously drops an index from a field.
+    /// Starts a bulk load: auto-flush is suspended and vector index builds are deferred.
     /// </summary>
     /// <remarks>
-    /// This method wraps the synchronous operation in Task.Run. The underlying native library
-    /// does not provide true async I/O. Use this for offloading to background threads, not for
-    /// improving I/O scalability.
+    /// Until <see cref="EndBulkLoad"/> is called, queries against the affected vector fields fall
+    /// back to brute-force search. If dropping an index fails, the indexes already dropped are
+    /// recreated before the exception is thrown. The index parameters are saved to a
+    /// <c>.bulk_load</c> file next to the collection before anything is dropped, so a collection
+    /// disposed or crashed mid-load reopens still in the bulk load and <see cref="EndBulkLoad"/>
+    /// rebuilds its indexes.
     /// </remarks>
-    /// <param name="fieldName">The name of the field.</param>
-    /// <param name="cancellationToken">A cancellation token.</param>
-    /// <returns>A task representing the asynchronous operation.</returns>
-    public Task DropIndexAsync(string fieldName, CancellationToken cancellationToken = default)
+    public void BeginBulkLoad()
     {
-        return Task.Run(() => DropIndex(fieldName), cancellationToken);
+        ThrowIfDisposed();
+        _native.zvec_collection_begin_bulk_load(_handle).ThrowIfError("BeginBulkLoad");
     }
 
     /// <summary>
-    /// Optimizes the collection for better query performance.
+    /// Ends a bulk load by rebuilding the deferred vector indexes, then optimizing and flushing.
     /// </summary>
-    public void Optimize()
+    /// <remarks>
+    /// Index builds and optimize use <see cref="CollectionOptions.IndexBuildParallel"/> threads.
+    /// If a rebuild fails the bulk load stays active with the remaining indexes, and calling this
+    /// method again resumes the rebuild.
+    /// </remarks>
+    public void EndBulkLoad()
     {
         ThrowIfDisposed();
-        _native.zvec_collection_optimize(_handle).ThrowIfError("Optimize");
+        _native.zvec_collection_end_bulk_load(_handle).ThrowIfError("EndBulkLoad");
     }
 
     /// <summary>
-    /// Asynchronously optimizes the collection.
+    /// Asynchronously ends a bulk load.
     /// </summary>
     /// <remarks>
     /// This method wraps the synchronous operation in Task.Run. The underlying native library
@@ -658,9 +2121,9 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     /// </remarks>
     /// <param name="cancellationToken">A cancellation token.</param>
     /// <returns>A task representing the asynchronous operation.</returns>
-    public Task OptimizeAsync(CancellationToken cancellationToken = default)
+    public Task EndBulkLoadAsync(CancellationToken cancellationToken = default)
     {
-        return Task.Run(Optimize, cancellationToken);
+        return Task.Run(EndBulkLoad, cancellationToken);
     }
 
     /// <summary>
@@ -679,9 +2142,17 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
     {
         if (_disposed) return;
         _disposed = true;
+        DestroyDocBatch();
         if (_handle != IntPtr.Zero)
         {
-            _native.zvec_collection_destroy(_handle);
+            if (IsSnapshot)
+            {
+                _native.zvec_collection_snapshot_release(_handle);
+            }
+            else
+            {
+                _native.zvec_collection_destroy(_handle);
+            }
             _handle = IntPtr.Zero;
         }
     }
@@ -698,152 +2169,488 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
         return NativeCollectionOptions.Create(
             options?.SegmentMaxDocs ?? 1_000_000,
             options?.IndexBuildParallel ?? 0,
-            options?.AutoFlush ?? true);
+            options?.AutoFlush ?? false,
+            options?.QueryParallel ?? 0,
+            options?.QueryCacheSize ?? 0);
     }
 
-    private Status ExecuteDocumentOperation(IReadOnlyList<T> documents, Func<IntPtr, IntPtr[], nuint, NativeStatus> operation)
+    private Status ExecuteDocumentOperation(IReadOnlyList<T> documents, Func<IntPtr, IntPtr, NativeStatus> operation)
     {
-        var handles = CreateNativeDocs(documents);
+        var batch = RentDocBatch(documents.Count);
         try
         {
-            var status = operation(_handle, handles, (nuint)handles.Length);
-            return status.ToStatus();
+            var fields = GetWriteFields();
+            foreach (var doc in documents)
+            {
+                FillNativeDoc(_native.zvec_doc_batch_add(batch), doc, fields);
+            }
+
+            return operation(_handle, batch).ToStatus();
         }
         finally
         {
-            foreach (var h in handles)
-            {
-                _native.zvec_doc_destroy(h);
-            }
+            ReturnDocBatch(batch, documents.Count);
         }
     }
 
-    private IReadOnlyList<T> ReadResults(IntPtr resultPtr)
+    /// <summary>
+    /// Takes the collection's cached native document batch, or creates one when another
+    /// write is already using it.
+    /// </summary>
+    private IntPtr RentDocBatch(int count)
     {
-        var count = (int)_native.zvec_result_count(resultPtr);
-        var results = new List<T>(count);
+        var batch = Interlocked.Exchange(ref _docBatch, IntPtr.Zero);
+        if (batch == IntPtr.Zero)
+        {
+            batch = _native.zvec_doc_batch_create((nuint)count);
+        }
+        _native.zvec_doc_batch_clear(batch);
+        return batch;
+    }
 
-        for (int i = 0; i < count; i++)
+    private void ReturnDocBatch(IntPtr batch, int count)
+    {
+        // Native batches never shrink, so only small ones are kept for reuse.
+        if (count > ColumnarBatchThreshold ||
+            Interlocked.CompareExchange(ref _docBatch, batch, IntPtr.Zero) != IntPtr.Zero)
         {
-            var docPtr = _native.zvec_result_get_doc(resultPtr, (nuint)i);
-            if (docPtr != IntPtr.Zero)
-            {
-                var doc = ReadDocument(docPtr);
-                results.Add(doc);
-            }
+            _native.zvec_doc_batch_destroy(batch);
+            return;
         }
 
-        return results;
+        if (_disposed)
+        {
+            DestroyDocBatch();
+        }
     }
 
-    private T ReadDocument(IntPtr docPtr)
+    private void DestroyDocBatch()
     {
-        var doc = new T();
-
-        var pkPtr = _native.zvec_doc_get_pk(docPtr);
-        if (pkPtr != IntPtr.Zero)
+        var batch = Interlocked.Exchange(ref _docBatch, IntPtr.Zero);
+        if (batch != IntPtr.Zero)
         {
-            doc.Id = Marshal.PtrToStringUTF8(pkPtr) ?? string.Empty;
+            _native.zvec_doc_batch_destroy(batch);
         }
+    }
+
+    private bool TryExecuteColumnarOperation(IReadOnlyList<T> documents, ColumnarOperation operation, out Status status)
+    {
+        status = Status.Ok;
+        if (documents.Count < ColumnarBatchThreshold) return false;
+
+        using var batch = TryCreateColumnarBatch(documents);
+        if (batch == null) return false;
+
+        var nativeBatch = batch.Build();
+        status = operation(_handle, in nativeBatch).ToStatus();
+        return true;
+    }
 
-        var score = _native.zvec_doc_get_score(docPtr);
+    private Task<Status> ExecuteWriteAsync(
+        IReadOnlyList<T> documents,
+        ColumnarAsyncOperation? columnarOperation,
+        DocumentAsyncOperation documentOperation,
+        CancellationToken cancellationToken)
+    {
+        // Inputs are copied by the native side on submission, so both the columnar batch and the
+        // document handles are released as soon as the operation has been queued.
+        if (columnarOperation != null && documents.Count >= ColumnarBatchThreshold)
+        {
+            using var batch = TryCreateColumnarBatch(documents);
+            if (batch != null)
+            {
+                var nativeBatch = batch.Build();
+                return NativeAsyncOperation<Status>.Run(
+                    _native,
+                    (IntPtr callback, IntPtr userData, out IntPtr op) =>
+                        columnarOperation(_handle, in nativeBatch, callback, userData, out op),
+                    static (status, _) => status.ToStatus(),
+                    cancellationToken);
+            }
+        }
 
-        if (typeof(DocumentBase).IsAssignableFrom(typeof(T)))
+        var handles = CreateNativeDocs(documents);
+        try
         {
-            var scoreProp = typeof(T).GetProperty(nameof(DocumentBase.Score));
-            scoreProp?.SetValue(doc, score);
+            return NativeAsyncOperation<Status>.Run(
+                _native,
+                (IntPtr callback, IntPtr userData, out IntPtr op) =>
+                    documentOperation(_handle, handles, (nuint)handles.Length, callback, userData, out op),
+                static (status, _) => status.ToStatus(),
+                cancellationToken);
         }
+        finally
+        {
+            foreach (var h in handles)
+            {
+                _native.zvec_doc_destroy(h);
+            }
+        }
+    }
 
-        var fieldProps = GetFieldProperties();
-        foreach (var (name, prop) in fieldProps)
+    /// <summary>
+    /// Converts documents into one pinned column per field, or returns null when a property
+    /// cannot be represented as a column and the per-document path has to be used.
+    /// </summary>
+    private NativeColumnarBatch? TryCreateColumnarBatch(IReadOnlyList<T> documents)
+    {
+        var batch = new NativeColumnarBatch(documents.Count);
+        try
         {
-            if (_native.zvec_doc_has_field(docPtr, name) != 0)
+            var pks = new string?[documents.Count];
+            for (int i = 0; i < documents.Count; i++)
             {
-                var value = ReadFieldValue(docPtr, name, prop.PropertyType);
-                if (value != null)
+                pks[i] = documents[i].Id;
+            }
+            batch.SetPrimaryKeys(pks);
+
+            foreach (var (name, prop) in GetFieldProperties())
+            {
+                if (!TryAddFieldColumn(batch, documents, name, prop))
                 {
-                    prop.SetValue(doc, value);
+                    batch.Dispose();
+                    return null;
                 }
             }
-        }
 
-        return doc;
+            foreach (var (name, prop) in GetVectorProperties())
+            {
+                if (!TryAddVectorColumn(batch, documents, name, prop))
+                {
+                    batch.Dispose();
+                    return null;
+                }
+            }
+
+            return batch;
+        }
+        catch
+        {
+            batch.Dispose();
+            throw;
+        }
     }
 
-    private object? ReadFieldValue(IntPtr docPtr, string fieldName, Type propertyType)
+    private static bool TryAddFieldColumn(NativeColumnarBatch batch, IReadOnlyList<T> documents, string fieldName, PropertyInfo prop)
     {
-        var underlying = Nullable.GetUnderlyingType(propertyType) ?? propertyType;
+        var underlying = Nullable.GetUnderlyingType(prop.PropertyType) ?? prop.PropertyType;
 
         if (underlying == typeof(string))
         {
-            var ptr = _native.zvec_doc_get_string(docPtr, fieldName);
-            return ptr != IntPtr.Zero ? Marshal.PtrToStringUTF8(ptr) : null;
+            var values = new string?[documents.Count];
+            for (int i = 0; i < documents.Count; i++)
+            {
+                values[i] = (string?)prop.GetValue(documents[i]);
+            }
+            batch.AddStringColumn(fieldName, values);
+            return true;
         }
 
         if (underlying == typeof(int))
         {
-            return (int)_native.zvec_doc_get_int64(docPtr, fieldName);
+            AddScalarColumn(batch, documents, fieldName, prop, DataType.Int32, v => (int)v);
+            return true;
         }
 
         if (underlying == typeof(long))
         {
-            return _native.zvec_doc_get_int64(docPtr, fieldName);
+            AddScalarColumn(batch, documents, fieldName, prop, DataType.Int64, v => (long)v);
+            return true;
         }
 
         if (underlying == typeof(float))
         {
-            return (float)_native.zvec_doc_get_double(docPtr, fieldName);
+            AddScalarColumn(batch, documents, fieldName, prop, DataType.Float, v => (float)v);
+            return true;
         }
 
         if (underlying == typeof(double))
         {
-            return _native.zvec_doc_get_double(docPtr, fieldName);
+            AddScalarColumn(batch, documents, fieldName, prop, DataType.Double, v => (double)v);
+            return true;
         }
 
         if (underlying == typeof(bool))
         {
-            return _native.zvec_doc_get_bool(docPtr, fieldName) != 0;
+            AddScalarColumn(batch, documents, fieldName, prop, DataType.Bool, v => (bool)v ? (byte)1 : (byte)0);
+            return true;
         }
 
-        return null;
+        return false;
     }
 
-    private IntPtr[] CreateNativeDocs(IReadOnlyList<T> documents)
+    private static void AddScalarColumn<TValue>(
+        NativeColumnarBatch batch,
+        IReadOnlyList<T> documents,
+        string fieldName,
+        PropertyInfo prop,
+        DataType dataType,
+        Func<object, TValue> convert) where TValue : unmanaged
     {
-        var handles = new IntPtr[documents.Count];
-        var fieldProps = GetFieldProperties();
-        var vectorProps = GetVectorProperties();
+        var values = new TValue[documents.Count];
+        byte[]? nullBitmap = null;
+
+        for (int i = 0; i < documents.Count; i++)
+        {
+            var value = prop.GetValue(documents[i]);
+            if (value == null)
+            {
+                NativeColumnarBatch.SetNull(ref nullBitmap, documents.Count, i);
+            }
+            else
+            {
+                values[i] = convert(value);
+            }
+        }
+
+        batch.AddScalarColumn(fieldName, dataType, values, nullBitmap);
+    }
+
+    private static bool TryAddVectorColumn(NativeColumnarBatch batch, IReadOnlyList<T> documents, string fieldName, PropertyInfo prop)
+    {
+        var attr = prop.GetCustomAttribute<VectorFieldAttribute>();
+        if (attr == null) return true;
+
+        // Mirrors SetVectorValue. Sparse vectors have no columnar layout, so they send the
+        // batch down the per-document path.
+        return attr.Precision switch
+        {
+            VectorPrecision.Float32 => TryAddDenseColumn<float>(batch, documents, fieldName, prop, DataType.VectorFp32, attr.Dimension),
+            VectorPrecision.Float16 => TryAddDenseColumn<Half>(batch, documents, fieldName, prop, DataType.VectorFp16, attr.Dimension),
+            VectorPrecision.Int8 => TryAddDenseColumn<sbyte>(batch, documents, fieldName, prop, DataType.VectorInt8, attr.Dimension),
+            VectorPrecision.Int16 => TryAddDenseColumn<short>(batch, documents, fieldName, prop, DataType.VectorInt16, attr.Dimension),
+            VectorPrecision.SparseFloat32 => false,
+            _ => true
+        };
+    }
+
+    private static bool TryAddDenseColumn<TValue>(NativeColumnarBatch batch, IReadOnlyList<T> documents, string fieldName, PropertyInfo prop, DataType dataType, int dimension)
+        where TValue : unmanaged
+    {
+        var matrix = new TValue[documents.Count * dimension];
+        byte[]? nullBitmap = null;
 
         for (int i = 0; i < documents.Count; i++)
         {
-            var doc = documents[i];
-            var handle = _native.zvec_doc_create();
+            if (prop.GetValue(documents[i]) is not TValue[] vector || vector.Length == 0)
+            {
+                NativeColumnarBatch.SetNull(ref nullBitmap, documents.Count, i);
+                continue;
+            }
+
+            // Ragged rows cannot be expressed as a matrix; let the engine report them per document.
+            if (vector.Length != dimension) return false;
+
+            Array.Copy(vector, 0, matrix, i * dimension, dimension);
+        }
+
+        batch.AddVectorColumn(fieldName, dataType, dimension, matrix, nullBitmap);
+        return true;
+    }
+
+    private IReadOnlyList<T> ReadResults(IntPtr resultPtr, bool includeVectors)
+    {
+        var columns = GetResultColumns(includeVectors);
+        var requests = new (string Name, DataType DataType, int Dimension)[columns.Count];
+        for (int c = 0; c < columns.Count; c++)
+        {
+            requests[c] = (columns[c].Name, columns[c].DataType, columns[c].Dimension);
+        }
+
+        if (_native.zvec_result_truncated(resultPtr) != 0)
+        {
+            ZvecMetrics.RecordTruncatedQuery();
+        }
+
+        var page = NativeResultPage.Export(_native, resultPtr, requests);
+        var scoreProp = typeof(DocumentBase).IsAssignableFrom(typeof(T))
+            ? typeof(T).GetProperty(nameof(DocumentBase.Score))
+            : null;
+
+        var results = new T[page.Count];
+        for (int i = 0; i < results.Length; i++)
+        {
+            var doc = new T { Id = page.GetPrimaryKey(i) };
+            scoreProp?.SetValue(doc, page.GetScore(i));
+            results[i] = doc;
+        }
+
+        for (int c = 0; c < columns.Count; c++)
+        {
+            var prop = columns[c].Property;
+            for (int i = 0; i < results.Length; i++)
+            {
+                if (!page.IsNull(c, i))
+                {
+                    prop.SetValue(results[i], ReadColumnValue(page, columns[c].DataType, c, i));
+                }
+            }
+        }
+
+        return results;
+    }
+
+    private static object ReadColumnValue(NativeResultPage page, DataType dataType, int column, int row)
+    {
+        return dataType switch
+        {
+            DataType.String => page.GetString(column, row),
+            DataType.Int32 => page.GetValue<int>(column, row),
+            DataType.Int64 => page.GetValue<long>(column, row),
+            DataType.Float => page.GetValue<float>(column, row),
+            DataType.Double => page.GetValue<double>(column, row),
+            DataType.Bool => page.GetValue<byte>(column, row) != 0,
+            DataType.VectorFp32 => page.GetVector<float>(column, row),
+            DataType.VectorFp64 => page.GetVector<double>(column, row),
+            DataType.VectorFp16 => page.GetVector<Half>(column, row),
+            DataType.VectorInt8 => page.GetVector<sbyte>(column, row),
+            DataType.VectorInt16 => page.GetVector<short>(column, row),
+            _ => throw new NotSupportedException($"Cannot read column of type {dataType}")
+        };
+    }
 
-            _native.zvec_doc_set_pk(handle, doc.Id);
+    private List<(string Name, PropertyInfo Property, DataType DataType, int Dimension)> GetResultColumns(bool includeVectors)
+    {
+        var columns = new List<(string Name, PropertyInfo Property, DataType DataType, int Dimension)>();
 
-            foreach (var (name, prop) in fieldProps)
+        foreach (var (name, prop) in GetFieldProperties())
+        {
+            var underlying = Nullable.GetUnderlyingType(prop.PropertyType) ?? prop.PropertyType;
+            DataType? dataType =
+                underlying == typeof(string) ? DataType.String :
+                underlying == typeof(int) ? DataType.Int32 :
+                underlying == typeof(long) ? DataType.Int64 :
+                underlying == typeof(float) ? DataType.Float :
+                underlying == typeof(double) ? DataType.Double :
+                underlying == typeof(bool) ? DataType.Bool :
+                null;
+
+            if (dataType.HasValue)
             {
-                var value = prop.GetValue(doc);
-                SetFieldValue(handle, name, value, prop.PropertyType);
+                columns.Add((name, prop, dataType.Value, 0));
             }
+        }
 
-            foreach (var (name, prop) in vectorProps)
+        if (includeVectors)
+        {
+            foreach (var (name, prop) in GetVectorProperties())
             {
-                var value = prop.GetValue(doc);
-                SetVectorValue(handle, name, value, prop);
+                var attr = prop.GetCustomAttribute<VectorFieldAttribute>();
+                if (attr is { Dimension: > 0 } && !attr.Precision.IsSparse() && prop.PropertyType.IsArray)
+                {
+                    columns.Add((name, prop, attr.Precision.ToDataType(), attr.Dimension));
+                }
             }
+        }
+
+        return columns;
+    }
+
+    private IntPtr[] CreateNativeDocs(IReadOnlyList<T> documents)
+    {
+        var handles = new IntPtr[documents.Count];
+        var fields = GetWriteFields();
 
-            handles[i] = handle;
+        for (int i = 0; i < documents.Count; i++)
+        {
+            handles[i] = _native.zvec_doc_create();
+            try
+            {
+                FillNativeDoc(handles[i], documents[i], fields);
+            }
+            catch
+            {
+                for (int j = 0; j <= i; j++)
+                {
+                    _native.zvec_doc_destroy(handles[j]);
+                }
+                throw;
+            }
         }
 
         return handles;
     }
 
-    private void SetFieldValue(IntPtr docPtr, string fieldName, object? value, Type type)
+    private void FillNativeDoc(IntPtr handle, T doc, ResolvedField[] fields)
+    {
+        _native.zvec_doc_set_pk(handle, doc.Id);
+
+        foreach (var field in fields)
+        {
+            var value = field.Property.GetValue(doc);
+            if (field.Precision is { } precision)
+            {
+                SetVectorValue(handle, field.Id, value, precision)
+                    .ThrowIfError($"Set vector field '{field.Name}'");
+            }
+            else
+            {
+                SetFieldValue(handle, field.Id, value, field.Property.PropertyType);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Resolves every written property to a native field id once per collection, scalar fields
+    /// first, so per-document writes pass ids instead of marshalling field names. Resolution
+    /// fails for a field the schema lacks or stores in another type than the property writes.
+    /// </summary>
+    private ResolvedField[] GetWriteFields()
+    {
+        // Resolution is idempotent on the native side, so a racing first write is harmless.
+        return _writeFields ??= ResolveWriteFields();
+    }
+
+    private ResolvedField[] ResolveWriteFields()
+    {
+        var fields = new List<ResolvedField>();
+
+        foreach (var (name, prop) in GetFieldProperties())
+        {
+            var id = ResolveField(name, WrittenDataType(prop.PropertyType));
+            fields.Add(new ResolvedField(name, id, prop, null));
+        }
+
+        foreach (var (name, prop) in GetVectorProperties())
+        {
+            var attr = prop.GetCustomAttribute<VectorFieldAttribute>();
+            if (attr == null) continue;
+            var id = ResolveField(name, attr.Precision.ToDataType());
+            fields.Add(new ResolvedField(name, id, prop, attr.Precision));
+        }
+
+        return fields.ToArray();
+    }
+
+    private IntPtr ResolveField(string name, DataType dataType)
+    {
+        _native.zvec_collection_resolve_field(_handle, name, (int)dataType, out var field)
+            .ThrowIfError($"Resolve field '{name}'");
+        return field;
+    }
+
+    /// <summary>
+    /// The field type <see cref="SetFieldValue"/> writes for a property type, or
+    /// <see cref="DataType.Undefined"/> for types it only writes as null.
+    /// </summary>
+    private static DataType WrittenDataType(Type type)
+    {
+        var underlying = Nullable.GetUnderlyingType(type) ?? type;
+
+        if (underlying == typeof(string)) return DataType.String;
+        if (underlying == typeof(int)) return DataType.Int32;
+        if (underlying == typeof(long)) return DataType.Int64;
+        if (underlying == typeof(float)) return DataType.Float;
+        if (underlying == typeof(double)) return DataType.Double;
+        if (underlying == typeof(bool)) return DataType.Bool;
+        return DataType.Undefined;
+    }
+
+    private void SetFieldValue(IntPtr docPtr, IntPtr fieldId, object? value, Type type)
     {
         if (value == null)
         {
-            _native.zvec_doc_set_null(docPtr, fieldName);
+            _native.zvec_doc_set_null_by_id(docPtr, fieldId);
             return;
         }
 
@@ -851,47 +2658,69 @@ public sealed class Collection<T> : IVectorCollection<T> where T : class, IDocum
 
         if (underlying == typeof(string))
         {
-            _native.zvec_doc_set_string(docPtr, fieldName, (string)value);
+            _native.zvec_doc_set_string_by_id(docPtr, fieldId, (string)value);
         }
         else if (underlying == typeof(int))
         {
-            _native.zvec_doc_set_int32(docPtr, fieldName, (int)value);
+            _native.zvec_doc_set_int32_by_id(docPtr, fieldId, (int)value);
         }
         else if (underlying == typeof(long))
         {
-            _native.zvec_doc_set_int64(docPtr, fieldName, (long)value);
+            _native.zvec_doc_set_int64_by_id(docPtr, fieldId, (long)value);
         }
         else if (underlying == typeof(float))
         {
-            _native.zvec_doc_set_float(docPtr, fieldName, (float)value);
+            _native.zvec_doc_set_float_by_id(docPtr, fieldId, (float)value);
         }
         else if (underlying == typeof(double))
         {
-            _native.zvec_doc_set_double(docPtr, fieldName, (double)value);
+            _native.zvec_doc_set_double_by_id(docPtr, fieldId, (double)value);
         }
         else if (underlying == typeof(bool))
         {
-            _native.zvec_doc_set_bool(docPtr, fieldName, (bool)value ? 1 : 0);
+            _native.zvec_doc_set_bool_by_id(docPtr, fieldId, (bool)value ? 1 : 0);
         }
     }
 
-    private void SetVectorValue(IntPtr docPtr, string fieldName, object? value, PropertyInfo prop)
+    private NativeStatus SetVectorValue(IntPtr docPtr, IntPtr fieldId, object? value, VectorPrecision precision)
     {
-        if (value == null) return;
+        if (value == null) return default;
 
-        var attr = prop.GetCustomAttribute<VectorFieldAttribute>();
-        if (attr == null) return;
-
-        if (attr.Precision == VectorPrecision.Float32 && value is float[] f32Arr && f32Arr.Length > 0)
+        // Each precision is written in its own element type; nothing is widened to float32.
+        unsafe
         {
-            unsafe
+            switch (precision)
             {
-                fixed (float* ptr = f32Arr)
-                {
-                    _native.zvec_doc_set_vector_f32(docPtr, fieldName, in *ptr, (nuint)f32Arr.Length);
-                }
+                case VectorPrecision.Float32 when value is float[] { Length: > 0 } f32Arr:
+                    fixed (float* ptr = f32Arr)
+                    {
+                        return _native.zvec_doc_set_vector_f32_by_id(docPtr, fieldId, in *ptr, (nuint)f32Arr.Length);
+                    }
+                case VectorPrecision.Float16 when value is Half[] { Length: > 0 } f16Arr:
+                    fixed (Half* ptr = f16Arr)
+                    {
+                        return _native.zvec_doc_set_vector_f16_by_id(docPtr, fieldId, in *(ushort*)ptr, (nuint)f16Arr.Length);
+                    }
+                case VectorPrecision.Int8 when value is sbyte[] { Length: > 0 } i8Arr:
+                    fixed (sbyte* ptr = i8Arr)
+                    {
+                        return _native.zvec_doc_set_vector_i8_by_id(docPtr, fieldId, in *ptr, (nuint)i8Arr.Length);
+                    }
+                case VectorPrecision.Int16 when value is short[] { Length: > 0 } i16Arr:
+                    fixed (short* ptr = i16Arr)
+                    {
+                        return _native.zvec_doc_set_vector_i16_by_id(docPtr, fieldId, in *ptr, (nuint)i16Arr.Length);
+                    }
+                case VectorPrecision.SparseFloat32 when value is SparseVector { Count: > 0 } sparse:
+                    fixed (uint* indices = sparse.IndicesSpan)
+                    fixed (float* values = sparse.ValuesSpan)
+                    {
+                        return _native.zvec_doc_set_sparse_vector_f32_by_id(docPtr, fieldId, in *indices, in *values, (nuint)sparse.Count);
+                    }
             }
         }
+
+        return default;
     }
 
     private Dictionary<string, PropertyInfo> GetFieldProperties()
@@ -0,0 +1,26 @@
+namespace Zvec.Net.Diagnostics;
+
+/// <summary>
+/// Counters and latency percentiles the native layer recorded for one operation or phase.
+/// </summary>
+/// <remarks>
+/// Percentiles come from a log-linear histogram and are accurate to within a quarter of their value.
+/// </remarks>
+public sealed class OperationMetrics
+{
+    /// <summary>
+    /// Gets the operation name, such as <c>query</c>, <c>query.engine</c> or <c>write.convert</c>.
+    /// </summary>
+    public string Operation { get; init; } = string.Empty;
+
+    public long Count { get; init; }
+    public long Errors { get; init; }
+    public TimeSpan TotalTime { get; init; }
+    public TimeSpan Max { get; init; }
+    public TimeSpan P50 { get; init; }
+    public TimeSpan P90 { get; init; }
+    public TimeSpan P99 { get; init; }
+
+    public override string ToString() =>
+        $"OperationMetrics[{Operation}: Count={Count}, Errors={Errors}, P50={P50}, P99={P99}, Max={Max}]";
+}
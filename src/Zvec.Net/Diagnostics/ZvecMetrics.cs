@@ -0,0 +1,151 @@
+using System.Diagnostics;
+using System.Diagnostics.Metrics;
+using System.Runtime.InteropServices;
+using Zvec.Net.Native;
+
+namespace Zvec.Net.Diagnostics;
+
+/// <summary>
+/// Latency metrics for calls into the native layer, published on the <see cref="MeterName"/> meter.
+/// </summary>
+/// <remarks>
+/// <para>
+/// The native layer times every collection-level call, and breaks queries into
+/// <c>query.prepare</c>, <c>query.engine</c> and <c>query.materialize</c> and writes into
+/// <c>write.convert</c> and <c>write.engine</c>. Imports, exports, warmups, tuning, snapshots,
+/// refreshes, prepared queries, id sets and bulk loads each have their own operation, such as
+/// <c>import</c> or <c>bulk_load.end</c>. These are observed as <c>zvec.native.calls</c>,
+/// <c>zvec.native.errors</c>, <c>zvec.native.time</c> and the <c>zvec.native.latency</c> gauge,
+/// tagged with <c>zvec.operation</c> (and <c>quantile</c> for the gauge).
+/// </para>
+/// <para>
+/// <c>zvec.client.duration</c> records the managed duration of the same calls; the difference from
+/// the native <c>query</c> or <c>insert</c> time is spent marshalling in managed code.
+/// </para>
+/// <para>
+/// <c>zvec.query.truncated</c> counts id-filtered queries that returned fewer hits than asked for
+/// because the native search reached its candidate cap.
+/// </para>
+/// </remarks>
+public static class ZvecMetrics
+{
+    /// <summary>
+    /// The name of the meter the instruments are published on.
+    /// </summary>
+    public const string MeterName = "Zvec.Net";
+
+    internal const string OperationTag = "zvec.operation";
+
+    private static readonly Meter s_meter = CreateMeter(NativeMethodsWrapper.Instance);
+
+    private static readonly Histogram<double> s_clientDuration = s_meter.CreateHistogram<double>(
+        "zvec.client.duration", "s", "Managed duration of collection calls, marshalling included.");
+
+    private static readonly Counter<long> s_queryTruncated = s_meter.CreateCounter<long>(
+        "zvec.query.truncated", "{query}", "Id-filtered queries cut short by the candidate cap.");
+
+    /// <summary>
+    /// Reads the native counters for every operation and phase.
+    /// </summary>
+    /// <returns>One entry per operation, including those with no calls yet.</returns>
+    public static IReadOnlyList<OperationMetrics> Snapshot() => Snapshot(NativeMethodsWrapper.Instance);
+
+    /// <summary>
+    /// Clears the native counters and histograms.
+    /// </summary>
+    public static void Reset() => Reset(NativeMethodsWrapper.Instance);
+
+    internal static void Reset(INativeMethods native) => native.zvec_metrics_reset();
+
+    internal static IReadOnlyList<OperationMetrics> Snapshot(INativeMethods native)
+    {
+        var metrics = new NativeOpMetrics[NativeOpMetrics.OpCount];
+        native.zvec_metrics_snapshot(metrics, (nuint)metrics.Length).ThrowIfError("Metrics snapshot");
+
+        var result = new OperationMetrics[metrics.Length];
+        for (int op = 0; op < metrics.Length; op++)
+        {
+            ref readonly var m = ref metrics[op];
+            result[op] = new OperationMetrics
+            {
+                Operation = Marshal.PtrToStringUTF8(native.zvec_metrics_op_name(op)) ?? op.ToString(),
+                Count = (long)m.Count,
+                Errors = (long)m.Errors,
+                TotalTime = FromNanoseconds(m.TotalNs),
+                Max = FromNanoseconds(m.MaxNs),
+                P50 = FromNanoseconds(m.P50Ns),
+                P90 = FromNanoseconds(m.P90Ns),
+                P99 = FromNanoseconds(m.P99Ns)
+            };
+        }
+        return result;
+    }
+
+    internal static Meter CreateMeter(INativeMethods native)
+    {
+        var meter = new Meter(MeterName);
+
+        meter.CreateObservableCounter("zvec.native.calls",
+            () => Observe(native, m => m.Count), "{call}", "Native calls per operation.");
+        meter.CreateObservableCounter("zvec.native.errors",
+            () => Observe(native, m => m.Errors), "{call}", "Native calls that returned an error.");
+        meter.CreateObservableCounter("zvec.native.time",
+            () => Observe(native, m => m.TotalTime.TotalSeconds), "s", "Total native time per operation.");
+        meter.CreateObservableGauge("zvec.native.latency",
+            () => ObserveLatency(native), "s", "Native latency percentiles per operation.");
+
+        return meter;
+    }
+
+    /// <summary>
+    /// Starts timing a managed call; the returned timer records it when disposed.
+    /// </summary>
+    internal static CallTimer Time(string operation) =>
+        s_clientDuration.Enabled ? new CallTimer(operation, Stopwatch.GetTimestamp()) : default;
+
+    internal static void RecordTruncatedQuery() => s_queryTruncated.Add(1);
+
+    private static IEnumerable<Measurement<T>> Observe<T>(INativeMethods native, Func<OperationMetrics, T> value)
+        where T : struct
+    {
+        foreach (var m in Snapshot(native))
+        {
+            yield return new Measurement<T>(value(m), new KeyValuePair<string, object?>(OperationTag, m.Operation));
+        }
+    }
+
+    private static IEnumerable<Measurement<double>> ObserveLatency(INativeMethods native)
+    {
+        foreach (var m in Snapshot(native))
+        {
+            if (m.Count == 0) continue;
+
+            var operation = new KeyValuePair<string, object?>(OperationTag, m.Operation);
+            yield return new Measurement<double>(m.P50.TotalSeconds, operation, new("quantile", "p50"));
+            yield return new Measurement<double>(m.P90.TotalSeconds, operation, new("quantile", "p90"));
+            yield return new Measurement<double>(m.P99.TotalSeconds, operation, new("quantile", "p99"));
+            yield return new Measurement<double>(m.Max.TotalSeconds, operation, new("quantile", "max"));
+        }
+    }
+
+    private static TimeSpan FromNanoseconds(ulong ns) => TimeSpan.FromTicks((long)(ns / 100));
+
+    internal readonly struct CallTimer : IDisposable
+    {
+        private readonly string? _operation;
+        private readonly long _start;
+
+        public CallTimer(string operation, long start)
+        {
+            _operation = operation;
+            _start = start;
+        }
+
+        public void Dispose()
+        {
+            if (_operation == null) return;
+            s_clientDuration.Record(Stopwatch.GetElapsedTime(_start).TotalSeconds,
+                new KeyValuePair<string, object?>(OperationTag, _operation));
+        }
+    }
+}
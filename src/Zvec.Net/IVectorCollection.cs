@@ -10,6 +10,8 @@ public interface IVectorCollection : IDisposable
     string Path { get; }
     CollectionSchema Schema { get; }
     CollectionStats Stats { get; }
+    QueryCacheStats QueryCacheStats { get; }
+    bool IsReadOnly { get; }
 }
 
 public interface IVectorCollection<T> : IVectorCollection where T : IDocument
@@ -33,15 +35,28 @@ public interface IVectorCollection<T> : IVectorCollection where T : IDocument
     Status DeleteByFilter(string filter);
     Task<Status> DeleteByFilterAsync(string filter, CancellationToken cancellationToken = default);
 
+    BatchWriteResult InsertWithStatus(IEnumerable<T> documents);
+    BatchWriteResult UpsertWithStatus(IEnumerable<T> documents);
+    BatchWriteResult UpdateWithStatus(IEnumerable<T> documents);
+    BatchWriteResult DeleteWithStatus(IEnumerable<string> ids);
+
     IVectorQueryBuilder<T> Query();
 
     IReadOnlyList<T> Query(VectorQuery vectorQuery, QueryOptions? options = null);
     Task<IReadOnlyList<T>> QueryAsync(VectorQuery vectorQuery, QueryOptions? options = null, CancellationToken cancellationToken = default);
 
+    IReadOnlyList<IReadOnlyList<T>> QueryBatch(string fieldName, IReadOnlyList<float[]> vectors, QueryOptions? options = null, IndexQueryParam? param = null);
+    Task<IReadOnlyList<IReadOnlyList<T>>> QueryBatchAsync(string fieldName, IReadOnlyList<float[]> vectors, QueryOptions? options = null, IndexQueryParam? param = null, CancellationToken cancellationToken = default);
+
+    IPreparedQuery<T> Prepare(string fieldName, QueryOptions? options = null, IndexQueryParam? param = null);
+
     IReadOnlyDictionary<string, T> Fetch(params string[] ids);
     IReadOnlyDictionary<string, T> Fetch(IEnumerable<string> ids);
     Task<IReadOnlyDictionary<string, T>> FetchAsync(IEnumerable<string> ids, CancellationToken cancellationToken = default);
 
+    IEnumerable<T> Scan(ScanOptions? options = null);
+    IAsyncEnumerable<T> ScanAsync(ScanOptions? options = null, CancellationToken cancellationToken = default);
+
     void Flush();
     Task FlushAsync(CancellationToken cancellationToken = default);
 
@@ -54,5 +69,31 @@ public interface IVectorCollection<T> : IVectorCollection where T : IDocument
     void Optimize();
     Task OptimizeAsync(CancellationToken cancellationToken = default);
 
+    void Refresh();
+    IVectorCollection<T> CreateSnapshot();
+
+    QueryTuningResult TuneQuery(string fieldName, IReadOnlyList<float[]> sampleQueries, QueryTuningOptions? options = null);
+    void SetQueryDefaults(string fieldName, IndexQueryParam? param);
+
+    void StartAutoOptimize(AutoOptimizePolicy? policy = null);
+    void StopAutoOptimize();
+    void PauseAutoOptimize();
+    void ResumeAutoOptimize();
+    AutoOptimizeStatus AutoOptimizeStatus { get; }
+
+    WarmupProgress Warmup(WarmupOptions? options = null);
+    Task<WarmupProgress> WarmupAsync(WarmupOptions? options = null, IProgress<WarmupProgress>? progress = null, CancellationToken cancellationToken = default);
+    WarmupProgress WarmupProgress { get; }
+    void CancelWarmup();
+
+    ImportResult Import(string path, string vectorField, ImportOptions? options = null);
+    Task<ImportResult> ImportAsync(string path, string vectorField, ImportOptions? options = null, CancellationToken cancellationToken = default);
+    ExportResult Export(string path, ExportOptions? options = null);
+    Task<ExportResult> ExportAsync(string path, ExportOptions? options = null, CancellationToken cancellationToken = default);
+
+    void BeginBulkLoad();
+    void EndBulkLoad();
+    Task EndBulkLoadAsync(CancellationToken cancellationToken = default);
+
     void Destroy();
 }
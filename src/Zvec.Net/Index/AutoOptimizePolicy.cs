@@ -0,0 +1,57 @@
+namespace Zvec.Net.Index;
+
+/// <summary>
+/// Thresholds and throttling for the background optimizer started by
+/// <see cref="Collection{T}.StartAutoOptimize"/>.
+/// </summary>
+public sealed class AutoOptimizePolicy
+{
+    /// <summary>
+    /// Gets or sets how often the thresholds are checked.
+    /// </summary>
+    /// <remarks>
+    /// Default is 1 second.
+    /// </remarks>
+    public TimeSpan CheckInterval { get; set; } = TimeSpan.FromSeconds(1);
+
+    /// <summary>
+    /// Gets or sets the minimum time between two background runs.
+    /// </summary>
+    /// <remarks>
+    /// Default is 1 minute.
+    /// </remarks>
+    public TimeSpan MinInterval { get; set; } = TimeSpan.FromMinutes(1);
+
+    /// <summary>
+    /// Gets or sets how many documents written since the last optimize trigger a run.
+    /// </summary>
+    /// <remarks>
+    /// Default is 100,000. Set to 0 so that writes never trigger a run.
+    /// </remarks>
+    public long PendingWrites { get; set; } = 100_000;
+
+    /// <summary>
+    /// Gets or sets the share of live documents deleted since the last optimize that triggers a run.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0.2. Set to 0 so that deletes never trigger a run.
+    /// </remarks>
+    public double DeletedRatio { get; set; } = 0.2;
+
+    /// <summary>
+    /// Gets or sets the number of threads each background run uses.
+    /// </summary>
+    /// <remarks>
+    /// Default is 1, leaving the remaining cores to queries and writes.
+    /// </remarks>
+    public int Concurrency { get; set; } = 1;
+
+    /// <summary>
+    /// Gets or sets the largest share of wall time, in percent, spent optimizing.
+    /// </summary>
+    /// <remarks>
+    /// Default is 25: after a run of 10 seconds the next one waits at least 30 seconds.
+    /// Set to 100 for no limit beyond <see cref="MinInterval"/>.
+    /// </remarks>
+    public int BudgetPercent { get; set; } = 25;
+}
@@ -12,6 +12,7 @@ public sealed class CollectionOptions
     /// </summary>
     /// <remarks>
     /// Default is 1,000,000. Larger values mean fewer segments but more memory usage.
+    /// Only applied when the collection is created.
     /// </remarks>
     public int SegmentMaxDocs { get; set; } = 1_000_000;
 
@@ -19,7 +20,7 @@ public sealed class CollectionOptions
     /// Gets or sets the number of parallel threads for index building.
     /// </summary>
     /// <remarks>
-    /// Default is 0 (auto-detect based on CPU cores).
+    /// Default is 0 (auto-detect based on CPU cores). Also used by Optimize() and when a bulk load ends.
     /// </remarks>
     public int IndexBuildParallel { get; set; } = 0;
 
@@ -27,7 +28,26 @@ public sealed class CollectionOptions
     /// Gets or sets whether changes are automatically flushed after write operations.
     /// </summary>
     /// <remarks>
-    /// Default is true. Set to false for bulk load performance, then call Flush() manually.
+    /// Default is false: call Flush() to persist writes, or wrap a load in
+    /// BeginBulkLoad()/EndBulkLoad(). When true, every write is followed by a flush.
     /// </remarks>
-    public bool AutoFlush { get; set; } = true;
+    public bool AutoFlush { get; set; }
+
+    /// <summary>
+    /// Gets or sets the number of native worker threads used by batch queries.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0 (auto-detect based on CPU cores). The workers are started on the first batch query.
+    /// </remarks>
+    public int QueryParallel { get; set; } = 0;
+
+    /// <summary>
+    /// Gets or sets how many single-query results the native layer keeps in its result cache.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0 (cache off). A repeated query with the same vector, filter, top-k, parameters
+    /// and output fields is answered from the cache until the next write, delete, optimize or
+    /// index change. Multi-vector and batch queries are never cached.
+    /// </remarks>
+    public int QueryCacheSize { get; set; } = 0;
 }
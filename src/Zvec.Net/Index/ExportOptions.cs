@@ -0,0 +1,57 @@
+using Zvec.Net.Types;
+
+namespace Zvec.Net.Index;
+
+/// <summary>
+/// Settings for <see cref="Collection{T}.Export"/>.
+/// </summary>
+public sealed class ExportOptions
+{
+    /// <summary>
+    /// Gets or sets the file format.
+    /// </summary>
+    /// <remarks>
+    /// Default is <see cref="ExportFormat.Auto"/>, which picks the format from the file extension.
+    /// </remarks>
+    public ExportFormat Format { get; set; } = ExportFormat.Auto;
+
+    /// <summary>
+    /// Gets or sets the fields written after the primary key column.
+    /// </summary>
+    /// <remarks>
+    /// Default is null; null or empty writes every scalar and dense vector field. Sparse vector fields cannot be exported.
+    /// </remarks>
+    public IReadOnlyList<string>? Fields { get; set; }
+
+    /// <summary>
+    /// Gets or sets a filter expression selecting the documents written.
+    /// </summary>
+    /// <remarks>
+    /// Default is null (every document).
+    /// </remarks>
+    public string? Filter { get; set; }
+
+    /// <summary>
+    /// Gets or sets the name of the primary key column.
+    /// </summary>
+    /// <remarks>
+    /// Default is null, which names it "pk".
+    /// </remarks>
+    public string? PkColumn { get; set; }
+
+    /// <summary>
+    /// Gets or sets the number of documents fetched and written per batch.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0, which uses 16384.
+    /// </remarks>
+    public int BatchRows { get; set; }
+
+    /// <summary>
+    /// Gets or sets the number of batches fetched and converted at once.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0, which uses one per hardware thread. Memory holds this many batches plus the one being written.
+    /// </remarks>
+    public int Concurrency { get; set; }
+}
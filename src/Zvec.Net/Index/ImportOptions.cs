@@ -0,0 +1,82 @@
+using Zvec.Net.Types;
+
+namespace Zvec.Net.Index;
+
+/// <summary>
+/// Settings for <see cref="Collection{T}.Import"/>.
+/// </summary>
+public sealed class ImportOptions
+{
+    /// <summary>
+    /// Gets or sets the file format.
+    /// </summary>
+    /// <remarks>
+    /// Default is <see cref="ImportFormat.Auto"/>, which picks the format from the file extension.
+    /// </remarks>
+    public ImportFormat Format { get; set; } = ImportFormat.Auto;
+
+    /// <summary>
+    /// Gets or sets the Parquet/Arrow column holding the vectors.
+    /// </summary>
+    /// <remarks>
+    /// Default is null, which uses the vector field's name. The column must be a list or
+    /// fixed-size list of float, double, half-float, int8 or int16.
+    /// </remarks>
+    public string? VectorColumn { get; set; }
+
+    /// <summary>
+    /// Gets or sets the Parquet/Arrow column holding the primary keys, as strings or integers.
+    /// </summary>
+    /// <remarks>
+    /// Default is null, which generates keys from <see cref="PkPrefix"/> and the row number.
+    /// </remarks>
+    public string? PkColumn { get; set; }
+
+    /// <summary>
+    /// Gets or sets the prefix of generated primary keys.
+    /// </summary>
+    /// <remarks>
+    /// Default is null (no prefix).
+    /// </remarks>
+    public string? PkPrefix { get; set; }
+
+    /// <summary>
+    /// Gets or sets the row number of the first generated primary key.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0.
+    /// </remarks>
+    public long PkStart { get; set; }
+
+    /// <summary>
+    /// Gets or sets the Parquet/Arrow columns copied to scalar fields of the same name.
+    /// </summary>
+    /// <remarks>
+    /// Default is null (no scalar fields).
+    /// </remarks>
+    public IReadOnlyList<string>? ScalarColumns { get; set; }
+
+    /// <summary>
+    /// Gets or sets the number of rows read, converted and written at a time.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0, which uses 16384. Arrow IPC files never return more rows than one record batch.
+    /// </remarks>
+    public int ChunkRows { get; set; }
+
+    /// <summary>
+    /// Gets or sets the maximum number of rows imported.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0 (every row).
+    /// </remarks>
+    public long MaxRows { get; set; }
+
+    /// <summary>
+    /// Gets or sets a value indicating whether rows are upserted instead of inserted.
+    /// </summary>
+    /// <remarks>
+    /// Default is false.
+    /// </remarks>
+    public bool Upsert { get; set; }
+}
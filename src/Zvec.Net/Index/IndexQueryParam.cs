@@ -18,6 +18,36 @@ public abstract record IndexQueryParam
     /// <param name="nProbe">Number of clusters to search (default: 64).</param>
     /// <returns>IVF query parameters.</returns>
     public static IvfQueryParam Ivf(int nProbe = 64) => new() { NProbe = nProbe };
+
+    /// <summary>
+    /// Creates flat (brute-force index) query parameters.
+    /// </summary>
+    /// <returns>Flat query parameters.</returns>
+    public static FlatQueryParam Flat() => new();
+
+    /// <summary>
+    /// Gets or sets the search radius; results farther than this are dropped.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0 (no radius limit).
+    /// </remarks>
+    public float Radius { get; init; }
+
+    /// <summary>
+    /// Gets or sets whether to scan all vectors linearly instead of using the index.
+    /// </summary>
+    /// <remarks>
+    /// Gives exact results at brute-force cost. Useful for measuring recall.
+    /// </remarks>
+    public bool IsLinear { get; init; }
+
+    /// <summary>
+    /// Gets or sets whether candidates are re-scored with full-precision vectors.
+    /// </summary>
+    /// <remarks>
+    /// Only has an effect on quantized indexes.
+    /// </remarks>
+    public bool UseRefiner { get; init; }
 }
 
 /// <summary>
@@ -46,4 +76,26 @@ public sealed record IvfQueryParam : IndexQueryParam
     /// Higher values improve recall but reduce speed.
     /// </remarks>
     public int NProbe { get; init; } = 64;
+
+    /// <summary>
+    /// Gets or sets how many candidates per result the refiner re-scores.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0 (engine default). Only used when <see cref="IndexQueryParam.UseRefiner"/> is set.
+    /// </remarks>
+    public float RefineFactor { get; init; }
+}
+
+/// <summary>
+/// Query-time parameters for flat index.
+/// </summary>
+public sealed record FlatQueryParam : IndexQueryParam
+{
+    /// <summary>
+    /// Gets or sets how many candidates per result the refiner re-scores.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0 (engine default). Only used when <see cref="IndexQueryParam.UseRefiner"/> is set.
+    /// </remarks>
+    public float RefineFactor { get; init; }
 }
@@ -0,0 +1,47 @@
+namespace Zvec.Net.Index;
+
+/// <summary>
+/// Settings for <see cref="Collection{T}.TuneQuery"/>.
+/// </summary>
+public sealed class QueryTuningOptions
+{
+    /// <summary>
+    /// Gets or sets the number of results recall is measured over.
+    /// </summary>
+    /// <remarks>
+    /// Default is 10.
+    /// </remarks>
+    public int TopK { get; set; } = 10;
+
+    /// <summary>
+    /// Gets or sets the recall@TopK the recommended setting has to reach.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0.95.
+    /// </remarks>
+    public double TargetRecall { get; set; } = 0.95;
+
+    /// <summary>
+    /// Gets or sets the ef (HNSW) or nprobe (IVF) values to try.
+    /// </summary>
+    /// <remarks>
+    /// Default is null, which sweeps a built-in ladder from TopK to 512 for HNSW and 1 to 256 for IVF.
+    /// </remarks>
+    public IReadOnlyList<int>? Candidates { get; set; }
+
+    /// <summary>
+    /// Gets or sets a filter applied to every sample query and its ground truth.
+    /// </summary>
+    /// <remarks>
+    /// Default is null (no filter).
+    /// </remarks>
+    public string? Filter { get; set; }
+
+    /// <summary>
+    /// Gets or sets whether the recommended setting becomes the field's query default.
+    /// </summary>
+    /// <remarks>
+    /// Default is false. See <see cref="Collection{T}.SetQueryDefaults"/>.
+    /// </remarks>
+    public bool Apply { get; set; }
+}
@@ -0,0 +1,40 @@
+namespace Zvec.Net.Index;
+
+/// <summary>
+/// Settings for <see cref="Collection{T}.Warmup"/>.
+/// </summary>
+public sealed class WarmupOptions
+{
+    /// <summary>
+    /// Gets or sets the maximum number of bytes read into the page cache.
+    /// </summary>
+    /// <remarks>
+    /// Default is 0 (no limit).
+    /// </remarks>
+    public long ByteBudget { get; set; }
+
+    /// <summary>
+    /// Gets or sets the vector field <see cref="ReplayQueries"/> run against.
+    /// </summary>
+    /// <remarks>
+    /// Default is null. Required when <see cref="ReplayQueries"/> is set. Replaying queries is the
+    /// way to warm one field: the file pass reads every file.
+    /// </remarks>
+    public string? ReplayField { get; set; }
+
+    /// <summary>
+    /// Gets or sets representative queries run after the files are read; their results are dropped.
+    /// </summary>
+    /// <remarks>
+    /// Default is null (no queries). All vectors must have the same dimension.
+    /// </remarks>
+    public IReadOnlyList<float[]>? ReplayQueries { get; set; }
+
+    /// <summary>
+    /// Gets or sets the number of results each replayed query asks for.
+    /// </summary>
+    /// <remarks>
+    /// Default is 10.
+    /// </remarks>
+    public int TopK { get; set; } = 10;
+}
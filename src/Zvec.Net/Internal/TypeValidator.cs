@@ -42,6 +42,7 @@ internal static class TypeValidator
         VectorPrecision.Float32 => typeof(float[]),
         VectorPrecision.Float16 => typeof(Half[]),
         VectorPrecision.Int8 => typeof(sbyte[]),
+        VectorPrecision.Int16 => typeof(short[]),
         VectorPrecision.SparseFloat32 => typeof(SparseVector),
         VectorPrecision.SparseFloat16 => typeof(SparseVector),
         _ => throw new ArgumentOutOfRangeException(nameof(precision), precision, "Unknown precision")
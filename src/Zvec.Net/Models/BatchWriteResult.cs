@@ -0,0 +1,72 @@
+using Zvec.Net.Internal;
+
+namespace Zvec.Net.Models;
+
+/// <summary>
+/// Represents the outcome of a batch write, one status per document.
+/// </summary>
+/// <remarks>
+/// <see cref="Status"/> reports whether the write ran at all; <see cref="Items"/> reports each
+/// document in input order. Use <see cref="SelectFailed{TItem}"/> to retry only the documents
+/// that failed.
+/// </remarks>
+public sealed class BatchWriteResult
+{
+    /// <summary>
+    /// Gets the status of the write as a whole.
+    /// </summary>
+    /// <remarks>
+    /// An error here means the batch could not be written (for example a read-only collection or
+    /// a failed flush); documents that failed individually do not set it.
+    /// </remarks>
+    public Status Status { get; init; } = Status.Ok;
+
+    /// <summary>
+    /// Gets the status of each document, in input order.
+    /// </summary>
+    public IReadOnlyList<Status> Items { get; init; } = Array.Empty<Status>();
+
+    /// <summary>
+    /// Gets the input positions of the documents that failed, in ascending order.
+    /// </summary>
+    public IReadOnlyList<int> FailedIndices { get; init; } = Array.Empty<int>();
+
+    /// <summary>
+    /// Gets the number of documents that failed.
+    /// </summary>
+    public int FailedCount => FailedIndices.Count;
+
+    /// <summary>
+    /// Gets a value indicating whether the write ran and every document was written.
+    /// </summary>
+    public bool IsOk => Status.IsOk && FailedCount == 0;
+
+    /// <summary>
+    /// Returns the elements of <paramref name="items"/> at <see cref="FailedIndices"/>.
+    /// </summary>
+    /// <typeparam name="TItem">The element type.</typeparam>
+    /// <param name="items">The documents or ids passed to the write, in the same order.</param>
+    /// <returns>The failed elements, in input order.</returns>
+    /// <exception cref="ArgumentException">Thrown when <paramref name="items"/> does not match the batch size.</exception>
+    public IReadOnlyList<TItem> SelectFailed<TItem>(IReadOnlyList<TItem> items)
+    {
+        ThrowHelper.ThrowIfNull(items, nameof(items));
+        if (items.Count != Items.Count)
+        {
+            throw new ArgumentException($"Expected {Items.Count} items, got {items.Count}", nameof(items));
+        }
+
+        var failed = new TItem[FailedIndices.Count];
+        for (int i = 0; i < failed.Length; i++)
+        {
+            failed[i] = items[FailedIndices[i]];
+        }
+        return failed;
+    }
+
+    /// <summary>
+    /// Returns a string representation of this result.
+    /// </summary>
+    /// <returns>The overall status and the failed count.</returns>
+    public override string ToString() => $"BatchWriteResult[Status={Status}, Count={Items.Count}, Failed={FailedCount}]";
+}
@@ -65,6 +65,10 @@ public sealed class SparseVector
     /// </summary>
     public IReadOnlyList<float> Values => _values;
 
+    internal ReadOnlySpan<uint> IndicesSpan => _indices;
+
+    internal ReadOnlySpan<float> ValuesSpan => _values;
+
     /// <summary>
     /// Gets an empty sparse vector.
     /// </summary>
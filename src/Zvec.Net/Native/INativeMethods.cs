@@ -25,10 +25,16 @@ internal interface INativeMethods
 
     // Vector setters
     NativeStatus zvec_doc_set_vector_f32(IntPtr handle, string field, in float data, nuint len);
+    NativeStatus zvec_doc_set_vector_f16(IntPtr handle, string field, in ushort data, nuint len);
+    NativeStatus zvec_doc_set_vector_i8(IntPtr handle, string field, in sbyte data, nuint len);
+    NativeStatus zvec_doc_set_vector_i16(IntPtr handle, string field, in short data, nuint len);
     NativeStatus zvec_doc_set_sparse_vector_f32(IntPtr handle, string field, in uint indices, in float values, nuint len);
 
     // Vector getters
     nuint zvec_doc_get_vector_f32(IntPtr handle, string field, out float outData, nuint maxLen);
+    nuint zvec_doc_get_vector_f16(IntPtr handle, string field, out ushort outData, nuint maxLen);
+    nuint zvec_doc_get_vector_i8(IntPtr handle, string field, out sbyte outData, nuint maxLen);
+    nuint zvec_doc_get_vector_i16(IntPtr handle, string field, out short outData, nuint maxLen);
 
     // Field getters
     int zvec_doc_has_field(IntPtr handle, string field);
@@ -37,6 +43,28 @@ internal interface INativeMethods
     double zvec_doc_get_double(IntPtr handle, string field);
     int zvec_doc_get_bool(IntPtr handle, string field);
 
+    // Resolved fields
+    NativeStatus zvec_collection_resolve_field(IntPtr handle, string name, int dataType, out IntPtr outField);
+    NativeStatus zvec_doc_set_string_by_id(IntPtr handle, IntPtr field, string? value);
+    NativeStatus zvec_doc_set_int32_by_id(IntPtr handle, IntPtr field, int value);
+    NativeStatus zvec_doc_set_int64_by_id(IntPtr handle, IntPtr field, long value);
+    NativeStatus zvec_doc_set_float_by_id(IntPtr handle, IntPtr field, float value);
+    NativeStatus zvec_doc_set_double_by_id(IntPtr handle, IntPtr field, double value);
+    NativeStatus zvec_doc_set_bool_by_id(IntPtr handle, IntPtr field, int value);
+    NativeStatus zvec_doc_set_null_by_id(IntPtr handle, IntPtr field);
+    NativeStatus zvec_doc_set_vector_f32_by_id(IntPtr handle, IntPtr field, in float data, nuint len);
+    NativeStatus zvec_doc_set_vector_f16_by_id(IntPtr handle, IntPtr field, in ushort data, nuint len);
+    NativeStatus zvec_doc_set_vector_i8_by_id(IntPtr handle, IntPtr field, in sbyte data, nuint len);
+    NativeStatus zvec_doc_set_vector_i16_by_id(IntPtr handle, IntPtr field, in short data, nuint len);
+    NativeStatus zvec_doc_set_sparse_vector_f32_by_id(IntPtr handle, IntPtr field, in uint indices, in float values, nuint len);
+
+    // Document batch
+    IntPtr zvec_doc_batch_create(nuint capacity);
+    void zvec_doc_batch_destroy(IntPtr batch);
+    IntPtr zvec_doc_batch_add(IntPtr batch);
+    void zvec_doc_batch_clear(IntPtr batch);
+    nuint zvec_doc_batch_count(IntPtr batch);
+
     // Schema creation
     IntPtr zvec_schema_create(string name);
     void zvec_schema_destroy(IntPtr handle);
@@ -57,32 +85,114 @@ internal interface INativeMethods
     void zvec_query_set_topk(IntPtr handle, int topk);
     void zvec_query_set_field_name(IntPtr handle, string fieldName);
     void zvec_query_set_vector(IntPtr handle, in float data, nuint len);
+    void zvec_query_set_vector_f16(IntPtr handle, in ushort data, nuint len);
+    void zvec_query_set_vector_i8(IntPtr handle, in sbyte data, nuint len);
+    void zvec_query_set_vector_i16(IntPtr handle, in short data, nuint len);
+    void zvec_query_set_sparse_vector(IntPtr handle, in uint indices, in float values, nuint len);
     void zvec_query_set_filter(IntPtr handle, string filter);
     void zvec_query_set_include_vector(IntPtr handle, int include);
     void zvec_query_set_output_fields(IntPtr handle, IntPtr fields, nuint count);
     void zvec_query_set_ef_search(IntPtr handle, int ef);
     void zvec_query_set_n_probe(IntPtr handle, int nProbe);
+    void zvec_query_set_params(IntPtr handle, in NativeQueryParams queryParams);
+
+    // Prepared queries
+    NativeStatus zvec_collection_prepare_query(IntPtr handle, IntPtr query, out IntPtr outPrepared);
+    void zvec_prepared_query_destroy(IntPtr prepared);
+    NativeStatus zvec_prepared_query_execute(IntPtr prepared, in float vector, nuint len, out IntPtr outResult);
+
+    // Id sets
+    NativeStatus zvec_id_set_create(string[] pks, nuint count, out IntPtr outSet);
+    void zvec_id_set_destroy(IntPtr set);
+    nuint zvec_id_set_count(IntPtr set);
+    void zvec_query_set_id_filter(IntPtr handle, IntPtr set, int mode);
 
     // Collection
     NativeStatus zvec_collection_create_and_open(string path, IntPtr schema, in NativeCollectionOptions options, out IntPtr outHandle);
     NativeStatus zvec_collection_open(string path, in NativeCollectionOptions options, out IntPtr outHandle);
+    NativeStatus zvec_collection_open_readonly(string path, in NativeCollectionOptions options, out IntPtr outHandle);
+    NativeStatus zvec_collection_refresh(IntPtr handle);
+    NativeStatus zvec_collection_snapshot_create(IntPtr handle, out IntPtr outSnapshot);
+    NativeStatus zvec_collection_snapshot_release(IntPtr snapshot);
     void zvec_collection_destroy(IntPtr handle);
     NativeStatus zvec_collection_destroy_data(IntPtr handle);
     NativeStatus zvec_collection_flush(IntPtr handle);
     NativeStatus zvec_collection_optimize(IntPtr handle);
+    NativeStatus zvec_collection_begin_bulk_load(IntPtr handle);
+    NativeStatus zvec_collection_end_bulk_load(IntPtr handle);
     NativeStatus zvec_collection_create_index(IntPtr handle, string fieldName, in NativeFieldDef indexDef);
     NativeStatus zvec_collection_drop_index(IntPtr handle, string fieldName);
     NativeStatus zvec_collection_insert(IntPtr handle, IntPtr[] docs, nuint count);
     NativeStatus zvec_collection_upsert(IntPtr handle, IntPtr[] docs, nuint count);
     NativeStatus zvec_collection_update(IntPtr handle, IntPtr[] docs, nuint count);
+    NativeStatus zvec_collection_insert_doc_batch(IntPtr handle, IntPtr batch);
+    NativeStatus zvec_collection_upsert_doc_batch(IntPtr handle, IntPtr batch);
+    NativeStatus zvec_collection_update_doc_batch(IntPtr handle, IntPtr batch);
+    NativeStatus zvec_collection_insert_columnar(IntPtr handle, in NativeColumnBatch batch);
+    NativeStatus zvec_collection_upsert_columnar(IntPtr handle, in NativeColumnBatch batch);
     NativeStatus zvec_collection_delete(IntPtr handle, string[] ids, nuint count);
     NativeStatus zvec_collection_delete_by_filter(IntPtr handle, string filter);
+    NativeStatus zvec_collection_insert_doc_batch_with_status(IntPtr handle, IntPtr batch, NativeDocStatus[] outStatuses, out nuint outFailed);
+    NativeStatus zvec_collection_upsert_doc_batch_with_status(IntPtr handle, IntPtr batch, NativeDocStatus[] outStatuses, out nuint outFailed);
+    NativeStatus zvec_collection_update_doc_batch_with_status(IntPtr handle, IntPtr batch, NativeDocStatus[] outStatuses, out nuint outFailed);
+    NativeStatus zvec_collection_insert_columnar_with_status(IntPtr handle, in NativeColumnBatch batch, NativeDocStatus[] outStatuses, out nuint outFailed);
+    NativeStatus zvec_collection_upsert_columnar_with_status(IntPtr handle, in NativeColumnBatch batch, NativeDocStatus[] outStatuses, out nuint outFailed);
+    NativeStatus zvec_collection_delete_with_status(IntPtr handle, string[] ids, nuint count, NativeDocStatus[] outStatuses, out nuint outFailed);
+    IntPtr zvec_write_status_message(int index);
     NativeStatus zvec_collection_query(IntPtr handle, IntPtr query, out IntPtr outResult);
+    NativeStatus zvec_collection_query_batch(IntPtr handle, IntPtr query, in float vectors, nuint queryCount, nuint dimension, IntPtr[] outResults);
+    NativeStatus zvec_collection_query_multi(IntPtr handle, IntPtr[] queries, nuint queryCount, in NativeFusion fusion, out IntPtr outResult);
     NativeStatus zvec_collection_fetch(IntPtr handle, string[] ids, nuint count, out IntPtr outResult);
+
+    // Async
+    NativeStatus zvec_collection_query_async(IntPtr handle, IntPtr query, IntPtr callback, IntPtr userData, out IntPtr op);
+    NativeStatus zvec_collection_insert_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op);
+    NativeStatus zvec_collection_upsert_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op);
+    NativeStatus zvec_collection_update_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op);
+    NativeStatus zvec_collection_insert_columnar_async(IntPtr handle, in NativeColumnBatch batch, IntPtr callback, IntPtr userData, out IntPtr op);
+    NativeStatus zvec_collection_upsert_columnar_async(IntPtr handle, in NativeColumnBatch batch, IntPtr callback, IntPtr userData, out IntPtr op);
+    NativeStatus zvec_collection_delete_async(IntPtr handle, string[] ids, nuint count, IntPtr callback, IntPtr userData, out IntPtr op);
+    void zvec_async_cancel(IntPtr op);
+    void zvec_async_release(IntPtr op);
     IntPtr zvec_collection_get_path(IntPtr handle);
+    NativeStatus zvec_collection_get_query_cache_stats(IntPtr handle, out NativeQueryCacheStats outStats);
+
+    // Query tuning
+    NativeStatus zvec_collection_tune(IntPtr handle, in NativeTuneRequest request, NativeTunePoint[] outPoints, nuint pointCapacity, out NativeTuneReport outReport);
+    NativeStatus zvec_collection_set_query_defaults(IntPtr handle, string fieldName, IntPtr queryParams);
+
+    // Background optimize
+    NativeStatus zvec_collection_start_auto_optimize(IntPtr handle, in NativeOptimizePolicy policy);
+    NativeStatus zvec_collection_stop_auto_optimize(IntPtr handle);
+    NativeStatus zvec_collection_pause_auto_optimize(IntPtr handle);
+    NativeStatus zvec_collection_resume_auto_optimize(IntPtr handle);
+    NativeStatus zvec_collection_get_auto_optimize_status(IntPtr handle, out NativeOptimizeStatus outStatus);
+
+    // Warmup
+    NativeStatus zvec_collection_warmup(IntPtr handle, in NativeWarmupOptions options, out NativeWarmupProgress outProgress);
+    NativeStatus zvec_collection_get_warmup_progress(IntPtr handle, out NativeWarmupProgress outProgress);
+    NativeStatus zvec_collection_cancel_warmup(IntPtr handle);
+
+    // Import
+    NativeStatus zvec_collection_import(IntPtr handle, string path, int format, in NativeImportMapping mapping, in NativeImportOptions options, out NativeImportReport outReport);
+
+    // Export
+    NativeStatus zvec_collection_export(IntPtr handle, string path, int format, in NativeExportOptions options, out NativeExportReport outReport);
+
+    // Metrics
+    NativeStatus zvec_metrics_snapshot(NativeOpMetrics[] outMetrics, nuint count);
+    void zvec_metrics_reset();
+    IntPtr zvec_metrics_op_name(int op);
+
+    // Scan
+    NativeStatus zvec_collection_scan_open(IntPtr handle, string? filter, string[]? outputFields, nuint outputFieldCount, int includeVector, nuint batchSize, out IntPtr outScan);
+    NativeStatus zvec_scan_next(IntPtr scan, out IntPtr outResult);
+    void zvec_scan_close(IntPtr scan);
 
     // Result
     void zvec_result_destroy(IntPtr handle);
     nuint zvec_result_count(IntPtr handle);
+    int zvec_result_truncated(IntPtr handle);
     IntPtr zvec_result_get_doc(IntPtr handle, nuint index);
+    NativeStatus zvec_result_export(IntPtr handle, NativeColumn[] columns, nuint columnCount, out NativeResultExport export);
 }
@@ -0,0 +1,164 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using Zvec.Net.Types;
+
+namespace Zvec.Net.Native;
+
+/// <summary>
+/// Bridges one <c>zvec_*_async</c> call to a task. The native completion callback completes the
+/// task directly, so no managed thread waits while the collection's worker pool runs the operation.
+/// </summary>
+internal abstract class NativeAsyncOperation
+{
+    /// <summary>
+    /// Submits the native operation with the shared completion callback and this operation as user data.
+    /// </summary>
+    public delegate NativeStatus Submit(IntPtr callback, IntPtr userData, out IntPtr op);
+
+    private readonly INativeMethods _native;
+    private CancellationTokenRegistration _registration;
+    private IntPtr _op;
+
+    // Released once by the callback and once after submission; the native op is freed on the last.
+    private int _pendingReleases = 2;
+
+    protected NativeAsyncOperation(INativeMethods native)
+    {
+        _native = native;
+    }
+
+    protected INativeMethods Native => _native;
+
+    private static unsafe IntPtr Callback =>
+        (IntPtr)(delegate* unmanaged[Cdecl]<IntPtr, NativeStatus, IntPtr, void>)&OnComplete;
+
+    protected void Start(Submit submit, CancellationToken cancellationToken)
+    {
+        var self = GCHandle.Alloc(this);
+        NativeStatus status;
+        IntPtr op;
+        try
+        {
+            status = submit(Callback, GCHandle.ToIntPtr(self), out op);
+        }
+        catch
+        {
+            self.Free();
+            throw;
+        }
+
+        if (!status.IsOk)
+        {
+            // Rejected before queueing: the callback will never run.
+            self.Free();
+            Complete(status, IntPtr.Zero);
+            return;
+        }
+
+        _op = op;
+        if (op != IntPtr.Zero && cancellationToken.CanBeCanceled)
+        {
+            _registration = cancellationToken.Register(
+                static state => ((NativeAsyncOperation)state!).Cancel(), this);
+        }
+        Release();
+    }
+
+    protected abstract void OnCompleted(in NativeStatus status, IntPtr result);
+
+    protected abstract void OnFailed(Exception exception);
+
+    private void Cancel() => _native.zvec_async_cancel(_op);
+
+    private void Complete(in NativeStatus status, IntPtr result)
+    {
+        try
+        {
+            OnCompleted(status, result);
+        }
+        catch (Exception ex)
+        {
+            OnFailed(ex);
+        }
+        finally
+        {
+            if (result != IntPtr.Zero)
+            {
+                _native.zvec_result_destroy(result);
+            }
+        }
+    }
+
+    private void Release()
+    {
+        if (Interlocked.Decrement(ref _pendingReleases) != 0) return;
+
+        _registration.Dispose();
+        if (_op != IntPtr.Zero)
+        {
+            _native.zvec_async_release(_op);
+        }
+    }
+
+    [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+    private static void OnComplete(IntPtr userData, NativeStatus status, IntPtr result)
+    {
+        var handle = GCHandle.FromIntPtr(userData);
+        var operation = (NativeAsyncOperation)handle.Target!;
+        handle.Free();
+
+        operation.Complete(status, result);
+        operation.Release();
+    }
+}
+
+/// <summary>
+/// A native async operation whose outcome is converted to <typeparamref name="TResult"/> on the
+/// native worker thread, while the result handle is still alive.
+/// </summary>
+internal sealed class NativeAsyncOperation<TResult> : NativeAsyncOperation
+{
+    private readonly TaskCompletionSource<TResult> _completion = new(TaskCreationOptions.RunContinuationsAsynchronously);
+    private readonly Func<NativeStatus, IntPtr, TResult> _getResult;
+    private readonly CancellationToken _cancellationToken;
+
+    private NativeAsyncOperation(INativeMethods native, Func<NativeStatus, IntPtr, TResult> getResult, CancellationToken cancellationToken)
+        : base(native)
+    {
+        _getResult = getResult;
+        _cancellationToken = cancellationToken;
+    }
+
+    /// <summary>
+    /// Submits an operation and returns a task that completes from the native callback.
+    /// </summary>
+    /// <remarks>
+    /// <paramref name="getResult"/> receives the status and the result handle (zero for writes);
+    /// the handle is destroyed after it returns. Operations cancelled before they start complete
+    /// as cancelled; operations already running finish normally.
+    /// </remarks>
+    public static Task<TResult> Run(INativeMethods native, Submit submit, Func<NativeStatus, IntPtr, TResult> getResult, CancellationToken cancellationToken)
+    {
+        if (cancellationToken.IsCancellationRequested)
+        {
+            return Task.FromCanceled<TResult>(cancellationToken);
+        }
+
+        var operation = new NativeAsyncOperation<TResult>(native, getResult, cancellationToken);
+        operation.Start(submit, cancellationToken);
+        return operation._completion.Task;
+    }
+
+    protected override void OnCompleted(in NativeStatus status, IntPtr result)
+    {
+        if (status.Code == (int)StatusCode.Cancelled)
+        {
+            _completion.TrySetCanceled(_cancellationToken);
+            return;
+        }
+
+        _completion.TrySetResult(_getResult(status, result));
+    }
+
+    protected override void OnFailed(Exception exception) => _completion.TrySetException(exception);
+}
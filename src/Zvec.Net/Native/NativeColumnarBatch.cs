@@ -0,0 +1,146 @@
+using System.Runtime.InteropServices;
+using System.Text;
+using Zvec.Net.Types;
+
+namespace Zvec.Net.Native;
+
+/// <summary>
+/// Builds a <see cref="NativeColumnBatch"/> from managed column arrays, keeping every buffer
+/// pinned until the batch is disposed.
+/// </summary>
+internal sealed class NativeColumnarBatch : IDisposable
+{
+    private readonly List<GCHandle> _pins = new();
+    private readonly List<IntPtr> _names = new();
+    private readonly List<NativeColumn> _columns = new();
+    private IntPtr _pkData;
+    private nuint _pkDataSize;
+    private IntPtr _pkOffsets;
+
+    public NativeColumnarBatch(int rowCount)
+    {
+        RowCount = rowCount;
+    }
+
+    public int RowCount { get; }
+
+    public void SetPrimaryKeys(IReadOnlyList<string?> pks)
+    {
+        var (data, offsets) = EncodeStrings(pks, out _);
+        _pkData = Pin(data);
+        _pkDataSize = (nuint)data.Length;
+        _pkOffsets = Pin(offsets);
+    }
+
+    public void AddScalarColumn<TValue>(string name, DataType dataType, TValue[] values, byte[]? nullBitmap)
+        where TValue : unmanaged
+    {
+        AddColumn(name, dataType, 0, Pin(values), 0, IntPtr.Zero, nullBitmap);
+    }
+
+    public void AddStringColumn(string name, IReadOnlyList<string?> values)
+    {
+        var (data, offsets) = EncodeStrings(values, out var nullBitmap);
+        AddColumn(name, DataType.String, 0, Pin(data), (nuint)data.Length, Pin(offsets), nullBitmap);
+    }
+
+    public void AddVectorColumn<TValue>(string name, DataType dataType, int dimension, TValue[] matrix, byte[]? nullBitmap)
+        where TValue : unmanaged
+    {
+        AddColumn(name, dataType, dimension, Pin(matrix), 0, IntPtr.Zero, nullBitmap);
+    }
+
+    public NativeColumnBatch Build()
+    {
+        return new NativeColumnBatch
+        {
+            RowCount = (nuint)RowCount,
+            PkData = _pkData,
+            PkDataSize = _pkDataSize,
+            PkOffsets = _pkOffsets,
+            Columns = Pin(_columns.ToArray()),
+            ColumnCount = (nuint)_columns.Count
+        };
+    }
+
+    public void Dispose()
+    {
+        foreach (var pin in _pins)
+        {
+            pin.Free();
+        }
+        _pins.Clear();
+
+        foreach (var name in _names)
+        {
+            Marshal.FreeCoTaskMem(name);
+        }
+        _names.Clear();
+    }
+
+    /// <summary>
+    /// Marks row <paramref name="row"/> as null in an LSB-first bitmap, allocating it on first use.
+    /// </summary>
+    public static void SetNull(ref byte[]? nullBitmap, int rowCount, int row)
+    {
+        nullBitmap ??= new byte[(rowCount + 7) / 8];
+        nullBitmap[row >> 3] |= (byte)(1 << (row & 7));
+    }
+
+    private void AddColumn(string name, DataType dataType, int dimension, IntPtr values, nuint valuesSize, IntPtr offsets, byte[]? nullBitmap)
+    {
+        var namePtr = Marshal.StringToCoTaskMemUTF8(name);
+        _names.Add(namePtr);
+
+        _columns.Add(new NativeColumn
+        {
+            Name = namePtr,
+            DataType = (int)dataType,
+            Dimension = dimension,
+            Values = values,
+            ValuesSize = valuesSize,
+            Offsets = offsets,
+            NullBitmap = nullBitmap != null ? Pin(nullBitmap) : IntPtr.Zero
+        });
+    }
+
+    private IntPtr Pin(Array array)
+    {
+        var handle = GCHandle.Alloc(array, GCHandleType.Pinned);
+        _pins.Add(handle);
+        return handle.AddrOfPinnedObject();
+    }
+
+    private (byte[] Data, int[] Offsets) EncodeStrings(IReadOnlyList<string?> values, out byte[]? nullBitmap)
+    {
+        nullBitmap = null;
+        var offsets = new int[values.Count + 1];
+        var totalBytes = 0;
+        for (int i = 0; i < values.Count; i++)
+        {
+            var value = values[i];
+            if (value == null)
+            {
+                SetNull(ref nullBitmap, RowCount, i);
+            }
+            else
+            {
+                totalBytes += Encoding.UTF8.GetByteCount(value);
+            }
+            offsets[i + 1] = totalBytes;
+        }
+
+        // Always hand out a non-empty buffer so the native side never sees a null data pointer.
+        var data = new byte[Math.Max(totalBytes, 1)];
+        for (int i = 0; i < values.Count; i++)
+        {
+            var value = values[i];
+            if (value != null)
+            {
+                Encoding.UTF8.GetBytes(value, 0, value.Length, data, offsets[i]);
+            }
+        }
+
+        return (data, offsets);
+    }
+}
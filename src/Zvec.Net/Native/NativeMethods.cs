@@ -52,6 +52,15 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_doc_set_vector_f32(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field, in float data, nuint len);
 
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_vector_f16(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field, in ushort data, nuint len);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_vector_i8(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field, in sbyte data, nuint len);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_vector_i16(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field, in short data, nuint len);
+
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_doc_set_sparse_vector_f32(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field, in uint indices, in float values, nuint len);
 
@@ -59,6 +68,15 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName)]
     internal static partial nuint zvec_doc_get_vector_f32(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field, out float outData, nuint maxLen);
 
+    [LibraryImport(LibraryName)]
+    internal static partial nuint zvec_doc_get_vector_f16(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field, out ushort outData, nuint maxLen);
+
+    [LibraryImport(LibraryName)]
+    internal static partial nuint zvec_doc_get_vector_i8(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field, out sbyte outData, nuint maxLen);
+
+    [LibraryImport(LibraryName)]
+    internal static partial nuint zvec_doc_get_vector_i16(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field, out short outData, nuint maxLen);
+
     // Field getters
     [LibraryImport(LibraryName)]
     internal static partial int zvec_doc_has_field(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field);
@@ -75,6 +93,62 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName)]
     internal static partial int zvec_doc_get_bool(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string field);
 
+    // ===== Resolved Fields =====
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_resolve_field(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string name, int dataType, out IntPtr outField);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_string_by_id(IntPtr handle, IntPtr field, [MarshalAs(UnmanagedType.LPUTF8Str)] string? value);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_int32_by_id(IntPtr handle, IntPtr field, int value);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_int64_by_id(IntPtr handle, IntPtr field, long value);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_float_by_id(IntPtr handle, IntPtr field, float value);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_double_by_id(IntPtr handle, IntPtr field, double value);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_bool_by_id(IntPtr handle, IntPtr field, int value);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_null_by_id(IntPtr handle, IntPtr field);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_vector_f32_by_id(IntPtr handle, IntPtr field, in float data, nuint len);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_vector_f16_by_id(IntPtr handle, IntPtr field, in ushort data, nuint len);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_vector_i8_by_id(IntPtr handle, IntPtr field, in sbyte data, nuint len);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_vector_i16_by_id(IntPtr handle, IntPtr field, in short data, nuint len);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_doc_set_sparse_vector_f32_by_id(IntPtr handle, IntPtr field, in uint indices, in float values, nuint len);
+
+    // ===== Document Batch =====
+    [LibraryImport(LibraryName)]
+    internal static partial IntPtr zvec_doc_batch_create(nuint capacity);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_doc_batch_destroy(IntPtr batch);
+
+    [LibraryImport(LibraryName)]
+    internal static partial IntPtr zvec_doc_batch_add(IntPtr batch);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_doc_batch_clear(IntPtr batch);
+
+    [LibraryImport(LibraryName)]
+    internal static partial nuint zvec_doc_batch_count(IntPtr batch);
+
     // ===== Schema Creation =====
     [LibraryImport(LibraryName)]
     internal static partial IntPtr zvec_schema_create([MarshalAs(UnmanagedType.LPUTF8Str)] string name);
@@ -123,6 +197,18 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName)]
     internal static partial void zvec_query_set_vector(IntPtr handle, in float data, nuint len);
 
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_query_set_vector_f16(IntPtr handle, in ushort data, nuint len);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_query_set_vector_i8(IntPtr handle, in sbyte data, nuint len);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_query_set_vector_i16(IntPtr handle, in short data, nuint len);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_query_set_sparse_vector(IntPtr handle, in uint indices, in float values, nuint len);
+
     [LibraryImport(LibraryName)]
     internal static partial void zvec_query_set_filter(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string filter);
 
@@ -138,6 +224,32 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName)]
     internal static partial void zvec_query_set_n_probe(IntPtr handle, int nProbe);
 
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_query_set_params(IntPtr handle, in NativeQueryParams queryParams);
+
+    // ===== Prepared Queries =====
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_prepare_query(IntPtr handle, IntPtr query, out IntPtr outPrepared);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_prepared_query_destroy(IntPtr prepared);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_prepared_query_execute(IntPtr prepared, in float vector, nuint len, out IntPtr outResult);
+
+    // ===== Id Sets =====
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_id_set_create([MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] pks, nuint count, out IntPtr outSet);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_id_set_destroy(IntPtr set);
+
+    [LibraryImport(LibraryName)]
+    internal static partial nuint zvec_id_set_count(IntPtr set);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_query_set_id_filter(IntPtr handle, IntPtr set, int mode);
+
     // ===== Collection =====
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_collection_create_and_open([MarshalAs(UnmanagedType.LPUTF8Str)] string path, IntPtr schema, in NativeCollectionOptions options, out IntPtr outHandle);
@@ -145,6 +257,18 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_collection_open([MarshalAs(UnmanagedType.LPUTF8Str)] string path, in NativeCollectionOptions options, out IntPtr outHandle);
 
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_open_readonly([MarshalAs(UnmanagedType.LPUTF8Str)] string path, in NativeCollectionOptions options, out IntPtr outHandle);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_refresh(IntPtr handle);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_snapshot_create(IntPtr handle, out IntPtr outSnapshot);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_snapshot_release(IntPtr snapshot);
+
     [LibraryImport(LibraryName)]
     internal static partial void zvec_collection_destroy(IntPtr handle);
 
@@ -157,6 +281,12 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_collection_optimize(IntPtr handle);
 
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_begin_bulk_load(IntPtr handle);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_end_bulk_load(IntPtr handle);
+
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_collection_create_index(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string fieldName, in NativeFieldDef indexDef);
 
@@ -172,21 +302,168 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_collection_update(IntPtr handle, IntPtr[] docs, nuint count);
 
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_insert_doc_batch(IntPtr handle, IntPtr batch);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_upsert_doc_batch(IntPtr handle, IntPtr batch);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_update_doc_batch(IntPtr handle, IntPtr batch);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_insert_columnar(IntPtr handle, in NativeColumnBatch batch);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_upsert_columnar(IntPtr handle, in NativeColumnBatch batch);
+
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_collection_delete(IntPtr handle, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] ids, nuint count);
 
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_collection_delete_by_filter(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string filter);
 
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_insert_doc_batch_with_status(IntPtr handle, IntPtr batch, [Out] NativeDocStatus[] outStatuses, out nuint outFailed);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_upsert_doc_batch_with_status(IntPtr handle, IntPtr batch, [Out] NativeDocStatus[] outStatuses, out nuint outFailed);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_update_doc_batch_with_status(IntPtr handle, IntPtr batch, [Out] NativeDocStatus[] outStatuses, out nuint outFailed);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_insert_columnar_with_status(IntPtr handle, in NativeColumnBatch batch, [Out] NativeDocStatus[] outStatuses, out nuint outFailed);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_upsert_columnar_with_status(IntPtr handle, in NativeColumnBatch batch, [Out] NativeDocStatus[] outStatuses, out nuint outFailed);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_delete_with_status(IntPtr handle, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] ids, nuint count, [Out] NativeDocStatus[] outStatuses, out nuint outFailed);
+
+    [LibraryImport(LibraryName)]
+    internal static partial IntPtr zvec_write_status_message(int index);
+
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_collection_query(IntPtr handle, IntPtr query, out IntPtr outResult);
 
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_query_batch(IntPtr handle, IntPtr query, in float vectors, nuint queryCount, nuint dimension, [Out] IntPtr[] outResults);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_query_multi(IntPtr handle, IntPtr[] queries, nuint queryCount, in NativeFusion fusion, out IntPtr outResult);
+
     [LibraryImport(LibraryName)]
     internal static partial NativeStatus zvec_collection_fetch(IntPtr handle, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] ids, nuint count, out IntPtr outResult);
 
+    // Async
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_query_async(IntPtr handle, IntPtr query, IntPtr callback, IntPtr userData, out IntPtr op);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_insert_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_upsert_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_update_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_insert_columnar_async(IntPtr handle, in NativeColumnBatch batch, IntPtr callback, IntPtr userData, out IntPtr op);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_upsert_columnar_async(IntPtr handle, in NativeColumnBatch batch, IntPtr callback, IntPtr userData, out IntPtr op);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_delete_async(IntPtr handle, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] ids, nuint count, IntPtr callback, IntPtr userData, out IntPtr op);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_async_cancel(IntPtr op);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_async_release(IntPtr op);
+
     [LibraryImport(LibraryName)]
     internal static partial IntPtr zvec_collection_get_path(IntPtr handle);
 
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_get_query_cache_stats(IntPtr handle, out NativeQueryCacheStats outStats);
+
+    // ===== Query Tuning =====
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_tune(IntPtr handle, in NativeTuneRequest request, [Out] NativeTunePoint[] outPoints, nuint pointCapacity, out NativeTuneReport outReport);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_set_query_defaults(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string fieldName, IntPtr queryParams);
+
+    // ===== Background Optimize =====
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_start_auto_optimize(IntPtr handle, in NativeOptimizePolicy policy);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_stop_auto_optimize(IntPtr handle);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_pause_auto_optimize(IntPtr handle);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_resume_auto_optimize(IntPtr handle);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_get_auto_optimize_status(IntPtr handle, out NativeOptimizeStatus outStatus);
+
+    // ===== Warmup =====
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_warmup(IntPtr handle, in NativeWarmupOptions options, out NativeWarmupProgress outProgress);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_get_warmup_progress(IntPtr handle, out NativeWarmupProgress outProgress);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_cancel_warmup(IntPtr handle);
+
+    // ===== Import =====
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_import(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string path, int format, in NativeImportMapping mapping, in NativeImportOptions options, out NativeImportReport outReport);
+
+    // ===== Export =====
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_export(IntPtr handle, [MarshalAs(UnmanagedType.LPUTF8Str)] string path, int format, in NativeExportOptions options, out NativeExportReport outReport);
+
+    // ===== Metrics =====
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_metrics_snapshot([Out] NativeOpMetrics[] outMetrics, nuint count);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_metrics_reset();
+
+    [LibraryImport(LibraryName)]
+    internal static partial IntPtr zvec_metrics_op_name(int op);
+
+    // ===== Scan =====
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_collection_scan_open(
+        IntPtr handle,
+        [MarshalAs(UnmanagedType.LPUTF8Str)] string? filter,
+        [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[]? outputFields,
+        nuint outputFieldCount,
+        int includeVector,
+        nuint batchSize,
+        out IntPtr outScan);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_scan_next(IntPtr scan, out IntPtr outResult);
+
+    [LibraryImport(LibraryName)]
+    internal static partial void zvec_scan_close(IntPtr scan);
+
     // ===== Result =====
     [LibraryImport(LibraryName)]
     internal static partial void zvec_result_destroy(IntPtr handle);
@@ -194,6 +471,12 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName)]
     internal static partial nuint zvec_result_count(IntPtr handle);
 
+    [LibraryImport(LibraryName)]
+    internal static partial int zvec_result_truncated(IntPtr handle);
+
     [LibraryImport(LibraryName)]
     internal static partial IntPtr zvec_result_get_doc(IntPtr handle, nuint index);
+
+    [LibraryImport(LibraryName)]
+    internal static partial NativeStatus zvec_result_export(IntPtr handle, [In, Out] NativeColumn[] columns, nuint columnCount, out NativeResultExport export);
 }
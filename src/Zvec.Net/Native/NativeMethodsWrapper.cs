@@ -32,11 +32,23 @@ internal sealed class NativeMethodsWrapper : INativeMethods
 
     public NativeStatus zvec_doc_set_vector_f32(IntPtr handle, string field, in float data, nuint len) =>
         NativeMethods.zvec_doc_set_vector_f32(handle, field, in data, len);
+    public NativeStatus zvec_doc_set_vector_f16(IntPtr handle, string field, in ushort data, nuint len) =>
+        NativeMethods.zvec_doc_set_vector_f16(handle, field, in data, len);
+    public NativeStatus zvec_doc_set_vector_i8(IntPtr handle, string field, in sbyte data, nuint len) =>
+        NativeMethods.zvec_doc_set_vector_i8(handle, field, in data, len);
+    public NativeStatus zvec_doc_set_vector_i16(IntPtr handle, string field, in short data, nuint len) =>
+        NativeMethods.zvec_doc_set_vector_i16(handle, field, in data, len);
     public NativeStatus zvec_doc_set_sparse_vector_f32(IntPtr handle, string field, in uint indices, in float values, nuint len) =>
         NativeMethods.zvec_doc_set_sparse_vector_f32(handle, field, in indices, in values, len);
 
     public nuint zvec_doc_get_vector_f32(IntPtr handle, string field, out float outData, nuint maxLen) =>
         NativeMethods.zvec_doc_get_vector_f32(handle, field, out outData, maxLen);
+    public nuint zvec_doc_get_vector_f16(IntPtr handle, string field, out ushort outData, nuint maxLen) =>
+        NativeMethods.zvec_doc_get_vector_f16(handle, field, out outData, maxLen);
+    public nuint zvec_doc_get_vector_i8(IntPtr handle, string field, out sbyte outData, nuint maxLen) =>
+        NativeMethods.zvec_doc_get_vector_i8(handle, field, out outData, maxLen);
+    public nuint zvec_doc_get_vector_i16(IntPtr handle, string field, out short outData, nuint maxLen) =>
+        NativeMethods.zvec_doc_get_vector_i16(handle, field, out outData, maxLen);
 
     public int zvec_doc_has_field(IntPtr handle, string field) => NativeMethods.zvec_doc_has_field(handle, field);
     public IntPtr zvec_doc_get_string(IntPtr handle, string field) => NativeMethods.zvec_doc_get_string(handle, field);
@@ -44,6 +56,26 @@ internal sealed class NativeMethodsWrapper : INativeMethods
     public double zvec_doc_get_double(IntPtr handle, string field) => NativeMethods.zvec_doc_get_double(handle, field);
     public int zvec_doc_get_bool(IntPtr handle, string field) => NativeMethods.zvec_doc_get_bool(handle, field);
 
+    public NativeStatus zvec_collection_resolve_field(IntPtr handle, string name, int dataType, out IntPtr outField) => NativeMethods.zvec_collection_resolve_field(handle, name, dataType, out outField);
+    public NativeStatus zvec_doc_set_string_by_id(IntPtr handle, IntPtr field, string? value) => NativeMethods.zvec_doc_set_string_by_id(handle, field, value);
+    public NativeStatus zvec_doc_set_int32_by_id(IntPtr handle, IntPtr field, int value) => NativeMethods.zvec_doc_set_int32_by_id(handle, field, value);
+    public NativeStatus zvec_doc_set_int64_by_id(IntPtr handle, IntPtr field, long value) => NativeMethods.zvec_doc_set_int64_by_id(handle, field, value);
+    public NativeStatus zvec_doc_set_float_by_id(IntPtr handle, IntPtr field, float value) => NativeMethods.zvec_doc_set_float_by_id(handle, field, value);
+    public NativeStatus zvec_doc_set_double_by_id(IntPtr handle, IntPtr field, double value) => NativeMethods.zvec_doc_set_double_by_id(handle, field, value);
+    public NativeStatus zvec_doc_set_bool_by_id(IntPtr handle, IntPtr field, int value) => NativeMethods.zvec_doc_set_bool_by_id(handle, field, value);
+    public NativeStatus zvec_doc_set_null_by_id(IntPtr handle, IntPtr field) => NativeMethods.zvec_doc_set_null_by_id(handle, field);
+    public NativeStatus zvec_doc_set_vector_f32_by_id(IntPtr handle, IntPtr field, in float data, nuint len) => NativeMethods.zvec_doc_set_vector_f32_by_id(handle, field, in data, len);
+    public NativeStatus zvec_doc_set_vector_f16_by_id(IntPtr handle, IntPtr field, in ushort data, nuint len) => NativeMethods.zvec_doc_set_vector_f16_by_id(handle, field, in data, len);
+    public NativeStatus zvec_doc_set_vector_i8_by_id(IntPtr handle, IntPtr field, in sbyte data, nuint len) => NativeMethods.zvec_doc_set_vector_i8_by_id(handle, field, in data, len);
+    public NativeStatus zvec_doc_set_vector_i16_by_id(IntPtr handle, IntPtr field, in short data, nuint len) => NativeMethods.zvec_doc_set_vector_i16_by_id(handle, field, in data, len);
+    public NativeStatus zvec_doc_set_sparse_vector_f32_by_id(IntPtr handle, IntPtr field, in uint indices, in float values, nuint len) => NativeMethods.zvec_doc_set_sparse_vector_f32_by_id(handle, field, in indices, in values, len);
+
+    public IntPtr zvec_doc_batch_create(nuint capacity) => NativeMethods.zvec_doc_batch_create(capacity);
+    public void zvec_doc_batch_destroy(IntPtr batch) => NativeMethods.zvec_doc_batch_destroy(batch);
+    public IntPtr zvec_doc_batch_add(IntPtr batch) => NativeMethods.zvec_doc_batch_add(batch);
+    public void zvec_doc_batch_clear(IntPtr batch) => NativeMethods.zvec_doc_batch_clear(batch);
+    public nuint zvec_doc_batch_count(IntPtr batch) => NativeMethods.zvec_doc_batch_count(batch);
+
     public IntPtr zvec_schema_create(string name) => NativeMethods.zvec_schema_create(name);
     public void zvec_schema_destroy(IntPtr handle) => NativeMethods.zvec_schema_destroy(handle);
     public NativeStatus zvec_schema_add_field(IntPtr handle, in NativeFieldDef fieldDef) =>
@@ -63,33 +95,130 @@ internal sealed class NativeMethodsWrapper : INativeMethods
     public void zvec_query_set_topk(IntPtr handle, int topk) => NativeMethods.zvec_query_set_topk(handle, topk);
     public void zvec_query_set_field_name(IntPtr handle, string fieldName) => NativeMethods.zvec_query_set_field_name(handle, fieldName);
     public void zvec_query_set_vector(IntPtr handle, in float data, nuint len) => NativeMethods.zvec_query_set_vector(handle, in data, len);
+    public void zvec_query_set_vector_f16(IntPtr handle, in ushort data, nuint len) => NativeMethods.zvec_query_set_vector_f16(handle, in data, len);
+    public void zvec_query_set_vector_i8(IntPtr handle, in sbyte data, nuint len) => NativeMethods.zvec_query_set_vector_i8(handle, in data, len);
+    public void zvec_query_set_vector_i16(IntPtr handle, in short data, nuint len) => NativeMethods.zvec_query_set_vector_i16(handle, in data, len);
+    public void zvec_query_set_sparse_vector(IntPtr handle, in uint indices, in float values, nuint len) => NativeMethods.zvec_query_set_sparse_vector(handle, in indices, in values, len);
     public void zvec_query_set_filter(IntPtr handle, string filter) => NativeMethods.zvec_query_set_filter(handle, filter);
     public void zvec_query_set_include_vector(IntPtr handle, int include) => NativeMethods.zvec_query_set_include_vector(handle, include);
     public void zvec_query_set_output_fields(IntPtr handle, IntPtr fields, nuint count) => NativeMethods.zvec_query_set_output_fields(handle, fields, count);
     public void zvec_query_set_ef_search(IntPtr handle, int ef) => NativeMethods.zvec_query_set_ef_search(handle, ef);
     public void zvec_query_set_n_probe(IntPtr handle, int nProbe) => NativeMethods.zvec_query_set_n_probe(handle, nProbe);
+    public void zvec_query_set_params(IntPtr handle, in NativeQueryParams queryParams) => NativeMethods.zvec_query_set_params(handle, in queryParams);
+
+    // Prepared queries
+    public NativeStatus zvec_collection_prepare_query(IntPtr handle, IntPtr query, out IntPtr outPrepared) => NativeMethods.zvec_collection_prepare_query(handle, query, out outPrepared);
+    public void zvec_prepared_query_destroy(IntPtr prepared) => NativeMethods.zvec_prepared_query_destroy(prepared);
+    public NativeStatus zvec_prepared_query_execute(IntPtr prepared, in float vector, nuint len, out IntPtr outResult) => NativeMethods.zvec_prepared_query_execute(prepared, in vector, len, out outResult);
+
+    // Id sets
+    public NativeStatus zvec_id_set_create(string[] pks, nuint count, out IntPtr outSet) => NativeMethods.zvec_id_set_create(pks, count, out outSet);
+    public void zvec_id_set_destroy(IntPtr set) => NativeMethods.zvec_id_set_destroy(set);
+    public nuint zvec_id_set_count(IntPtr set) => NativeMethods.zvec_id_set_count(set);
+    public void zvec_query_set_id_filter(IntPtr handle, IntPtr set, int mode) => NativeMethods.zvec_query_set_id_filter(handle, set, mode);
 
     public NativeStatus zvec_collection_create_and_open(string path, IntPtr schema, in NativeCollectionOptions options, out IntPtr outHandle) =>
         NativeMethods.zvec_collection_create_and_open(path, schema, in options, out outHandle);
     public NativeStatus zvec_collection_open(string path, in NativeCollectionOptions options, out IntPtr outHandle) =>
         NativeMethods.zvec_collection_open(path, in options, out outHandle);
+    public NativeStatus zvec_collection_open_readonly(string path, in NativeCollectionOptions options, out IntPtr outHandle) =>
+        NativeMethods.zvec_collection_open_readonly(path, in options, out outHandle);
+    public NativeStatus zvec_collection_refresh(IntPtr handle) => NativeMethods.zvec_collection_refresh(handle);
+    public NativeStatus zvec_collection_snapshot_create(IntPtr handle, out IntPtr outSnapshot) => NativeMethods.zvec_collection_snapshot_create(handle, out outSnapshot);
+    public NativeStatus zvec_collection_snapshot_release(IntPtr snapshot) => NativeMethods.zvec_collection_snapshot_release(snapshot);
     public void zvec_collection_destroy(IntPtr handle) => NativeMethods.zvec_collection_destroy(handle);
     public NativeStatus zvec_collection_destroy_data(IntPtr handle) => NativeMethods.zvec_collection_destroy_data(handle);
     public NativeStatus zvec_collection_flush(IntPtr handle) => NativeMethods.zvec_collection_flush(handle);
     public NativeStatus zvec_collection_optimize(IntPtr handle) => NativeMethods.zvec_collection_optimize(handle);
+    public NativeStatus zvec_collection_begin_bulk_load(IntPtr handle) => NativeMethods.zvec_collection_begin_bulk_load(handle);
+    public NativeStatus zvec_collection_end_bulk_load(IntPtr handle) => NativeMethods.zvec_collection_end_bulk_load(handle);
     public NativeStatus zvec_collection_create_index(IntPtr handle, string fieldName, in NativeFieldDef indexDef) =>
         NativeMethods.zvec_collection_create_index(handle, fieldName, in indexDef);
     public NativeStatus zvec_collection_drop_index(IntPtr handle, string fieldName) => NativeMethods.zvec_collection_drop_index(handle, fieldName);
     public NativeStatus zvec_collection_insert(IntPtr handle, IntPtr[] docs, nuint count) => NativeMethods.zvec_collection_insert(handle, docs, count);
     public NativeStatus zvec_collection_upsert(IntPtr handle, IntPtr[] docs, nuint count) => NativeMethods.zvec_collection_upsert(handle, docs, count);
     public NativeStatus zvec_collection_update(IntPtr handle, IntPtr[] docs, nuint count) => NativeMethods.zvec_collection_update(handle, docs, count);
+    public NativeStatus zvec_collection_insert_doc_batch(IntPtr handle, IntPtr batch) => NativeMethods.zvec_collection_insert_doc_batch(handle, batch);
+    public NativeStatus zvec_collection_upsert_doc_batch(IntPtr handle, IntPtr batch) => NativeMethods.zvec_collection_upsert_doc_batch(handle, batch);
+    public NativeStatus zvec_collection_update_doc_batch(IntPtr handle, IntPtr batch) => NativeMethods.zvec_collection_update_doc_batch(handle, batch);
+    public NativeStatus zvec_collection_insert_columnar(IntPtr handle, in NativeColumnBatch batch) =>
+        NativeMethods.zvec_collection_insert_columnar(handle, in batch);
+    public NativeStatus zvec_collection_upsert_columnar(IntPtr handle, in NativeColumnBatch batch) =>
+        NativeMethods.zvec_collection_upsert_columnar(handle, in batch);
     public NativeStatus zvec_collection_delete(IntPtr handle, string[] ids, nuint count) => NativeMethods.zvec_collection_delete(handle, ids, count);
     public NativeStatus zvec_collection_delete_by_filter(IntPtr handle, string filter) => NativeMethods.zvec_collection_delete_by_filter(handle, filter);
+    public NativeStatus zvec_collection_insert_doc_batch_with_status(IntPtr handle, IntPtr batch, NativeDocStatus[] outStatuses, out nuint outFailed) =>
+        NativeMethods.zvec_collection_insert_doc_batch_with_status(handle, batch, outStatuses, out outFailed);
+    public NativeStatus zvec_collection_upsert_doc_batch_with_status(IntPtr handle, IntPtr batch, NativeDocStatus[] outStatuses, out nuint outFailed) =>
+        NativeMethods.zvec_collection_upsert_doc_batch_with_status(handle, batch, outStatuses, out outFailed);
+    public NativeStatus zvec_collection_update_doc_batch_with_status(IntPtr handle, IntPtr batch, NativeDocStatus[] outStatuses, out nuint outFailed) =>
+        NativeMethods.zvec_collection_update_doc_batch_with_status(handle, batch, outStatuses, out outFailed);
+    public NativeStatus zvec_collection_insert_columnar_with_status(IntPtr handle, in NativeColumnBatch batch, NativeDocStatus[] outStatuses, out nuint outFailed) =>
+        NativeMethods.zvec_collection_insert_columnar_with_status(handle, in batch, outStatuses, out outFailed);
+    public NativeStatus zvec_collection_upsert_columnar_with_status(IntPtr handle, in NativeColumnBatch batch, NativeDocStatus[] outStatuses, out nuint outFailed) =>
+        NativeMethods.zvec_collection_upsert_columnar_with_status(handle, in batch, outStatuses, out outFailed);
+    public NativeStatus zvec_collection_delete_with_status(IntPtr handle, string[] ids, nuint count, NativeDocStatus[] outStatuses, out nuint outFailed) =>
+        NativeMethods.zvec_collection_delete_with_status(handle, ids, count, outStatuses, out outFailed);
+    public IntPtr zvec_write_status_message(int index) => NativeMethods.zvec_write_status_message(index);
     public NativeStatus zvec_collection_query(IntPtr handle, IntPtr query, out IntPtr outResult) => NativeMethods.zvec_collection_query(handle, query, out outResult);
+    public NativeStatus zvec_collection_query_batch(IntPtr handle, IntPtr query, in float vectors, nuint queryCount, nuint dimension, IntPtr[] outResults) => NativeMethods.zvec_collection_query_batch(handle, query, in vectors, queryCount, dimension, outResults);
+    public NativeStatus zvec_collection_query_multi(IntPtr handle, IntPtr[] queries, nuint queryCount, in NativeFusion fusion, out IntPtr outResult) => NativeMethods.zvec_collection_query_multi(handle, queries, queryCount, in fusion, out outResult);
     public NativeStatus zvec_collection_fetch(IntPtr handle, string[] ids, nuint count, out IntPtr outResult) => NativeMethods.zvec_collection_fetch(handle, ids, count, out outResult);
+
+    public NativeStatus zvec_collection_query_async(IntPtr handle, IntPtr query, IntPtr callback, IntPtr userData, out IntPtr op) =>
+        NativeMethods.zvec_collection_query_async(handle, query, callback, userData, out op);
+    public NativeStatus zvec_collection_insert_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op) =>
+        NativeMethods.zvec_collection_insert_async(handle, docs, count, callback, userData, out op);
+    public NativeStatus zvec_collection_upsert_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op) =>
+        NativeMethods.zvec_collection_upsert_async(handle, docs, count, callback, userData, out op);
+    public NativeStatus zvec_collection_update_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op) =>
+        NativeMethods.zvec_collection_update_async(handle, docs, count, callback, userData, out op);
+    public NativeStatus zvec_collection_insert_columnar_async(IntPtr handle, in NativeColumnBatch batch, IntPtr callback, IntPtr userData, out IntPtr op) =>
+        NativeMethods.zvec_collection_insert_columnar_async(handle, in batch, callback, userData, out op);
+    public NativeStatus zvec_collection_upsert_columnar_async(IntPtr handle, in NativeColumnBatch batch, IntPtr callback, IntPtr userData, out IntPtr op) =>
+        NativeMethods.zvec_collection_upsert_columnar_async(handle, in batch, callback, userData, out op);
+    public NativeStatus zvec_collection_delete_async(IntPtr handle, string[] ids, nuint count, IntPtr callback, IntPtr userData, out IntPtr op) =>
+        NativeMethods.zvec_collection_delete_async(handle, ids, count, callback, userData, out op);
+    public void zvec_async_cancel(IntPtr op) => NativeMethods.zvec_async_cancel(op);
+    public void zvec_async_release(IntPtr op) => NativeMethods.zvec_async_release(op);
     public IntPtr zvec_collection_get_path(IntPtr handle) => NativeMethods.zvec_collection_get_path(handle);
+    public NativeStatus zvec_collection_get_query_cache_stats(IntPtr handle, out NativeQueryCacheStats outStats) => NativeMethods.zvec_collection_get_query_cache_stats(handle, out outStats);
+
+    // Query tuning
+    public NativeStatus zvec_collection_tune(IntPtr handle, in NativeTuneRequest request, NativeTunePoint[] outPoints, nuint pointCapacity, out NativeTuneReport outReport) => NativeMethods.zvec_collection_tune(handle, in request, outPoints, pointCapacity, out outReport);
+    public NativeStatus zvec_collection_set_query_defaults(IntPtr handle, string fieldName, IntPtr queryParams) => NativeMethods.zvec_collection_set_query_defaults(handle, fieldName, queryParams);
+
+    // Background optimize
+    public NativeStatus zvec_collection_start_auto_optimize(IntPtr handle, in NativeOptimizePolicy policy) => NativeMethods.zvec_collection_start_auto_optimize(handle, in policy);
+    public NativeStatus zvec_collection_stop_auto_optimize(IntPtr handle) => NativeMethods.zvec_collection_stop_auto_optimize(handle);
+    public NativeStatus zvec_collection_pause_auto_optimize(IntPtr handle) => NativeMethods.zvec_collection_pause_auto_optimize(handle);
+    public NativeStatus zvec_collection_resume_auto_optimize(IntPtr handle) => NativeMethods.zvec_collection_resume_auto_optimize(handle);
+    public NativeStatus zvec_collection_get_auto_optimize_status(IntPtr handle, out NativeOptimizeStatus outStatus) => NativeMethods.zvec_collection_get_auto_optimize_status(handle, out outStatus);
+
+    // Warmup
+    public NativeStatus zvec_collection_warmup(IntPtr handle, in NativeWarmupOptions options, out NativeWarmupProgress outProgress) => NativeMethods.zvec_collection_warmup(handle, in options, out outProgress);
+    public NativeStatus zvec_collection_get_warmup_progress(IntPtr handle, out NativeWarmupProgress outProgress) => NativeMethods.zvec_collection_get_warmup_progress(handle, out outProgress);
+    public NativeStatus zvec_collection_cancel_warmup(IntPtr handle) => NativeMethods.zvec_collection_cancel_warmup(handle);
+
+    // Import
+    public NativeStatus zvec_collection_import(IntPtr handle, string path, int format, in NativeImportMapping mapping, in NativeImportOptions options, out NativeImportReport outReport) => NativeMethods.zvec_collection_import(handle, path, format, in mapping, in options, out outReport);
+
+    // Export
+    public NativeStatus zvec_collection_export(IntPtr handle, string path, int format, in NativeExportOptions options, out NativeExportReport outReport) => NativeMethods.zvec_collection_export(handle, path, format, in options, out outReport);
+
+    // Metrics
+    public NativeStatus zvec_metrics_snapshot(NativeOpMetrics[] outMetrics, nuint count) => NativeMethods.zvec_metrics_snapshot(outMetrics, count);
+    public void zvec_metrics_reset() => NativeMethods.zvec_metrics_reset();
+    public IntPtr zvec_metrics_op_name(int op) => NativeMethods.zvec_metrics_op_name(op);
+
+    public NativeStatus zvec_collection_scan_open(IntPtr handle, string? filter, string[]? outputFields, nuint outputFieldCount, int includeVector, nuint batchSize, out IntPtr outScan) =>
+        NativeMethods.zvec_collection_scan_open(handle, filter, outputFields, outputFieldCount, includeVector, batchSize, out outScan);
+    public NativeStatus zvec_scan_next(IntPtr scan, out IntPtr outResult) => NativeMethods.zvec_scan_next(scan, out outResult);
+    public void zvec_scan_close(IntPtr scan) => NativeMethods.zvec_scan_close(scan);
 
     public void zvec_result_destroy(IntPtr handle) => NativeMethods.zvec_result_destroy(handle);
     public nuint zvec_result_count(IntPtr handle) => NativeMethods.zvec_result_count(handle);
+    public int zvec_result_truncated(IntPtr handle) => NativeMethods.zvec_result_truncated(handle);
     public IntPtr zvec_result_get_doc(IntPtr handle, nuint index) => NativeMethods.zvec_result_get_doc(handle, index);
+    public NativeStatus zvec_result_export(IntPtr handle, NativeColumn[] columns, nuint columnCount, out NativeResultExport export) => NativeMethods.zvec_result_export(handle, columns, columnCount, out export);
 }
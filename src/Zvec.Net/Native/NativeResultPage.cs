@@ -0,0 +1,84 @@
+using System.Runtime.InteropServices;
+using System.Text;
+using Zvec.Net.Types;
+
+namespace Zvec.Net.Native;
+
+/// <summary>
+/// Reads a native result through one <c>zvec_result_export</c> call. The spans point into
+/// result-owned buffers, so the page is only valid while the result handle is alive.
+/// </summary>
+internal sealed class NativeResultPage
+{
+    private readonly NativeResultExport _export;
+    private readonly NativeColumn[] _columns;
+
+    private NativeResultPage(NativeResultExport export, NativeColumn[] columns)
+    {
+        _export = export;
+        _columns = columns;
+    }
+
+    public int Count => (int)_export.RowCount;
+
+    /// <summary>
+    /// Exports <paramref name="resultPtr"/> with one column per (name, type, dimension) request.
+    /// </summary>
+    public static NativeResultPage Export(INativeMethods native, IntPtr resultPtr, IReadOnlyList<(string Name, DataType DataType, int Dimension)> requests)
+    {
+        var columns = new NativeColumn[requests.Count];
+        try
+        {
+            for (int i = 0; i < requests.Count; i++)
+            {
+                columns[i].Name = Marshal.StringToCoTaskMemUTF8(requests[i].Name);
+                columns[i].DataType = (int)requests[i].DataType;
+                columns[i].Dimension = requests[i].Dimension;
+            }
+
+            native.zvec_result_export(resultPtr, columns, (nuint)columns.Length, out var export)
+                .ThrowIfError("Result export");
+
+            return new NativeResultPage(export, columns);
+        }
+        finally
+        {
+            for (int i = 0; i < columns.Length; i++)
+            {
+                Marshal.FreeCoTaskMem(columns[i].Name);
+                columns[i].Name = IntPtr.Zero;
+            }
+        }
+    }
+
+    public unsafe string GetPrimaryKey(int row)
+    {
+        var offsets = new ReadOnlySpan<int>((void*)_export.PkOffsets, Count + 1);
+        return Encoding.UTF8.GetString((byte*)_export.PkData + offsets[row], offsets[row + 1] - offsets[row]);
+    }
+
+    public unsafe double GetScore(int row) => ((double*)_export.Scores)[row];
+
+    public unsafe bool IsNull(int column, int row)
+    {
+        var bitmap = (byte*)_columns[column].NullBitmap;
+        return bitmap != null && (bitmap[row >> 3] & (1 << (row & 7))) != 0;
+    }
+
+    public unsafe TValue GetValue<TValue>(int column, int row) where TValue : unmanaged
+    {
+        return ((TValue*)_columns[column].Values)[row];
+    }
+
+    public unsafe string GetString(int column, int row)
+    {
+        var offsets = (int*)_columns[column].Offsets;
+        return Encoding.UTF8.GetString((byte*)_columns[column].Values + offsets[row], offsets[row + 1] - offsets[row]);
+    }
+
+    public unsafe TValue[] GetVector<TValue>(int column, int row) where TValue : unmanaged
+    {
+        var dimension = _columns[column].Dimension;
+        return new ReadOnlySpan<TValue>((TValue*)_columns[column].Values + (long)row * dimension, dimension).ToArray();
+    }
+}
@@ -106,20 +106,289 @@ internal struct NativeFieldDef
     }
 }
 
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeQueryParams
+{
+    public int IndexType;
+    public int Ef;
+    public int NProbe;
+    public float Radius;
+    public int IsLinear;
+    public int IsUsingRefiner;
+    public float RefineFactor;
+
+    public static NativeQueryParams FromParam(IndexQueryParam param)
+    {
+        var native = new NativeQueryParams
+        {
+            Radius = param.Radius,
+            IsLinear = param.IsLinear ? 1 : 0,
+            IsUsingRefiner = param.UseRefiner ? 1 : 0
+        };
+
+        switch (param)
+        {
+            case HnswQueryParam hnsw:
+                native.IndexType = (int)Types.IndexType.Hnsw;
+                native.Ef = hnsw.Ef;
+                break;
+            case IvfQueryParam ivf:
+                native.IndexType = (int)Types.IndexType.Ivf;
+                native.NProbe = ivf.NProbe;
+                native.RefineFactor = ivf.RefineFactor;
+                break;
+            case FlatQueryParam flat:
+                native.IndexType = (int)Types.IndexType.Flat;
+                native.RefineFactor = flat.RefineFactor;
+                break;
+        }
+
+        return native;
+    }
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeFusion
+{
+    public const int Rrf = 0;
+    public const int Weighted = 1;
+
+    public int Method;
+    public double RrfK;
+    public IntPtr Weights;
+    public nuint WeightCount;
+    public int TopK;
+}
+
 [StructLayout(LayoutKind.Sequential)]
 internal struct NativeCollectionOptions
 {
     public int SegmentMaxDocs;
     public int IndexBuildParallel;
     public int AutoFlush;
+    public int QueryParallel;
+    public int QueryCacheSize;
 
-    public static NativeCollectionOptions Create(int segmentMaxDocs = 1_000_000, int indexBuildParallel = 0, bool autoFlush = true)
+    public static NativeCollectionOptions Create(int segmentMaxDocs = 1_000_000, int indexBuildParallel = 0, bool autoFlush = false, int queryParallel = 0, int queryCacheSize = 0)
     {
         return new NativeCollectionOptions
         {
             SegmentMaxDocs = segmentMaxDocs,
             IndexBuildParallel = indexBuildParallel,
-            AutoFlush = autoFlush ? 1 : 0
+            AutoFlush = autoFlush ? 1 : 0,
+            QueryParallel = queryParallel,
+            QueryCacheSize = queryCacheSize
         };
     }
 }
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeOptimizePolicy
+{
+    public ulong CheckIntervalMs;
+    public ulong MinIntervalMs;
+    public ulong PendingWrites;
+    public double DeletedRatio;
+    public int Concurrency;
+    public int BudgetPercent;
+
+    public static NativeOptimizePolicy FromPolicy(AutoOptimizePolicy policy)
+    {
+        return new NativeOptimizePolicy
+        {
+            CheckIntervalMs = (ulong)policy.CheckInterval.TotalMilliseconds,
+            MinIntervalMs = (ulong)policy.MinInterval.TotalMilliseconds,
+            PendingWrites = (ulong)policy.PendingWrites,
+            DeletedRatio = policy.DeletedRatio,
+            Concurrency = policy.Concurrency,
+            BudgetPercent = policy.BudgetPercent
+        };
+    }
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeOptimizeStatus
+{
+    public int State;
+    public int LastStatusCode;
+    public ulong Runs;
+    public ulong Failures;
+    public ulong PendingWrites;
+    public ulong PendingDeletes;
+    public ulong LastDurationMs;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeTuneRequest
+{
+    public IntPtr FieldName;
+    public IntPtr Queries;
+    public nuint QueryCount;
+    public nuint Dimension;
+    public int TopK;
+    public double TargetRecall;
+    public IntPtr Candidates;
+    public nuint CandidateCount;
+    public IntPtr Filter;
+    public int Apply;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeTunePoint
+{
+    public int Value;
+    public double Recall;
+    public double MeanLatencyUs;
+    public double P99LatencyUs;
+    public int Pareto;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeTuneReport
+{
+    public int IndexType;
+    public int Recommended;
+    public int TargetMet;
+    public nuint PointCount;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeWarmupOptions
+{
+    public ulong ByteBudget;
+    public IntPtr QueryField;
+    public IntPtr Queries;
+    public nuint QueryCount;
+    public nuint Dimension;
+    public int TopK;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeWarmupProgress
+{
+    public ulong FilesTotal;
+    public ulong FilesLoaded;
+    public ulong BytesTotal;
+    public ulong BytesLoaded;
+    public ulong QueriesTotal;
+    public ulong QueriesRun;
+    public int Running;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeImportMapping
+{
+    public IntPtr VectorField;
+    public IntPtr VectorColumn;
+    public IntPtr PkColumn;
+    public IntPtr PkPrefix;
+    public ulong PkStart;
+    public IntPtr ScalarColumns;
+    public nuint ScalarColumnCount;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeImportOptions
+{
+    public nuint ChunkRows;
+    public ulong MaxRows;
+    public int Upsert;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeImportReport
+{
+    public ulong RowsRead;
+    public ulong RowsWritten;
+    public ulong RowsFailed;
+    public ulong Chunks;
+    public ulong ElapsedMs;
+    public double RowsPerSecond;
+    public int FirstErrorCode;
+    public IntPtr FirstErrorMessage;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeExportOptions
+{
+    public IntPtr Fields;
+    public nuint FieldCount;
+    public IntPtr Filter;
+    public IntPtr PkColumn;
+    public nuint BatchRows;
+    public int Concurrency;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeExportReport
+{
+    public ulong Rows;
+    public ulong Batches;
+    public ulong BytesWritten;
+    public ulong ElapsedMs;
+    public double RowsPerSecond;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal unsafe struct NativeOpMetrics
+{
+    public const int OpCount = 33;
+    public const int BucketCount = 160;
+
+    public ulong Count;
+    public ulong Errors;
+    public ulong TotalNs;
+    public ulong MaxNs;
+    public ulong P50Ns;
+    public ulong P90Ns;
+    public ulong P99Ns;
+    public fixed ulong Buckets[BucketCount];
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeQueryCacheStats
+{
+    public ulong Hits;
+    public ulong Misses;
+    public ulong Evictions;
+    public ulong Entries;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeColumn
+{
+    public IntPtr Name;
+    public int DataType;
+    public int Dimension;
+    public IntPtr Values;
+    public IntPtr Offsets;
+    public nuint ValuesSize;
+    public IntPtr NullBitmap;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeDocStatus
+{
+    public int Code;
+    public int MessageIndex;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeColumnBatch
+{
+    public nuint RowCount;
+    public IntPtr PkData;
+    public nuint PkDataSize;
+    public IntPtr PkOffsets;
+    public IntPtr Columns;
+    public nuint ColumnCount;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeResultExport
+{
+    public nuint RowCount;
+    public IntPtr PkData;
+    public IntPtr PkOffsets;
+    public IntPtr Scores;
+}
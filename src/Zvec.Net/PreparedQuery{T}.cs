@@ -0,0 +1,42 @@
+using Zvec.Net.Models;
+using Zvec.Net.Native;
+using Zvec.Net.Query;
+
+namespace Zvec.Net;
+
+/// <summary>
+/// Internal implementation of a prepared query.
+/// </summary>
+internal sealed class PreparedQuery<T> : IPreparedQuery<T> where T : class, IDocument, new()
+{
+    private readonly Collection<T> _collection;
+    private readonly INativeMethods _native;
+    private readonly bool _includeVectors;
+    private IntPtr _handle;
+
+    public PreparedQuery(Collection<T> collection, INativeMethods native, IntPtr handle, bool includeVectors)
+    {
+        _collection = collection;
+        _native = native;
+        _handle = handle;
+        _includeVectors = includeVectors;
+    }
+
+    /// <inheritdoc/>
+    public IReadOnlyList<T> Execute(ReadOnlySpan<float> vector)
+    {
+        var handle = _handle;
+        ObjectDisposedException.ThrowIf(handle == IntPtr.Zero, this);
+        return _collection.ExecutePreparedQuery(handle, vector, _includeVectors);
+    }
+
+    /// <inheritdoc/>
+    public void Dispose()
+    {
+        var handle = Interlocked.Exchange(ref _handle, IntPtr.Zero);
+        if (handle != IntPtr.Zero)
+        {
+            _native.zvec_prepared_query_destroy(handle);
+        }
+    }
+}
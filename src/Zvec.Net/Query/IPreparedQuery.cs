@@ -0,0 +1,22 @@
+using Zvec.Net.Models;
+
+namespace Zvec.Net.Query;
+
+/// <summary>
+/// A single-vector query shape prepared once and executed with different vectors.
+/// </summary>
+/// <typeparam name="T">The document type.</typeparam>
+/// <remarks>
+/// Execution pins the caller's vector for the duration of the call instead of copying it into a
+/// managed array, and reuses the native query objects of earlier executions. Instances are safe to
+/// execute from multiple threads at once; dispose them before the collection.
+/// </remarks>
+public interface IPreparedQuery<T> : IDisposable where T : IDocument
+{
+    /// <summary>
+    /// Executes the query with the given vector.
+    /// </summary>
+    /// <param name="vector">The query vector.</param>
+    /// <returns>A list of matching documents.</returns>
+    IReadOnlyList<T> Execute(ReadOnlySpan<float> vector);
+}
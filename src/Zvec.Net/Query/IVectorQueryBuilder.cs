@@ -26,7 +26,7 @@ public interface IVectorQueryBuilder<T> where T : IDocument
         Expression<Func<T, TVector?>> fieldSelector,
         TVector vector,
         double weight = 1.0,
-        IndexQueryParam? param = null) where TVector : struct;
+        IndexQueryParam? param = null) where TVector : notnull;
 
     /// <summary>
     /// Adds a vector query using a document's vector.
@@ -41,7 +41,7 @@ public interface IVectorQueryBuilder<T> where T : IDocument
         Expression<Func<T, TVector?>> fieldSelector,
         string documentId,
         double weight = 1.0,
-        IndexQueryParam? param = null) where TVector : struct;
+        IndexQueryParam? param = null) where TVector : notnull;
 
     /// <summary>
     /// Adds a filter expression to the query.
@@ -92,6 +92,20 @@ public interface IVectorQueryBuilder<T> where T : IDocument
     /// <returns>This builder for method chaining.</returns>
     IVectorQueryBuilder<T> Reranker(IReRanker reRanker);
 
+    /// <summary>
+    /// Restricts results to the documents in the set.
+    /// </summary>
+    /// <param name="ids">The allowed ids.</param>
+    /// <returns>This builder for method chaining.</returns>
+    IVectorQueryBuilder<T> AllowIds(IdSet ids);
+
+    /// <summary>
+    /// Excludes the documents in the set from results.
+    /// </summary>
+    /// <param name="ids">The denied ids.</param>
+    /// <returns>This builder for method chaining.</returns>
+    IVectorQueryBuilder<T> DenyIds(IdSet ids);
+
     /// <summary>
     /// Executes the query synchronously.
     /// </summary>
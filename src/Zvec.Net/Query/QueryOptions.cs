@@ -44,6 +44,26 @@ public sealed record QueryOptions
     /// </summary>
     public IReRanker? ReRanker { get; init; }
 
+    /// <summary>
+    /// Gets or sets the ids results are restricted to.
+    /// </summary>
+    /// <remarks>
+    /// Applied together with <see cref="Filter"/>. Cannot be combined with <see cref="DeniedIds"/>.
+    /// The ids are a post-filter, not part of the index traversal: each native pass is a full search
+    /// whose other hits are dropped, widened until enough allowed hits pass, up to about a million
+    /// candidates. A selective set therefore costs several searches, and a query stopped by the cap
+    /// returns fewer results than requested and is counted by the <c>zvec.query.truncated</c> metric.
+    /// </remarks>
+    public IdSet? AllowedIds { get; init; }
+
+    /// <summary>
+    /// Gets or sets the ids excluded from results.
+    /// </summary>
+    /// <remarks>
+    /// Applied together with <see cref="Filter"/>. Cannot be combined with <see cref="AllowedIds"/>.
+    /// </remarks>
+    public IdSet? DeniedIds { get; init; }
+
     /// <summary>
     /// Gets the default query options.
     /// </summary>
@@ -73,4 +93,14 @@ public sealed record QueryOptions
     /// Creates a copy with a reranker.
     /// </summary>
     public QueryOptions WithReRanker(IReRanker reRanker) => this with { ReRanker = reRanker };
+
+    /// <summary>
+    /// Creates a copy restricted to the given ids.
+    /// </summary>
+    public QueryOptions WithAllowedIds(IdSet ids) => this with { AllowedIds = ids, DeniedIds = null };
+
+    /// <summary>
+    /// Creates a copy that excludes the given ids.
+    /// </summary>
+    public QueryOptions WithDeniedIds(IdSet ids) => this with { DeniedIds = ids, AllowedIds = null };
 }
@@ -5,6 +5,8 @@ namespace Zvec.Net.Query;
 /// </summary>
 /// <remarks>
 /// Rerankers combine results from multiple vector queries into a single ranked list.
+/// <see cref="RrfReRanker"/> and <see cref="WeightedReRanker"/> are fused natively; other
+/// implementations are not supported by query execution.
 /// </remarks>
 public interface IReRanker
 {
@@ -66,7 +68,8 @@ public sealed class RrfReRanker : IReRanker
 /// </summary>
 /// <remarks>
 /// Combines scores from multiple vector queries using specified weights.
-/// Weights must sum to 1.0.
+/// Weights must sum to 1.0. Scores are first normalized to [0, 1] by each field's metric;
+/// fields without a weight fall back to <see cref="VectorQuery.Weight"/>.
 /// </remarks>
 public sealed class WeightedReRanker : IReRanker
 {
@@ -0,0 +1,64 @@
+namespace Zvec.Net.Query;
+
+/// <summary>
+/// Options for scanning every document in a collection.
+/// </summary>
+public sealed record ScanOptions
+{
+    /// <summary>
+    /// Gets or sets the filter expression selecting which documents are scanned.
+    /// </summary>
+    /// <remarks>
+    /// When null, every document is returned. Filter syntax follows zvec filter expression format.
+    /// </remarks>
+    public string? Filter { get; init; }
+
+    /// <summary>
+    /// Gets or sets how many documents are read from the native layer per page.
+    /// </summary>
+    /// <remarks>
+    /// Default is 1,000. Larger pages mean fewer native calls but more documents held at once.
+    /// </remarks>
+    public int BatchSize { get; init; } = 1000;
+
+    /// <summary>
+    /// Gets or sets whether to include vectors in the results.
+    /// </summary>
+    /// <remarks>
+    /// Default is false. Leave it off when only scalar fields are needed; vectors dominate page size.
+    /// </remarks>
+    public bool IncludeVectors { get; init; } = false;
+
+    /// <summary>
+    /// Gets or sets the fields to include in the results.
+    /// </summary>
+    /// <remarks>
+    /// When null, all fields are returned.
+    /// </remarks>
+    public IReadOnlyList<string>? OutputFields { get; init; }
+
+    /// <summary>
+    /// Gets the default scan options.
+    /// </summary>
+    public static ScanOptions Default => new();
+
+    /// <summary>
+    /// Creates a copy with a different filter.
+    /// </summary>
+    public ScanOptions WithFilter(string filter) => this with { Filter = filter };
+
+    /// <summary>
+    /// Creates a copy with a different page size.
+    /// </summary>
+    public ScanOptions WithBatchSize(int batchSize) => this with { BatchSize = batchSize };
+
+    /// <summary>
+    /// Creates a copy with include vectors setting.
+    /// </summary>
+    public ScanOptions WithIncludeVectors(bool include = true) => this with { IncludeVectors = include };
+
+    /// <summary>
+    /// Creates a copy with specified output fields.
+    /// </summary>
+    public ScanOptions WithOutputFields(params string[] fields) => this with { OutputFields = fields };
+}
@@ -12,6 +12,8 @@ namespace Zvec.Net.Query;
 /// <item><see cref="ByVector"/> - Query by vector values</item>
 /// <item><see cref="ById"/> - Query by document ID (uses document's vector)</item>
 /// <item><see cref="BySparseVector"/> - Query by sparse vector</item>
+/// <item><see cref="ByFloat16Vector"/>, <see cref="ByInt8Vector"/>, <see cref="ByInt16Vector"/> - Query a
+/// Float16, Int8 or Int16 field without converting the vector to float32</item>
 /// </list>
 /// </remarks>
 public sealed record VectorQuery
@@ -31,6 +33,14 @@ public sealed record VectorQuery
     /// </summary>
     public float[]? Vector { get; init; }
 
+    /// <summary>
+    /// Gets the query vector for Float16, Int8 and Int16 fields (<c>Half[]</c>, <c>sbyte[]</c> or <c>short[]</c>).
+    /// </summary>
+    /// <remarks>
+    /// Passed to the engine as-is, so its element type must match the field's precision.
+    /// </remarks>
+    public Array? NativeVector { get; init; }
+
     /// <summary>
     /// Gets the sparse query vector for sparse queries.
     /// </summary>
@@ -54,7 +64,7 @@ public sealed record VectorQuery
     /// <summary>
     /// Gets a value indicating whether this is a vector-based query.
     /// </summary>
-    public bool HasVector => Vector != null || SparseVector != null;
+    public bool HasVector => Vector != null || NativeVector != null || SparseVector != null;
 
     /// <summary>
     /// Gets a value indicating whether this is a sparse vector query.
@@ -112,6 +122,52 @@ public sealed record VectorQuery
         };
     }
 
+    /// <summary>
+    /// Creates a query against a Float16 vector field.
+    /// </summary>
+    /// <param name="fieldName">The vector field name.</param>
+    /// <param name="vector">The query vector.</param>
+    /// <param name="weight">Weight for multi-vector queries.</param>
+    /// <param name="param">Optional index query parameters.</param>
+    /// <returns>A new <see cref="VectorQuery"/> instance.</returns>
+    public static VectorQuery ByFloat16Vector(string fieldName, Half[] vector, double weight = 1.0, IndexQueryParam? param = null)
+        => ByNativeVector(fieldName, vector, weight, param);
+
+    /// <summary>
+    /// Creates a query against an Int8 vector field.
+    /// </summary>
+    /// <param name="fieldName">The vector field name.</param>
+    /// <param name="vector">The query vector.</param>
+    /// <param name="weight">Weight for multi-vector queries.</param>
+    /// <param name="param">Optional index query parameters.</param>
+    /// <returns>A new <see cref="VectorQuery"/> instance.</returns>
+    public static VectorQuery ByInt8Vector(string fieldName, sbyte[] vector, double weight = 1.0, IndexQueryParam? param = null)
+        => ByNativeVector(fieldName, vector, weight, param);
+
+    /// <summary>
+    /// Creates a query against an Int16 vector field.
+    /// </summary>
+    /// <param name="fieldName">The vector field name.</param>
+    /// <param name="vector">The query vector.</param>
+    /// <param name="weight">Weight for multi-vector queries.</param>
+    /// <param name="param">Optional index query parameters.</param>
+    /// <returns>A new <see cref="VectorQuery"/> instance.</returns>
+    public static VectorQuery ByInt16Vector(string fieldName, short[] vector, double weight = 1.0, IndexQueryParam? param = null)
+        => ByNativeVector(fieldName, vector, weight, param);
+
+    private static VectorQuery ByNativeVector(string fieldName, Array vector, double weight, IndexQueryParam? param)
+    {
+        if (vector == null || vector.Length == 0)
+            throw new ArgumentException("Vector cannot be null or empty", nameof(vector));
+
+        return new VectorQuery(fieldName)
+        {
+            NativeVector = vector,
+            Weight = weight,
+            Param = param
+        };
+    }
+
     /// <summary>
     /// Creates a query that finds sparse vectors similar to the specified sparse vector.
     /// </summary>
@@ -0,0 +1,17 @@
+using Zvec.Net.Types;
+
+namespace Zvec.Net.Schema;
+
+public sealed class AutoOptimizeStatus
+{
+    public AutoOptimizeState State { get; init; }
+    public long Runs { get; init; }
+    public long Failures { get; init; }
+    public long PendingWrites { get; init; }
+    public long PendingDeletes { get; init; }
+    public TimeSpan LastDuration { get; init; }
+    public StatusCode LastStatus { get; init; }
+
+    public override string ToString() =>
+        $"AutoOptimizeStatus[State={State}, Runs={Runs}, Failures={Failures}, PendingWrites={PendingWrites}, PendingDeletes={PendingDeletes}]";
+}
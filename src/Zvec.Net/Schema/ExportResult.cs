@@ -0,0 +1,13 @@
+namespace Zvec.Net.Schema;
+
+public sealed class ExportResult
+{
+    public long Rows { get; init; }
+    public long Batches { get; init; }
+    public long BytesWritten { get; init; }
+    public TimeSpan Elapsed { get; init; }
+    public double RowsPerSecond { get; init; }
+
+    public override string ToString() =>
+        $"ExportResult[Rows={Rows}, Batches={Batches}, Bytes={BytesWritten}, RowsPerSecond={RowsPerSecond:F0}]";
+}
@@ -0,0 +1,17 @@
+using Zvec.Net.Models;
+
+namespace Zvec.Net.Schema;
+
+public sealed class ImportResult
+{
+    public long RowsRead { get; init; }
+    public long RowsWritten { get; init; }
+    public long RowsFailed { get; init; }
+    public long Chunks { get; init; }
+    public TimeSpan Elapsed { get; init; }
+    public double RowsPerSecond { get; init; }
+    public Status FirstError { get; init; } = Status.Ok;
+
+    public override string ToString() =>
+        $"ImportResult[Read={RowsRead}, Written={RowsWritten}, Failed={RowsFailed}, Chunks={Chunks}, RowsPerSecond={RowsPerSecond:F0}]";
+}
@@ -0,0 +1,12 @@
+namespace Zvec.Net.Schema;
+
+public sealed class QueryCacheStats
+{
+    public long Hits { get; init; }
+    public long Misses { get; init; }
+    public long Evictions { get; init; }
+    public long Entries { get; init; }
+
+    public override string ToString() =>
+        $"QueryCacheStats[Hits={Hits}, Misses={Misses}, Evictions={Evictions}, Entries={Entries}]";
+}
@@ -0,0 +1,13 @@
+namespace Zvec.Net.Schema;
+
+public sealed class QueryTuningPoint
+{
+    public int Value { get; init; }
+    public double Recall { get; init; }
+    public TimeSpan MeanLatency { get; init; }
+    public TimeSpan P99Latency { get; init; }
+    public bool IsPareto { get; init; }
+
+    public override string ToString() =>
+        $"QueryTuningPoint[Value={Value}, Recall={Recall:F3}, MeanLatency={MeanLatency.TotalMicroseconds:F1}us, P99Latency={P99Latency.TotalMicroseconds:F1}us, IsPareto={IsPareto}]";
+}
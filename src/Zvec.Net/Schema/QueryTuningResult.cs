@@ -0,0 +1,17 @@
+using Zvec.Net.Index;
+using Zvec.Net.Types;
+
+namespace Zvec.Net.Schema;
+
+public sealed class QueryTuningResult
+{
+    public IndexType IndexType { get; init; }
+    public IndexQueryParam Recommended { get; init; } = IndexQueryParam.Hnsw();
+    public bool TargetMet { get; init; }
+    public IReadOnlyList<QueryTuningPoint> Points { get; init; } = Array.Empty<QueryTuningPoint>();
+
+    public IEnumerable<QueryTuningPoint> ParetoFront => Points.Where(p => p.IsPareto).OrderBy(p => p.MeanLatency);
+
+    public override string ToString() =>
+        $"QueryTuningResult[IndexType={IndexType}, Recommended={Recommended}, TargetMet={TargetMet}, Points={Points.Count}]";
+}
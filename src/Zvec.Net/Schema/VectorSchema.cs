@@ -123,6 +123,16 @@ public sealed class VectorSchema
     public static VectorSchema Int8(string name, int dimension, IndexParams? indexParams = null)
         => new(name, DataType.VectorInt8, dimension, indexParams);
 
+    /// <summary>
+    /// Creates an Int16 vector schema.
+    /// </summary>
+    /// <param name="name">The field name.</param>
+    /// <param name="dimension">The vector dimension.</param>
+    /// <param name="indexParams">Optional index parameters.</param>
+    /// <returns>A new <see cref="VectorSchema"/> instance.</returns>
+    public static VectorSchema Int16(string name, int dimension, IndexParams? indexParams = null)
+        => new(name, DataType.VectorInt16, dimension, indexParams);
+
     /// <summary>
     /// Creates a SparseFloat32 vector schema.
     /// </summary>
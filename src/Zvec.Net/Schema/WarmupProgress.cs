@@ -0,0 +1,15 @@
+namespace Zvec.Net.Schema;
+
+public sealed class WarmupProgress
+{
+    public long FilesTotal { get; init; }
+    public long FilesLoaded { get; init; }
+    public long BytesTotal { get; init; }
+    public long BytesLoaded { get; init; }
+    public long QueriesTotal { get; init; }
+    public long QueriesRun { get; init; }
+    public bool IsRunning { get; init; }
+
+    public override string ToString() =>
+        $"WarmupProgress[Files={FilesLoaded}/{FilesTotal}, Bytes={BytesLoaded}/{BytesTotal}, Queries={QueriesRun}/{QueriesTotal}, Running={IsRunning}]";
+}
@@ -0,0 +1,27 @@
+namespace Zvec.Net.Types;
+
+/// <summary>
+/// State of a collection's background optimizer.
+/// </summary>
+public enum AutoOptimizeState
+{
+    /// <summary>
+    /// No background optimizer is running.
+    /// </summary>
+    Off = 0,
+
+    /// <summary>
+    /// Waiting for the thresholds to be crossed.
+    /// </summary>
+    Idle = 1,
+
+    /// <summary>
+    /// An optimize is running.
+    /// </summary>
+    Running = 2,
+
+    /// <summary>
+    /// Paused; no new runs start until resumed.
+    /// </summary>
+    Paused = 3
+}
@@ -0,0 +1,25 @@
+namespace Zvec.Net.Types;
+
+/// <summary>
+/// File format written by <see cref="Collection{T}.Export"/>.
+/// </summary>
+/// <remarks>
+/// Values match <see cref="ImportFormat"/>, so an exported file imports with the same format.
+/// </remarks>
+public enum ExportFormat
+{
+    /// <summary>
+    /// Chosen from the file extension: .parquet/.pq or .arrow/.arrows/.ipc/.feather.
+    /// </summary>
+    Auto = 0,
+
+    /// <summary>
+    /// Apache Parquet, one row group per batch.
+    /// </summary>
+    Parquet = 4,
+
+    /// <summary>
+    /// Arrow IPC file format.
+    /// </summary>
+    ArrowIpc = 5
+}
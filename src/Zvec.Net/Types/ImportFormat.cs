@@ -0,0 +1,37 @@
+namespace Zvec.Net.Types;
+
+/// <summary>
+/// File format read by <see cref="Collection{T}.Import"/>.
+/// </summary>
+public enum ImportFormat
+{
+    /// <summary>
+    /// Chosen from the file extension: .fvecs, .bvecs, .npy, .parquet, or .arrow/.arrows/.ipc/.feather.
+    /// </summary>
+    Auto = 0,
+
+    /// <summary>
+    /// Records of an int32 dimension followed by that many float32 values.
+    /// </summary>
+    Fvecs = 1,
+
+    /// <summary>
+    /// Records of an int32 dimension followed by that many uint8 values, widened to float32.
+    /// </summary>
+    Bvecs = 2,
+
+    /// <summary>
+    /// A 2-D NumPy array of float32, float64, float16, int8, int16 or uint8 (widened to float32).
+    /// </summary>
+    Npy = 3,
+
+    /// <summary>
+    /// Apache Parquet; needs a native library built with Arrow.
+    /// </summary>
+    Parquet = 4,
+
+    /// <summary>
+    /// Arrow IPC file or stream; needs a native library built with Arrow.
+    /// </summary>
+    ArrowIpc = 5
+}
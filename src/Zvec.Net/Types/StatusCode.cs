@@ -49,4 +49,9 @@ public enum StatusCode : int
     /// Index operation failed.
     /// </summary>
     IndexError = 8,
+
+    /// <summary>
+    /// An asynchronous operation was cancelled before it started.
+    /// </summary>
+    Cancelled = 9,
 }
@@ -27,6 +27,11 @@ public enum VectorPrecision
     /// </summary>
     Int8,
 
+    /// <summary>
+    /// 16-bit signed integer vectors (quantized).
+    /// </summary>
+    Int16,
+
     /// <summary>
     /// Sparse 32-bit floating point vectors.
     /// </summary>
@@ -54,6 +59,7 @@ public static class VectorPrecisionExtensions
         VectorPrecision.Float32 => DataType.VectorFp32,
         VectorPrecision.Float16 => DataType.VectorFp16,
         VectorPrecision.Int8 => DataType.VectorInt8,
+        VectorPrecision.Int16 => DataType.VectorInt16,
         VectorPrecision.SparseFloat32 => DataType.SparseVectorFp32,
         VectorPrecision.SparseFloat16 => DataType.SparseVectorFp16,
         _ => throw new ArgumentOutOfRangeException(nameof(precision), precision, null)
@@ -23,6 +23,8 @@ internal sealed class VectorQueryBuilder<T> : IVectorQueryBuilder<T> where T : c
     private string? _filter;
     private bool _includeVectors = false;
     private IReRanker? _reranker;
+    private IdSet? _allowedIds;
+    private IdSet? _deniedIds;
 
     /// <summary>
     /// Initializes a new query builder.
@@ -38,7 +40,7 @@ internal sealed class VectorQueryBuilder<T> : IVectorQueryBuilder<T> where T : c
         Expression<Func<T, TVector?>> fieldSelector,
         TVector vector,
         double weight = 1.0,
-        IndexQueryParam? param = null) where TVector : struct
+        IndexQueryParam? param = null) where TVector : notnull
     {
         var fieldName = GetFieldName(fieldSelector);
 
@@ -58,6 +60,18 @@ internal sealed class VectorQueryBuilder<T> : IVectorQueryBuilder<T> where T : c
             var asFloat = doubleArr.Select(d => (float)d).ToArray();
             query = VectorQuery.ByVector(fieldName, asFloat, weight, param);
         }
+        else if (vectorType == typeof(Half[]))
+        {
+            query = VectorQuery.ByFloat16Vector(fieldName, (Half[])(object)vector, weight, param);
+        }
+        else if (vectorType == typeof(sbyte[]))
+        {
+            query = VectorQuery.ByInt8Vector(fieldName, (sbyte[])(object)vector, weight, param);
+        }
+        else if (vectorType == typeof(short[]))
+        {
+            query = VectorQuery.ByInt16Vector(fieldName, (short[])(object)vector, weight, param);
+        }
         else if (vectorType == typeof(SparseVector))
         {
             var sparse = (SparseVector)(object)vector;
@@ -77,7 +91,7 @@ internal sealed class VectorQueryBuilder<T> : IVectorQueryBuilder<T> where T : c
         Expression<Func<T, TVector?>> fieldSelector,
         string documentId,
         double weight = 1.0,
-        IndexQueryParam? param = null) where TVector : struct
+        IndexQueryParam? param = null) where TVector : notnull
     {
         var fieldName = GetFieldName(fieldSelector);
         var query = VectorQuery.ById(fieldName, documentId, weight, param);
@@ -140,28 +154,48 @@ internal sealed class VectorQueryBuilder<T> : IVectorQueryBuilder<T> where T : c
     }
 
     /// <inheritdoc/>
-    public IReadOnlyList<T> Execute()
+    public IVectorQueryBuilder<T> AllowIds(IdSet ids)
     {
-        ValidateQuery();
+        ThrowHelper.ThrowIfNull(ids, nameof(ids));
+        _allowedIds = ids;
+        _deniedIds = null;
+        return this;
+    }
 
-        var options = new QueryOptions
-        {
-            TopK = _topK,
-            Filter = _filter,
-            IncludeVectors = _includeVectors,
-            OutputFields = _outputFields.Count > 0 ? _outputFields : null,
-            ReRanker = _reranker
-        };
+    /// <inheritdoc/>
+    public IVectorQueryBuilder<T> DenyIds(IdSet ids)
+    {
+        ThrowHelper.ThrowIfNull(ids, nameof(ids));
+        _deniedIds = ids;
+        _allowedIds = null;
+        return this;
+    }
 
-        return _collection.ExecuteQuery(_vectorQueries, options);
+    /// <inheritdoc/>
+    public IReadOnlyList<T> Execute()
+    {
+        ValidateQuery();
+        return _collection.ExecuteQuery(_vectorQueries, CreateOptions());
     }
 
     /// <inheritdoc/>
-    public async Task<IReadOnlyList<T>> ExecuteAsync(CancellationToken cancellationToken = default)
+    public Task<IReadOnlyList<T>> ExecuteAsync(CancellationToken cancellationToken = default)
     {
-        return await Task.Run(Execute, cancellationToken).ConfigureAwait(false);
+        ValidateQuery();
+        return _collection.ExecuteQueryAsync(_vectorQueries, CreateOptions(), cancellationToken);
     }
 
+    private QueryOptions CreateOptions() => new()
+    {
+        TopK = _topK,
+        Filter = _filter,
+        IncludeVectors = _includeVectors,
+        OutputFields = _outputFields.Count > 0 ? _outputFields : null,
+        ReRanker = _reranker,
+        AllowedIds = _allowedIds,
+        DeniedIds = _deniedIds
+    };
+
     private void ValidateQuery()
     {
         if (_vectorQueries.Count == 0)
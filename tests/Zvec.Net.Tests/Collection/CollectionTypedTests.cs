@@ -1,3 +1,5 @@
+using System.Diagnostics.Metrics;
+using Zvec.Net.Diagnostics;
 using Zvec.Net.Index;
 using Zvec.Net.Models;
 using Zvec.Net.Native;
@@ -73,7 +75,7 @@ public class CollectionTypedTests : IDisposable
         {
             Id = "doc1",
             Title = "Test",
-            Embedding = new float[] { 1.0f, 2.0f, 3.0f }
+            Embedding = new float[768]
         };
 
         var status = _collection.Insert(doc);
@@ -85,6 +87,128 @@ public class CollectionTypedTests : IDisposable
         Assert.True(collection.Documents.ContainsKey("doc1"));
     }
 
+    // ===== Columnar Insert Tests =====
+
+    [Fact]
+    public void Insert_LargeBatch_UsesColumnarPath()
+    {
+        var docs = CreateArticles(Collection<Article>.ColumnarBatchThreshold);
+
+        var status = _collection.Insert(docs);
+
+        Assert.True(status.IsOk);
+        Assert.Contains($"zvec_collection_insert_columnar({docs.Length})", _mock.MethodCalls);
+        Assert.DoesNotContain("zvec_doc_create", _mock.MethodCalls);
+
+        var stored = _mock.Collections.Values.First().Documents["doc7"];
+        Assert.Equal("Title 7", stored.Fields["Title"]);
+        Assert.Equal(2007, stored.Fields["Year"]);
+        Assert.Null(stored.Fields["Category"]);
+        Assert.Equal(7f, ((float[])stored.Vectors["Embedding"])[0]);
+        Assert.False(_mock.Collections.Values.First().Documents["doc8"].Vectors.ContainsKey("Embedding"));
+    }
+
+    [Fact]
+    public void Insert_SmallBatch_UsesPerDocumentPath()
+    {
+        var docs = CreateArticles(Collection<Article>.ColumnarBatchThreshold - 1);
+
+        _collection.Insert(docs);
+
+        Assert.DoesNotContain(_mock.MethodCalls, c => c.StartsWith("zvec_collection_insert_columnar"));
+        Assert.Contains($"zvec_collection_insert_doc_batch({docs.Length})", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void Insert_RepeatedSmallBatches_ReuseOneNativeDocBatch()
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            _collection.Insert(new Article { Id = $"doc{i}" }, new Article { Id = $"extra{i}" });
+        }
+
+        Assert.Single(_mock.MethodCalls, c => c.StartsWith("zvec_doc_batch_create"));
+        Assert.DoesNotContain("zvec_doc_create", _mock.MethodCalls);
+        Assert.Equal(6, _mock.Collections.Values.First().Documents.Count);
+
+        _collection.Dispose();
+        Assert.Empty(_mock.DocBatches);
+    }
+
+    [Fact]
+    public void Insert_ResolvesFieldIdsOncePerCollection()
+    {
+        _collection.Insert(new Article { Id = "a", Title = "First", Embedding = new float[768] });
+        _collection.Insert(new Article { Id = "b", Title = "Second" });
+
+        Assert.Single(_mock.MethodCalls, c => c == "zvec_collection_resolve_field(Title)");
+        Assert.Single(_mock.MethodCalls, c => c == "zvec_collection_resolve_field(Embedding)");
+        Assert.Contains("zvec_doc_set_string_by_id(Title)", _mock.MethodCalls);
+        Assert.DoesNotContain("zvec_doc_set_string(Title)", _mock.MethodCalls);
+        Assert.Equal("Second", _mock.Collections.Values.First().Documents["b"].Fields["Title"]);
+    }
+
+    [Fact]
+    public void Insert_PropertyTypeDiffersFromSchema_ThrowsOnResolve()
+    {
+        // The stored schema keeps Year as INT64 while the property writes INT32.
+        _mock.Collections.Values.First().FieldTypes["Year"] = new MockFieldType((int)DataType.Int64, 0);
+
+        var ex = Assert.Throws<ZvecException>(() => _collection.Insert(new Article { Id = "a", Year = 2024 }));
+
+        Assert.Contains("field 'Year' has data type", ex.Message);
+        Assert.DoesNotContain(_mock.MethodCalls, c => c.StartsWith("zvec_doc_set_int32_by_id"));
+    }
+
+    [Fact]
+    public void Insert_FieldMissingFromSchema_ThrowsOnResolve()
+    {
+        _mock.Collections.Values.First().FieldTypes.Remove("Category");
+
+        var ex = Assert.Throws<ZvecException>(() => _collection.Insert(new Article { Id = "a" }));
+
+        Assert.Contains("unknown field 'Category'", ex.Message);
+    }
+
+    [Fact]
+    public void Insert_LargeBatchWithRaggedVector_FallsBackToPerDocumentPathAndRejectsRow()
+    {
+        var docs = CreateArticles(Collection<Article>.ColumnarBatchThreshold);
+        docs[3].Embedding = new float[3];
+
+        var ex = Assert.Throws<ZvecException>(() => _collection.Insert(docs));
+
+        Assert.Contains("dimension 768, got 3", ex.Message);
+        Assert.DoesNotContain(_mock.MethodCalls, c => c.StartsWith("zvec_collection_insert_columnar"));
+        Assert.Contains("zvec_doc_set_vector_f32_by_id(Embedding, 3)", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void Upsert_LargeBatch_UsesColumnarPath()
+    {
+        var docs = CreateArticles(Collection<Article>.ColumnarBatchThreshold);
+
+        var status = _collection.Upsert(docs);
+
+        Assert.True(status.IsOk);
+        Assert.Contains($"zvec_collection_upsert_columnar({docs.Length})", _mock.MethodCalls);
+        Assert.Equal(docs.Length, _mock.Collections.Values.First().Documents.Count);
+    }
+
+    private static Article[] CreateArticles(int count)
+    {
+        return Enumerable.Range(0, count).Select(i =>
+        {
+            var article = new Article { Id = $"doc{i}", Title = $"Title {i}", Year = 2000 + i };
+            if (i % 2 == 1)
+            {
+                article.Embedding = new float[768];
+                article.Embedding[0] = i;
+            }
+            return article;
+        }).ToArray();
+    }
+
     // ===== Upsert Tests =====
 
     [Fact]
@@ -173,6 +297,49 @@ public class CollectionTypedTests : IDisposable
         Assert.Contains("zvec_collection_delete_by_filter(year > 2020)", _mock.MethodCalls);
     }
 
+    // ===== Per-Document Write Status Tests =====
+
+    [Fact]
+    public void InsertWithStatus_ReportsOnlyFailedDocuments()
+    {
+        _collection.Insert(new Article { Id = "doc2", Title = "Existing" });
+        var docs = CreateArticles(4);
+
+        var result = _collection.InsertWithStatus(docs);
+
+        Assert.True(result.Status.IsOk);
+        Assert.False(result.IsOk);
+        Assert.Equal(new[] { 2 }, result.FailedIndices);
+        Assert.Equal(StatusCode.AlreadyExists, result.Items[2].Code);
+        Assert.Equal("duplicate key", result.Items[2].Message);
+        Assert.Equal(new[] { "doc2" }, result.SelectFailed(docs).Select(d => d.Id));
+        Assert.Equal(4, _mock.Collections.Values.First().Documents.Count);
+    }
+
+    [Fact]
+    public void InsertWithStatus_LargeBatch_UsesColumnarPath()
+    {
+        _collection.Insert(new Article { Id = "doc5", Title = "Existing" });
+
+        var result = _collection.InsertWithStatus(CreateArticles(Collection<Article>.ColumnarBatchThreshold));
+
+        Assert.Contains($"zvec_collection_insert_columnar_with_status({Collection<Article>.ColumnarBatchThreshold})", _mock.MethodCalls);
+        Assert.Equal(new[] { 5 }, result.FailedIndices);
+    }
+
+    [Fact]
+    public void DeleteWithStatus_MissingIds_ReportedPerId()
+    {
+        _collection.Insert(new Article { Id = "doc1", Title = "Test" });
+
+        var result = _collection.DeleteWithStatus(new[] { "missing", "doc1", "gone" });
+
+        Assert.Equal(new[] { 0, 2 }, result.FailedIndices);
+        Assert.True(result.Items[1].IsOk);
+        Assert.Equal(StatusCode.NotFound, result.Items[0].Code);
+        Assert.Empty(_mock.Collections.Values.First().Documents);
+    }
+
     // ===== Fetch Tests =====
 
     [Fact]
@@ -200,6 +367,62 @@ public class CollectionTypedTests : IDisposable
         Assert.Equal(2, result.Count);
     }
 
+    [Fact]
+    public void Fetch_ReadsFieldsAndVectors()
+    {
+        var embedding = Enumerable.Range(0, 768).Select(i => (float)i).ToArray();
+        _collection.Insert(new Article { Id = "doc1", Title = "Test", Year = 2024, Price = 9.5, Embedding = embedding });
+
+        var doc = _collection.Fetch("doc1")["doc1"];
+
+        Assert.Equal("Test", doc.Title);
+        Assert.Null(doc.Category);
+        Assert.Equal(2024, doc.Year);
+        Assert.Equal(9.5, doc.Price);
+        Assert.Equal(embedding, doc.Embedding);
+    }
+
+    [Fact]
+    public void Fetch_Float16AndInt8Vectors_RoundTripInNativePrecision()
+    {
+        using var collection = Collection<MultimediaDoc>.CreateAndOpen($"/tmp/test_{Guid.NewGuid():N}", null, _mock);
+        var image = Enumerable.Range(0, 512).Select(i => (Half)(i * 0.5f)).ToArray();
+        var audio = Enumerable.Range(0, 128).Select(i => (sbyte)(i - 64)).ToArray();
+
+        collection.Insert(new MultimediaDoc { Id = "doc1", ImageEmbedding = image, AudioFingerprint = audio });
+        var stored = _mock.Collections.Values.Last().Documents["doc1"];
+        var doc = collection.Fetch("doc1")["doc1"];
+
+        Assert.IsType<Half[]>(stored.Vectors[nameof(MultimediaDoc.ImageEmbedding)]);
+        Assert.IsType<sbyte[]>(stored.Vectors[nameof(MultimediaDoc.AudioFingerprint)]);
+        Assert.Equal(image, doc.ImageEmbedding!);
+        Assert.Equal(audio, doc.AudioFingerprint!);
+    }
+
+    [Fact]
+    public void Insert_Float16VectorPerDocument_UsesFloat16Setter()
+    {
+        using var collection = Collection<MultimediaDoc>.CreateAndOpen($"/tmp/test_{Guid.NewGuid():N}", null, _mock);
+
+        collection.Insert(
+            new MultimediaDoc { Id = "doc1", ImageEmbedding = new Half[512] },
+            new MultimediaDoc { Id = "doc2", ImageEmbedding = new Half[512] });
+
+        Assert.Contains($"zvec_doc_set_vector_f16_by_id({nameof(MultimediaDoc.ImageEmbedding)}, 512)", _mock.MethodCalls);
+        Assert.DoesNotContain(_mock.MethodCalls, c => c.StartsWith("zvec_doc_set_vector_f32"));
+    }
+
+    [Fact]
+    public void Query_Float16Vector_PassesVectorWithoutConversion()
+    {
+        using var collection = Collection<MultimediaDoc>.CreateAndOpen($"/tmp/test_{Guid.NewGuid():N}", null, _mock);
+
+        collection.Query(VectorQuery.ByFloat16Vector(nameof(MultimediaDoc.ImageEmbedding), new Half[512]));
+
+        Assert.Contains("zvec_query_set_vector_f16(512)", _mock.MethodCalls);
+        Assert.DoesNotContain(_mock.MethodCalls, c => c.StartsWith("zvec_query_set_vector("));
+    }
+
     [Fact]
     public void Fetch_NonExistentDocument_ReturnsEmpty()
     {
@@ -261,6 +484,659 @@ public class CollectionTypedTests : IDisposable
         Assert.NotEmpty(results);
     }
 
+    [Fact]
+    public void Query_WithIvfParam_PassesParamsToNative()
+    {
+        var vectorQuery = VectorQuery.ByVector("embedding", new float[768], param: IndexQueryParam.Ivf(nProbe: 8));
+
+        _collection.Query(vectorQuery);
+
+        Assert.Contains($"zvec_query_set_params({(int)IndexType.Ivf})", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void Query_ReadsResultsWithSingleExport()
+    {
+        _collection.Insert(
+            new Article { Id = "doc1", Title = "First", Embedding = new float[768] },
+            new Article { Id = "doc2", Title = "Second", Embedding = new float[768] });
+
+        var results = _collection.Query(VectorQuery.ByVector("embedding", new float[768]));
+
+        Assert.Equal(new[] { "First", "Second" }, results.Select(r => r.Title).OrderBy(t => t));
+        Assert.All(results, r => Assert.Null(r.Embedding));
+        Assert.Contains("zvec_result_export(4)", _mock.MethodCalls);
+        Assert.DoesNotContain("zvec_result_get_doc", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void ExecuteQuery_MultipleVectors_FusesNativelyWithRrfByDefault()
+    {
+        _collection.Insert(CreateArticles(5));
+        var queries = new[]
+        {
+            VectorQuery.ByVector("Embedding", new float[768]),
+            VectorQuery.ByVector("Embedding", new float[768])
+        };
+
+        var results = _collection.ExecuteQuery(queries, QueryOptions.Default.WithTopK(3));
+
+        Assert.Equal(3, results.Count);
+        Assert.Contains($"zvec_collection_query_multi(2,{NativeFusion.Rrf})", _mock.MethodCalls);
+        Assert.DoesNotContain("zvec_collection_query", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void ExecuteQuery_WeightedReRanker_PassesPerQueryWeights()
+    {
+        var queries = new[]
+        {
+            VectorQuery.ByVector("title_vec", new float[4]),
+            VectorQuery.ByVector("body_vec", new float[4], weight: 0.9)
+        };
+        var reRanker = new WeightedReRanker(new Dictionary<string, double> { ["title_vec"] = 1.0 });
+
+        _collection.ExecuteQuery(queries, QueryOptions.Default.WithReRanker(reRanker));
+
+        Assert.Contains($"zvec_collection_query_multi(2,{NativeFusion.Weighted})", _mock.MethodCalls);
+        Assert.Equal(new[] { 1.0, 0.9 }, _mock.LastFusionWeights!);
+    }
+
+    [Fact]
+    public void Query_SparseVector_SetsSparseQueryOnly()
+    {
+        var sparse = new SparseVector(new uint[] { 3, 17 }, new[] { 0.5f, 0.25f });
+
+        _collection.Query(VectorQuery.BySparseVector("keywords", sparse));
+
+        Assert.Contains("zvec_query_set_sparse_vector(2)", _mock.MethodCalls);
+        Assert.DoesNotContain(_mock.MethodCalls, c => c.StartsWith("zvec_query_set_vector("));
+    }
+
+    [Fact]
+    public void ExecuteQuery_DenseAndSparse_FusesInOneNativeCall()
+    {
+        var queries = new[]
+        {
+            VectorQuery.ByVector("embedding", new float[768]),
+            VectorQuery.BySparseVector("keywords", new SparseVector(new uint[] { 1 }, new[] { 1f }))
+        };
+
+        _collection.ExecuteQuery(queries, QueryOptions.Default);
+
+        Assert.Contains("zvec_query_set_vector(768)", _mock.MethodCalls);
+        Assert.Contains("zvec_query_set_sparse_vector(1)", _mock.MethodCalls);
+        Assert.Single(_mock.MethodCalls, c => c.StartsWith("zvec_collection_query_multi"));
+    }
+
+    [Fact]
+    public void QueryBuilder_VectorNearest_AcceptsFloatArrayField()
+    {
+        _collection.Insert(CreateArticles(3));
+
+        var results = _collection.Query()
+            .VectorNearest(a => a.Embedding, new float[768])
+            .TopK(2)
+            .Execute();
+
+        Assert.NotEmpty(results);
+        Assert.Contains("zvec_query_set_vector(768)", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void Insert_SparseVectorField_WritesSparseVector()
+    {
+        using var collection = Collection<SparseDoc>.CreateAndOpen($"/tmp/test_{Guid.NewGuid():N}", null, _mock);
+
+        collection.Insert(new SparseDoc("doc1")
+        {
+            Keywords = new SparseVector(new uint[] { 2, 9 }, new[] { 1f, 2f })
+        });
+
+        Assert.Contains($"zvec_doc_set_sparse_vector_f32_by_id({nameof(SparseDoc.Keywords)})", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void QueryBatch_ReturnsOneResultPerVector()
+    {
+        _collection.Insert(new Article { Id = "doc1", Title = "Test" });
+
+        var vectors = new[] { new float[768], new float[768], new float[768] };
+        var results = _collection.QueryBatch("embedding", vectors);
+
+        Assert.Equal(3, results.Count);
+        Assert.All(results, r => Assert.Single(r));
+        Assert.Contains("zvec_collection_query_batch(3x768)", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void QueryBatch_Float16Field_ThrowsZvecException()
+    {
+        using var collection = Collection<MultimediaDoc>.CreateAndOpen($"/tmp/test_{Guid.NewGuid():N}", null, _mock);
+
+        var ex = Assert.Throws<ZvecException>(() =>
+            collection.QueryBatch(nameof(MultimediaDoc.ImageEmbedding), new[] { new float[512] }));
+
+        Assert.Contains("float32", ex.Message);
+    }
+
+    [Fact]
+    public void QueryBatch_Empty_SkipsNativeCall()
+    {
+        var results = _collection.QueryBatch("embedding", Array.Empty<float[]>());
+
+        Assert.Empty(results);
+        Assert.DoesNotContain(_mock.MethodCalls, c => c.StartsWith("zvec_collection_query_batch"));
+    }
+
+    [Fact]
+    public void QueryBatch_MismatchedDimensions_ThrowsArgumentException()
+    {
+        var vectors = new[] { new float[768], new float[512] };
+
+        Assert.Throws<ArgumentException>(() => _collection.QueryBatch("embedding", vectors));
+    }
+
+    [Fact]
+    public void QueryBatch_NativeError_ThrowsZvecException()
+    {
+        var errorMock = new MockNativeMethods();
+        var collection = Collection<Article>.CreateAndOpen("/tmp/test_batch_error", null, errorMock);
+        errorMock.SimulateErrors = true;
+        errorMock.ForceErrorCode = 2;
+
+        Assert.Throws<ZvecException>(() => collection.QueryBatch("embedding", new[] { new float[768] }));
+    }
+
+    [Fact]
+    public void Prepare_ExecutesWithDifferentVectors()
+    {
+        _collection.Insert(CreateArticles(5));
+
+        using var prepared = _collection.Prepare("embedding", QueryOptions.Default.WithTopK(2).WithFilter("year > 2000"));
+        var first = prepared.Execute(new float[768]);
+        var second = prepared.Execute(stackalloc float[768]);
+
+        Assert.Equal(2, first.Count);
+        Assert.Equal(2, second.Count);
+        Assert.Equal(1, _mock.MethodCalls.Count(c => c == nameof(MockNativeMethods.zvec_collection_prepare_query)));
+        Assert.Equal(1, _mock.MethodCalls.Count(c => c == "zvec_query_set_filter(year > 2000)"));
+        Assert.Equal(2, _mock.MethodCalls.Count(c => c == "zvec_prepared_query_execute(768)"));
+    }
+
+    [Fact]
+    public void Prepare_Disposed_ReleasesNativeHandleAndThrows()
+    {
+        var prepared = _collection.Prepare("embedding");
+        prepared.Dispose();
+
+        Assert.Empty(_mock.PreparedQueries);
+        Assert.Throws<ObjectDisposedException>(() => prepared.Execute(new float[768]));
+    }
+
+    [Fact]
+    public void Query_AllowedIds_RestrictsResults()
+    {
+        _collection.Insert(CreateArticles(5));
+        using var ids = IdSet.Create(new[] { "doc1", "doc3", "doc3" }, _mock);
+
+        var results = _collection.Query(VectorQuery.ByVector("embedding", new float[768]), QueryOptions.Default.WithAllowedIds(ids));
+
+        Assert.Equal(2, ids.Count);
+        Assert.Equal(new[] { "doc1", "doc3" }, results.Select(r => r.Id).OrderBy(id => id));
+        Assert.Contains($"zvec_query_set_id_filter({IdSet.AllowMode})", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void Query_TruncatedIdFilteredSearch_RecordsMetric()
+    {
+        _collection.Insert(CreateArticles(3));
+        using var ids = IdSet.Create(new[] { "doc1" }, _mock);
+        _mock.TruncateQueries = true;
+        long truncated = 0;
+        using var listener = new MeterListener();
+        listener.InstrumentPublished = (instrument, l) =>
+        {
+            if (instrument.Meter.Name == ZvecMetrics.MeterName && instrument.Name == "zvec.query.truncated")
+            {
+                l.EnableMeasurementEvents(instrument);
+            }
+        };
+        listener.SetMeasurementEventCallback<long>((_, value, _, _) => Interlocked.Add(ref truncated, value));
+        listener.Start();
+
+        _collection.Query(VectorQuery.ByVector("embedding", new float[768]), QueryOptions.Default);
+        _collection.Query(VectorQuery.ByVector("embedding", new float[768]), QueryOptions.Default.WithAllowedIds(ids));
+
+        Assert.Equal(1, Interlocked.Read(ref truncated));
+    }
+
+    [Fact]
+    public void Query_DeniedIdsFromBuilder_ExcludesResults()
+    {
+        _collection.Insert(CreateArticles(3));
+        using var ids = IdSet.Create(new[] { "doc0" }, _mock);
+
+        var results = _collection.Query()
+            .VectorNearest(a => a.Embedding, new float[768])
+            .DenyIds(ids)
+            .Execute();
+
+        Assert.Equal(new[] { "doc1", "doc2" }, results.Select(r => r.Id).OrderBy(id => id));
+        Assert.Contains($"zvec_query_set_id_filter({IdSet.DenyMode})", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void Query_DisposedIdSet_ThrowsObjectDisposed()
+    {
+        var ids = IdSet.Create(new[] { "doc1" }, _mock);
+        ids.Dispose();
+
+        Assert.Empty(_mock.IdSets);
+        Assert.Throws<ObjectDisposedException>(() =>
+            _collection.Query(VectorQuery.ByVector("embedding", new float[768]), new QueryOptions { AllowedIds = ids }));
+    }
+
+    // ===== Options Tests =====
+
+    [Fact]
+    public void CreateAndOpen_PassesOptionsToNative()
+    {
+        var options = new CollectionOptions { SegmentMaxDocs = 50_000, IndexBuildParallel = 6, AutoFlush = false, QueryParallel = 3, QueryCacheSize = 128 };
+
+        using var collection = Collection<Article>.CreateAndOpen("/tmp/test_options", options, _mock);
+
+        var native = _mock.Collections.Values.Single(c => c.Path == "/tmp/test_options").Options;
+        Assert.Equal(50_000, native.SegmentMaxDocs);
+        Assert.Equal(6, native.IndexBuildParallel);
+        Assert.Equal(0, native.AutoFlush);
+        Assert.Equal(3, native.QueryParallel);
+        Assert.Equal(128, native.QueryCacheSize);
+    }
+
+    [Fact]
+    public void QueryCacheStats_ReturnsNativeCounters()
+    {
+        _mock.Collections.Values.First().QueryCacheStats = new NativeQueryCacheStats { Hits = 5, Misses = 3, Evictions = 1, Entries = 2 };
+
+        var stats = _collection.QueryCacheStats;
+
+        Assert.Equal(5, stats.Hits);
+        Assert.Equal(3, stats.Misses);
+        Assert.Equal(1, stats.Evictions);
+        Assert.Equal(2, stats.Entries);
+        Assert.Contains(nameof(MockNativeMethods.zvec_collection_get_query_cache_stats), _mock.MethodCalls);
+    }
+
+    // ===== Query Tuning Tests =====
+
+    [Fact]
+    public void TuneQuery_ReturnsRecommendationAndAppliesDefaults()
+    {
+        var samples = new[] { new float[] { 0.1f, 0.2f }, new float[] { 0.3f, 0.4f } };
+
+        var result = _collection.TuneQuery("embedding", samples, new QueryTuningOptions { TargetRecall = 0.9, Apply = true });
+
+        Assert.Equal(IndexType.Hnsw, result.IndexType);
+        Assert.True(result.TargetMet);
+        Assert.Equal(64, Assert.IsType<HnswQueryParam>(result.Recommended).Ef);
+        Assert.Equal(new[] { 16, 32, 64, 128 }, result.Points.Select(p => p.Value));
+        Assert.Equal(TimeSpan.FromMicroseconds(32), result.Points[1].MeanLatency);
+        Assert.Equal(2, _mock.LastTuneQueryCount);
+        Assert.Equal(64, _mock.Collections.Values.First().QueryDefaults["embedding"].Ef);
+    }
+
+    [Fact]
+    public void TuneQuery_InvalidOptions_Throws()
+    {
+        var samples = new[] { new float[] { 0.1f, 0.2f } };
+
+        Assert.Throws<ArgumentOutOfRangeException>(() => _collection.TuneQuery("embedding", samples, new QueryTuningOptions { TargetRecall = 1.5 }));
+        Assert.Throws<ArgumentOutOfRangeException>(() => _collection.TuneQuery("embedding", samples, new QueryTuningOptions { Candidates = new[] { 0 } }));
+        Assert.Throws<ArgumentException>(() => _collection.TuneQuery("embedding", Array.Empty<float[]>()));
+        Assert.DoesNotContain(nameof(MockNativeMethods.zvec_collection_tune), _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void SetQueryDefaults_SetsAndClearsNativeDefaults()
+    {
+        _collection.SetQueryDefaults("embedding", IndexQueryParam.Ivf(nProbe: 12));
+        var defaults = _mock.Collections.Values.First().QueryDefaults;
+        Assert.Equal((int)IndexType.Ivf, defaults["embedding"].IndexType);
+        Assert.Equal(12, defaults["embedding"].NProbe);
+
+        _collection.SetQueryDefaults("embedding", null);
+        Assert.Empty(defaults);
+    }
+
+    // ===== Background Optimize Tests =====
+
+    [Fact]
+    public void StartAutoOptimize_PassesPolicyToNative()
+    {
+        _collection.StartAutoOptimize(new AutoOptimizePolicy
+        {
+            CheckInterval = TimeSpan.FromMilliseconds(500),
+            MinInterval = TimeSpan.FromSeconds(30),
+            PendingWrites = 5_000,
+            DeletedRatio = 0.1,
+            Concurrency = 2,
+            BudgetPercent = 50
+        });
+
+        var policy = _mock.Collections.Values.First().AutoOptimizePolicy!.Value;
+        Assert.Equal(500UL, policy.CheckIntervalMs);
+        Assert.Equal(30_000UL, policy.MinIntervalMs);
+        Assert.Equal(5_000UL, policy.PendingWrites);
+        Assert.Equal(0.1, policy.DeletedRatio);
+        Assert.Equal(2, policy.Concurrency);
+        Assert.Equal(50, policy.BudgetPercent);
+        Assert.Equal(AutoOptimizeState.Idle, _collection.AutoOptimizeStatus.State);
+    }
+
+    [Fact]
+    public void AutoOptimize_PauseResumeAndStop_UpdateState()
+    {
+        Assert.Equal(AutoOptimizeState.Off, _collection.AutoOptimizeStatus.State);
+        _collection.StartAutoOptimize();
+
+        _collection.PauseAutoOptimize();
+        Assert.Equal(AutoOptimizeState.Paused, _collection.AutoOptimizeStatus.State);
+
+        _collection.ResumeAutoOptimize();
+        Assert.Equal(AutoOptimizeState.Idle, _collection.AutoOptimizeStatus.State);
+
+        _collection.StopAutoOptimize();
+        Assert.Equal(AutoOptimizeState.Off, _collection.AutoOptimizeStatus.State);
+        Assert.Throws<ZvecException>(() => _collection.PauseAutoOptimize());
+    }
+
+    [Fact]
+    public void StartAutoOptimize_InvalidPolicy_Throws()
+    {
+        Assert.Throws<ArgumentOutOfRangeException>(() => _collection.StartAutoOptimize(new AutoOptimizePolicy { BudgetPercent = 150 }));
+        Assert.Throws<ArgumentOutOfRangeException>(() => _collection.StartAutoOptimize(new AutoOptimizePolicy { DeletedRatio = -1 }));
+        Assert.DoesNotContain(nameof(MockNativeMethods.zvec_collection_start_auto_optimize), _mock.MethodCalls);
+    }
+
+    // ===== Warmup Tests =====
+
+    [Fact]
+    public void Warmup_PassesBudgetAndQueries()
+    {
+        _collection.Insert(CreateArticles(4));
+
+        var progress = _collection.Warmup(new WarmupOptions
+        {
+            ByteBudget = 10_000,
+            ReplayField = "embedding",
+            ReplayQueries = new[] { new float[4], new float[4] }
+        });
+
+        var collection = _mock.Collections.Values.First();
+        Assert.Equal("embedding", collection.WarmupQueryField);
+        Assert.Equal(10_000, progress.BytesTotal);
+        Assert.Equal(progress.BytesTotal, progress.BytesLoaded);
+        Assert.Equal(2, progress.QueriesRun);
+        Assert.False(progress.IsRunning);
+        Assert.Equal(progress.BytesLoaded, _collection.WarmupProgress.BytesLoaded);
+    }
+
+    [Fact]
+    public void Warmup_InvalidOptions_Throws()
+    {
+        Assert.Throws<ArgumentOutOfRangeException>(() => _collection.Warmup(new WarmupOptions { ByteBudget = -1 }));
+        Assert.Throws<ArgumentException>(() => _collection.Warmup(new WarmupOptions { ReplayQueries = new[] { new float[4] } }));
+        Assert.DoesNotContain(nameof(MockNativeMethods.zvec_collection_warmup), _mock.MethodCalls);
+    }
+
+    [Fact]
+    public async Task WarmupAsync_Cancelled_CancelsNativeWarmup()
+    {
+        var collection = _mock.Collections.Values.First();
+        using var gate = new ManualResetEventSlim();
+        collection.WarmupGate = gate;
+        using var cts = new CancellationTokenSource();
+
+        var warmup = _collection.WarmupAsync(cancellationToken: cts.Token);
+        Assert.True(SpinWait.SpinUntil(() => collection.WarmupProgress.Running != 0, TimeSpan.FromSeconds(5)));
+        cts.Cancel();
+
+        await Assert.ThrowsAnyAsync<OperationCanceledException>(() => warmup);
+        Assert.Contains(nameof(MockNativeMethods.zvec_collection_cancel_warmup), _mock.MethodCalls);
+        Assert.False(collection.WarmupCancelled);
+    }
+
+    [Fact]
+    public void Warmup_CancelIssuedBeforeStart_CancelsIt()
+    {
+        _collection.CancelWarmup();
+
+        var ex = Assert.Throws<ZvecException>(() => _collection.Warmup());
+        Assert.Equal(StatusCode.Cancelled, ex.StatusCode);
+        _collection.Warmup();
+    }
+
+    // ===== Import Tests =====
+
+    [Fact]
+    public void Import_PassesMappingAndReportsRows()
+    {
+        _mock.ImportFileRows = 50;
+
+        var result = _collection.Import("/data/vectors.parquet", "embedding", new ImportOptions
+        {
+            Format = ImportFormat.Parquet,
+            PkColumn = "id",
+            ScalarColumns = new[] { "title", "year" },
+            ChunkRows = 20
+        });
+
+        var import = _mock.Collections.Values.First().LastImport!;
+        Assert.Equal("/data/vectors.parquet", import.Path);
+        Assert.Equal((int)ImportFormat.Parquet, import.Format);
+        Assert.Equal("embedding", import.VectorField);
+        Assert.Equal("id", import.PkColumn);
+        Assert.Equal(new[] { "title", "year" }, import.ScalarColumns);
+        Assert.Equal(50, result.RowsRead);
+        Assert.Equal(50, result.RowsWritten);
+        Assert.Equal(3, result.Chunks);
+        Assert.True(result.FirstError.IsOk);
+        Assert.True(result.RowsPerSecond > 0);
+    }
+
+    [Fact]
+    public void Import_ExistingKeys_CountedAsFailedRows()
+    {
+        _mock.ImportFileRows = 10;
+        _collection.Import("/data/a.fvecs", "embedding", new ImportOptions { PkPrefix = "v" });
+
+        var result = _collection.Import("/data/a.fvecs", "embedding", new ImportOptions { PkPrefix = "v", PkStart = 5 });
+
+        Assert.Equal(10, result.RowsRead);
+        Assert.Equal(5, result.RowsWritten);
+        Assert.Equal(5, result.RowsFailed);
+        Assert.Equal("duplicate key", result.FirstError.Message);
+        Assert.Equal(15, _mock.Collections.Values.First().Documents.Count);
+    }
+
+    [Fact]
+    public void Import_InvalidArguments_Throws()
+    {
+        Assert.Throws<ArgumentException>(() => _collection.Import("", "embedding"));
+        Assert.Throws<ArgumentOutOfRangeException>(() => _collection.Import("/data/a.npy", "embedding", new ImportOptions { MaxRows = -1 }));
+        Assert.Throws<ArgumentException>(() => _collection.Import("/data/a.npy", "embedding", new ImportOptions { ScalarColumns = new[] { "" } }));
+        Assert.DoesNotContain(nameof(MockNativeMethods.zvec_collection_import), _mock.MethodCalls);
+    }
+
+    // ===== Export Tests =====
+
+    [Fact]
+    public void Export_PassesOptionsAndReportsRows()
+    {
+        _collection.Insert(CreateArticles(5));
+
+        var result = _collection.Export("/backup/articles.arrow", new ExportOptions
+        {
+            Format = ExportFormat.ArrowIpc,
+            Fields = new[] { "title", "embedding" },
+            Filter = "year > 2000",
+            PkColumn = "id",
+            BatchRows = 2,
+            Concurrency = 4
+        });
+
+        var export = _mock.Collections.Values.First().LastExport!;
+        Assert.Equal("/backup/articles.arrow", export.Path);
+        Assert.Equal((int)ExportFormat.ArrowIpc, export.Format);
+        Assert.Equal(new[] { "title", "embedding" }, export.Fields);
+        Assert.Equal("year > 2000", export.Filter);
+        Assert.Equal("id", export.PkColumn);
+        Assert.Equal(4, export.Concurrency);
+        Assert.Equal(5, result.Rows);
+        Assert.Equal(3, result.Batches);
+        Assert.True(result.BytesWritten > 0);
+    }
+
+    [Fact]
+    public void Export_InvalidOptions_Throws()
+    {
+        Assert.Throws<ArgumentException>(() => _collection.Export(""));
+        Assert.Throws<ArgumentOutOfRangeException>(() => _collection.Export("/backup/a.parquet", new ExportOptions { Concurrency = -1 }));
+        Assert.Throws<ArgumentException>(() => _collection.Export("/backup/a.parquet", new ExportOptions { Fields = new[] { "" } }));
+        Assert.DoesNotContain(nameof(MockNativeMethods.zvec_collection_export), _mock.MethodCalls);
+    }
+
+    // ===== Bulk Load Tests =====
+
+    [Fact]
+    public void BulkLoad_EndRebuildsOptimizesAndFlushes()
+    {
+        _collection.BeginBulkLoad();
+        _collection.Insert(new Article { Id = "doc1", Title = "Test" });
+        _collection.EndBulkLoad();
+
+        var collection = _mock.Collections.Values.First();
+        Assert.False(collection.IsBulkLoading);
+        Assert.Equal(1, collection.OptimizeCount);
+        Assert.Equal(1, collection.FlushCount);
+    }
+
+    [Fact]
+    public void BeginBulkLoad_SecondDropFails_RestoresDroppedIndexes()
+    {
+        var collection = _mock.Collections.Values.First();
+        collection.IndexedFields = new List<string> { "text", "image", "audio" };
+        collection.FailDropIndexAt = 2;
+
+        Assert.Throws<ZvecException>(() => _collection.BeginBulkLoad());
+
+        Assert.False(collection.IsBulkLoading);
+        Assert.Empty(collection.DeferredIndexes);
+        Assert.Equal(new[] { "text", "image", "audio" }, collection.IndexedFields);
+    }
+
+    [Fact]
+    public void EndBulkLoad_RebuildFails_RetryFinishesRebuild()
+    {
+        var collection = _mock.Collections.Values.First();
+        collection.IndexedFields = new List<string> { "text", "image" };
+        _collection.BeginBulkLoad();
+        collection.FailCreateIndexCount = 1;
+
+        Assert.Throws<ZvecException>(() => _collection.EndBulkLoad());
+        Assert.True(collection.IsBulkLoading);
+        Assert.Equal(new[] { "text", "image" }, collection.DeferredIndexes);
+
+        _collection.EndBulkLoad();
+
+        Assert.False(collection.IsBulkLoading);
+        Assert.Empty(collection.DeferredIndexes);
+        Assert.Equal(new[] { "text", "image" }, collection.IndexedFields);
+        Assert.Equal(1, collection.OptimizeCount);
+    }
+
+    [Fact]
+    public void EndBulkLoad_WithoutBegin_ThrowsZvecException()
+    {
+        Assert.Throws<ZvecException>(() => _collection.EndBulkLoad());
+    }
+
+    // ===== Read-Only Tests =====
+
+    [Fact]
+    public void OpenReadOnly_OpensNativeReadOnlyHandle()
+    {
+        using var reader = Collection<Article>.OpenReadOnly(_testPath, null, _mock);
+
+        Assert.True(reader.IsReadOnly);
+        Assert.False(_collection.IsReadOnly);
+        Assert.Contains($"zvec_collection_open_readonly({_testPath})", _mock.MethodCalls);
+        Assert.Throws<ZvecException>(() => reader.Flush());
+    }
+
+    [Fact]
+    public void Refresh_ReadOnly_ReopensNativeCollection()
+    {
+        using var reader = Collection<Article>.OpenReadOnly(_testPath, null, _mock);
+
+        reader.Refresh();
+
+        Assert.Equal(1, _mock.Collections.Values.Single(c => c.IsReadOnly).RefreshCount);
+    }
+
+    [Fact]
+    public void Refresh_Writable_ThrowsInvalidOperation()
+    {
+        Assert.Throws<InvalidOperationException>(() => _collection.Refresh());
+        Assert.DoesNotContain(nameof(MockNativeMethods.zvec_collection_refresh), _mock.MethodCalls);
+    }
+
+    [Fact]
+    public void CreateSnapshot_DoesNotSeeLaterWrites()
+    {
+        _collection.Insert(new Article { Id = "doc1", Title = "Before" });
+
+        using var snapshot = _collection.CreateSnapshot();
+        _collection.Insert(new Article { Id = "doc2", Title = "After" });
+
+        Assert.True(snapshot.IsSnapshot);
+        Assert.True(snapshot.IsReadOnly);
+        Assert.Equal(new[] { "doc1" }, snapshot.Fetch("doc1", "doc2").Keys);
+        Assert.Equal(2, _collection.Fetch("doc1", "doc2").Count);
+    }
+
+    [Fact]
+    public void Optimize_WhileSnapshotOpen_ThrowsUntilReleased()
+    {
+        _collection.Insert(new Article { Id = "doc1", Title = "Before" });
+        var snapshot = _collection.CreateSnapshot();
+
+        var ex = Assert.Throws<ZvecException>(() => _collection.Optimize());
+        Assert.Contains("open snapshots", ex.Message);
+        Assert.Throws<ZvecException>(() => _collection.DropIndex("embedding"));
+        Assert.Single(snapshot.Fetch("doc1"));
+        Assert.Equal(0, _mock.Collections.Values.Single(c => !c.IsSnapshot).OptimizeCount);
+
+        snapshot.Dispose();
+        _collection.Optimize();
+
+        Assert.Equal(1, _mock.Collections.Values.Single().OptimizeCount);
+    }
+
+    [Fact]
+    public void Snapshot_DisposeReleasesAndRefreshThrows()
+    {
+        var snapshot = _collection.CreateSnapshot();
+
+        Assert.Throws<InvalidOperationException>(() => snapshot.Refresh());
+        snapshot.Dispose();
+
+        Assert.Contains(nameof(MockNativeMethods.zvec_collection_snapshot_release), _mock.MethodCalls);
+        Assert.DoesNotContain(nameof(MockNativeMethods.zvec_collection_destroy), _mock.MethodCalls);
+        Assert.Single(_mock.Collections);
+    }
+
     // ===== Disposal Tests =====
 
     [Fact]
@@ -292,6 +1168,36 @@ public class CollectionTypedTests : IDisposable
         var status = await _collection.InsertAsync(new[] { doc });
 
         Assert.True(status.IsOk);
+        Assert.Contains("zvec_collection_insert_async(1)", _mock.MethodCalls);
+        Assert.Contains("zvec_async_release", _mock.MethodCalls);
+    }
+
+    [Fact]
+    public async Task InsertAsync_CompletesFromNativeCallback()
+    {
+        _mock.DeferAsync = true;
+
+        var task = _collection.InsertAsync(new[] { new Article { Id = "deferred" } });
+        Assert.False(task.IsCompleted);
+
+        _mock.RunPendingAsync();
+        var status = await task;
+
+        Assert.True(status.IsOk);
+    }
+
+    [Fact]
+    public async Task InsertAsync_CancelledBeforeStart_IsCancelled()
+    {
+        _mock.DeferAsync = true;
+        using var cts = new CancellationTokenSource();
+
+        var task = _collection.InsertAsync(new[] { new Article { Id = "cancelled" } }, cts.Token);
+        cts.Cancel();
+        _mock.RunPendingAsync();
+
+        await Assert.ThrowsAnyAsync<OperationCanceledException>(() => task);
+        Assert.Contains("zvec_async_cancel", _mock.MethodCalls);
     }
 
     [Fact]
@@ -302,7 +1208,8 @@ public class CollectionTypedTests : IDisposable
         var vectorQuery = VectorQuery.ByVector("embedding", new float[768]);
         var results = await _collection.QueryAsync(vectorQuery);
 
-        Assert.NotNull(results);
+        Assert.Single(results);
+        Assert.Contains(nameof(MockNativeMethods.zvec_collection_query_async), _mock.MethodCalls);
     }
 
     [Fact]
@@ -315,6 +1222,45 @@ public class CollectionTypedTests : IDisposable
         Assert.Single(result);
     }
 
+    // ===== Scan Tests =====
+
+    [Fact]
+    public void Scan_ReturnsEveryDocumentInPages()
+    {
+        _collection.Insert(CreateArticles(5));
+
+        var ids = _collection.Scan(ScanOptions.Default.WithBatchSize(2)).Select(a => a.Id).ToList();
+
+        Assert.Equal(5, ids.Count);
+        Assert.Contains("zvec_collection_scan_open(,0,2)", _mock.MethodCalls);
+        Assert.Equal(4, _mock.MethodCalls.Count(c => c == "zvec_scan_next"));
+        Assert.Empty(_mock.Scans);
+    }
+
+    [Fact]
+    public async Task ScanAsync_StoppedEarly_ClosesCursor()
+    {
+        _collection.Insert(CreateArticles(5));
+        var options = new ScanOptions { Filter = "year > 2000", BatchSize = 2, OutputFields = new[] { "Title" } };
+
+        var seen = 0;
+        await foreach (var _ in _collection.ScanAsync(options))
+        {
+            if (++seen == 3) break;
+        }
+
+        Assert.Equal(3, seen);
+        Assert.Contains("zvec_collection_scan_open(year > 2000,1,2)", _mock.MethodCalls);
+        Assert.Contains("zvec_scan_close", _mock.MethodCalls);
+        Assert.Empty(_mock.Scans);
+    }
+
+    [Fact]
+    public void Scan_NonPositiveBatchSize_Throws()
+    {
+        Assert.Throws<ArgumentOutOfRangeException>(() => _collection.Scan(new ScanOptions { BatchSize = 0 }));
+    }
+
     // ===== Error Handling Tests =====
 
     [Fact]
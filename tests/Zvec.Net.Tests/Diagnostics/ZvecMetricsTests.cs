@@ -0,0 +1,97 @@
+using System.Diagnostics.Metrics;
+using Zvec.Net.Diagnostics;
+using Zvec.Net.Native;
+using Zvec.Net.Tests.Mocks;
+
+namespace Zvec.Net.Tests.Diagnostics;
+
+public class ZvecMetricsTests
+{
+    private readonly MockNativeMethods _mock = new();
+
+    [Fact]
+    public void Snapshot_MapsNativeCountersAndNames()
+    {
+        _mock.OpMetrics[0] = new NativeOpMetrics { Count = 4, Errors = 1, TotalNs = 40_000, MaxNs = 20_000, P50Ns = 9_000, P90Ns = 15_000, P99Ns = 19_900 };
+
+        var snapshot = ZvecMetrics.Snapshot(_mock);
+
+        Assert.Equal(NativeOpMetrics.OpCount, snapshot.Count);
+        var query = snapshot[0];
+        Assert.Equal("query", query.Operation);
+        Assert.Equal(4, query.Count);
+        Assert.Equal(1, query.Errors);
+        Assert.Equal(TimeSpan.FromTicks(400), query.TotalTime);
+        Assert.Equal(TimeSpan.FromTicks(90), query.P50);
+        Assert.Equal(TimeSpan.FromTicks(199), query.P99);
+        Assert.Equal(TimeSpan.FromTicks(200), query.Max);
+        Assert.Equal("write.engine", snapshot[12].Operation);
+        Assert.Equal("import", snapshot[23].Operation);
+        Assert.Equal("bulk_load.end", snapshot[NativeOpMetrics.OpCount - 1].Operation);
+    }
+
+    [Fact]
+    public void Meter_ObservesNativeCallsPerOperation()
+    {
+        _mock.OpMetrics[7] = new NativeOpMetrics { Count = 3, MaxNs = 1_000, P50Ns = 500 };
+        using var meter = ZvecMetrics.CreateMeter(_mock);
+
+        var calls = new Dictionary<string, long>();
+        var latencies = new List<string>();
+        using var listener = new MeterListener();
+        listener.InstrumentPublished = (instrument, l) =>
+        {
+            if (instrument.Meter == meter) l.EnableMeasurementEvents(instrument);
+        };
+        listener.SetMeasurementEventCallback<long>((instrument, value, tags, _) =>
+        {
+            if (instrument.Name == "zvec.native.calls") calls[(string)tags[0].Value!] = value;
+        });
+        listener.SetMeasurementEventCallback<double>((instrument, value, tags, _) =>
+        {
+            if (instrument.Name == "zvec.native.latency") latencies.Add($"{tags[0].Value}/{tags[1].Value}");
+        });
+        listener.Start();
+
+        listener.RecordObservableInstruments();
+
+        Assert.Equal(3, calls["insert"]);
+        Assert.Equal(0, calls["query"]);
+        Assert.Contains("insert/p50", latencies);
+        Assert.DoesNotContain("query/p50", latencies);
+    }
+
+    [Fact]
+    public void Reset_ClearsNativeCounters()
+    {
+        _mock.OpMetrics[0] = new NativeOpMetrics { Count = 4 };
+
+        ZvecMetrics.Reset(_mock);
+
+        Assert.Equal(0, ZvecMetrics.Snapshot(_mock)[0].Count);
+    }
+
+    [Fact]
+    public void Insert_RecordsClientDuration()
+    {
+        var operations = new List<string>();
+        using var listener = new MeterListener();
+        listener.InstrumentPublished = (instrument, l) =>
+        {
+            if (instrument.Meter.Name == ZvecMetrics.MeterName && instrument.Name == "zvec.client.duration")
+            {
+                l.EnableMeasurementEvents(instrument);
+            }
+        };
+        listener.SetMeasurementEventCallback<double>((_, _, tags, _) =>
+        {
+            lock (operations) operations.Add((string)tags[0].Value!);
+        });
+        listener.Start();
+
+        using var collection = Collection<Article>.CreateAndOpen($"/tmp/test_{Guid.NewGuid():N}", null, _mock);
+        collection.Insert(new Article { Id = "doc1", Title = "Test" });
+
+        lock (operations) Assert.Contains("insert", operations);
+    }
+}
@@ -11,7 +11,9 @@ public class CollectionOptionsTests
 
         Assert.Equal(1_000_000, options.SegmentMaxDocs);
         Assert.Equal(0, options.IndexBuildParallel);
-        Assert.True(options.AutoFlush);
+        Assert.False(options.AutoFlush);
+        Assert.Equal(0, options.QueryParallel);
+        Assert.Equal(0, options.QueryCacheSize);
     }
 
     [Fact]
@@ -33,9 +35,25 @@ public class CollectionOptionsTests
     [Fact]
     public void AutoFlush_CanBeSet()
     {
-        var options = new CollectionOptions { AutoFlush = false };
+        var options = new CollectionOptions { AutoFlush = true };
 
-        Assert.False(options.AutoFlush);
+        Assert.True(options.AutoFlush);
+    }
+
+    [Fact]
+    public void QueryParallel_CanBeSet()
+    {
+        var options = new CollectionOptions { QueryParallel = 4 };
+
+        Assert.Equal(4, options.QueryParallel);
+    }
+
+    [Fact]
+    public void QueryCacheSize_CanBeSet()
+    {
+        var options = new CollectionOptions { QueryCacheSize = 256 };
+
+        Assert.Equal(256, options.QueryCacheSize);
     }
 
     [Fact]
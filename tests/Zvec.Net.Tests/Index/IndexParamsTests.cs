@@ -1,4 +1,5 @@
 using Zvec.Net.Index;
+using Zvec.Net.Native;
 using Zvec.Net.Types;
 
 namespace Zvec.Net.Tests.Index;
@@ -131,4 +132,40 @@ public class IndexQueryParamTests
 
         Assert.Equal(256, ((IvfQueryParam)param).NProbe);
     }
+
+    [Fact]
+    public void Flat_CreatesFlatQueryParam()
+    {
+        var param = IndexQueryParam.Flat();
+
+        Assert.IsType<FlatQueryParam>(param);
+        Assert.False(param.IsLinear);
+    }
+
+    [Fact]
+    public void ToNative_Hnsw_MapsAllKnobs()
+    {
+        var param = IndexQueryParam.Hnsw(ef: 32) with { Radius = 0.5f, IsLinear = true, UseRefiner = true };
+
+        var native = NativeQueryParams.FromParam(param);
+
+        Assert.Equal((int)IndexType.Hnsw, native.IndexType);
+        Assert.Equal(32, native.Ef);
+        Assert.Equal(0.5f, native.Radius);
+        Assert.Equal(1, native.IsLinear);
+        Assert.Equal(1, native.IsUsingRefiner);
+    }
+
+    [Fact]
+    public void ToNative_Ivf_MapsNProbeAndRefineFactor()
+    {
+        var param = IndexQueryParam.Ivf(nProbe: 16) with { RefineFactor = 4 };
+
+        var native = NativeQueryParams.FromParam(param);
+
+        Assert.Equal((int)IndexType.Ivf, native.IndexType);
+        Assert.Equal(16, native.NProbe);
+        Assert.Equal(4f, native.RefineFactor);
+        Assert.Equal(0, native.IsLinear);
+    }
 }
@@ -1,4 +1,6 @@
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
+using Zvec.Net.Models;
 using Zvec.Net.Native;
 using Zvec.Net.Schema;
 using Zvec.Net.Types;
@@ -12,15 +14,41 @@ internal sealed class MockNativeMethods : INativeMethods
     private readonly Dictionary<IntPtr, MockDocument> _documents = new();
     private readonly Dictionary<IntPtr, MockQuery> _queries = new();
     private readonly Dictionary<IntPtr, CollectionSchema> _schemas = new();
+    private readonly Dictionary<IntPtr, Dictionary<string, MockFieldType>> _schemaFields = new();
     private readonly Dictionary<IntPtr, MockResult> _results = new();
+    private readonly Dictionary<IntPtr, MockDocBatch> _docBatches = new();
+    private readonly Dictionary<IntPtr, string> _fieldIds = new();
+    private readonly Dictionary<string, int> _fieldDimensions = new();
+    private readonly Dictionary<IntPtr, MockScan> _scans = new();
+    private readonly Dictionary<IntPtr, HashSet<string>> _idSets = new();
+    private readonly Dictionary<IntPtr, (IntPtr Collection, MockQuery Query)> _preparedQueries = new();
+    private readonly List<IntPtr> _writeMessages = new();
+    private IntPtr _importMessage;
+    private const string SnapshotPinnedMessage = "collection has open snapshots; release them before optimizing or changing indexes";
 
     public IReadOnlyDictionary<IntPtr, MockCollection> Collections => _collections;
     public IReadOnlyDictionary<IntPtr, MockDocument> Documents => _documents;
+    public IReadOnlyDictionary<IntPtr, MockDocBatch> DocBatches => _docBatches;
+    public IReadOnlyDictionary<IntPtr, MockScan> Scans => _scans;
+    public IReadOnlyDictionary<IntPtr, HashSet<string>> IdSets => _idSets;
+    public IReadOnlyDictionary<IntPtr, (IntPtr Collection, MockQuery Query)> PreparedQueries => _preparedQueries;
     public List<string> MethodCalls { get; } = new();
 
     public bool SimulateErrors { get; set; }
     public int? ForceErrorCode { get; set; }
     public string? ForceErrorMessage { get; set; }
+    public int ImportFileRows { get; set; } = 100;
+    public bool TruncateQueries { get; set; }
+    public double[]? LastFusionWeights { get; private set; }
+    public int LastTuneQueryCount { get; private set; }
+
+    /// <summary>
+    /// When set, async completions are held until <see cref="RunPendingAsync"/> is called.
+    /// </summary>
+    public bool DeferAsync { get; set; }
+
+    private readonly List<(IntPtr Op, IntPtr Callback, IntPtr UserData, NativeStatus Status, IntPtr Result)> _pendingAsync = new();
+    private readonly HashSet<IntPtr> _cancelledAsync = new();
 
     private IntPtr NextHandle()
     {
@@ -185,6 +213,38 @@ internal sealed class MockNativeMethods : INativeMethods
         return Ok();
     }
 
+    public NativeStatus zvec_doc_set_vector_f16(IntPtr handle, string field, in ushort data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_doc_set_vector_f16)}({field}, {len})");
+        StoreVector(handle, field, in Unsafe.As<ushort, Half>(ref Unsafe.AsRef(in data)), len);
+        return Ok();
+    }
+
+    public NativeStatus zvec_doc_set_vector_i8(IntPtr handle, string field, in sbyte data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_doc_set_vector_i8)}({field}, {len})");
+        StoreVector(handle, field, in data, len);
+        return Ok();
+    }
+
+    public NativeStatus zvec_doc_set_vector_i16(IntPtr handle, string field, in short data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_doc_set_vector_i16)}({field}, {len})");
+        StoreVector(handle, field, in data, len);
+        return Ok();
+    }
+
+    private unsafe void StoreVector<TValue>(IntPtr handle, string field, in TValue data, nuint len) where TValue : unmanaged
+    {
+        if (_documents.TryGetValue(handle, out var doc))
+        {
+            fixed (TValue* src = &data)
+            {
+                doc.Vectors[field] = new ReadOnlySpan<TValue>(src, (int)len).ToArray();
+            }
+        }
+    }
+
     public NativeStatus zvec_doc_set_sparse_vector_f32(IntPtr handle, string field, in uint indices, in float values, nuint len)
     {
         MethodCalls.Add($"{nameof(zvec_doc_set_sparse_vector_f32)}({field})");
@@ -198,6 +258,27 @@ internal sealed class MockNativeMethods : INativeMethods
         return 0;
     }
 
+    public nuint zvec_doc_get_vector_f16(IntPtr handle, string field, out ushort outData, nuint maxLen)
+    {
+        MethodCalls.Add(nameof(zvec_doc_get_vector_f16));
+        outData = 0;
+        return 0;
+    }
+
+    public nuint zvec_doc_get_vector_i8(IntPtr handle, string field, out sbyte outData, nuint maxLen)
+    {
+        MethodCalls.Add(nameof(zvec_doc_get_vector_i8));
+        outData = 0;
+        return 0;
+    }
+
+    public nuint zvec_doc_get_vector_i16(IntPtr handle, string field, out short outData, nuint maxLen)
+    {
+        MethodCalls.Add(nameof(zvec_doc_get_vector_i16));
+        outData = 0;
+        return 0;
+    }
+
     public int zvec_doc_has_field(IntPtr handle, string field)
     {
         MethodCalls.Add(nameof(zvec_doc_has_field));
@@ -248,6 +329,159 @@ internal sealed class MockNativeMethods : INativeMethods
         return 0;
     }
 
+    // ===== Resolved Fields =====
+
+    public NativeStatus zvec_collection_resolve_field(IntPtr handle, string name, int dataType, out IntPtr outField)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_resolve_field)}({name})");
+        outField = IntPtr.Zero;
+        // Collections created from a mock schema know their field types; others accept any field
+        if (_collections.TryGetValue(handle, out var collection) && collection.FieldTypes.Count > 0)
+        {
+            if (!collection.FieldTypes.TryGetValue(name, out var fieldType))
+            {
+                return Error(2, $"unknown field '{name}'");
+            }
+            if (dataType != 0 && dataType != fieldType.DataType)
+            {
+                return Error(2, $"field '{name}' has data type {fieldType.DataType}, not {dataType}");
+            }
+            _fieldDimensions[name] = fieldType.Dimension;
+        }
+
+        outField = _fieldIds.FirstOrDefault(f => f.Value == name).Key;
+        if (outField == IntPtr.Zero)
+        {
+            outField = NextHandle();
+            _fieldIds[outField] = name;
+        }
+        return Ok();
+    }
+
+    private NativeStatus CheckDimension(IntPtr field, nuint len)
+    {
+        var name = _fieldIds[field];
+        if (_fieldDimensions.TryGetValue(name, out var dimension) && dimension > 0 && (int)len != dimension)
+        {
+            return Error(2, $"field '{name}' has dimension {dimension}, got {len}");
+        }
+        return Ok();
+    }
+
+    private NativeStatus SetFieldById(IntPtr handle, IntPtr field, object? value, [CallerMemberName] string method = "")
+    {
+        var name = _fieldIds[field];
+        MethodCalls.Add($"{method}({name})");
+        if (_documents.TryGetValue(handle, out var doc))
+        {
+            doc.Fields[name] = value;
+        }
+        return Ok();
+    }
+
+    public NativeStatus zvec_doc_set_string_by_id(IntPtr handle, IntPtr field, string? value) => SetFieldById(handle, field, value);
+    public NativeStatus zvec_doc_set_int32_by_id(IntPtr handle, IntPtr field, int value) => SetFieldById(handle, field, value);
+    public NativeStatus zvec_doc_set_int64_by_id(IntPtr handle, IntPtr field, long value) => SetFieldById(handle, field, value);
+    public NativeStatus zvec_doc_set_float_by_id(IntPtr handle, IntPtr field, float value) => SetFieldById(handle, field, value);
+    public NativeStatus zvec_doc_set_double_by_id(IntPtr handle, IntPtr field, double value) => SetFieldById(handle, field, value);
+    public NativeStatus zvec_doc_set_bool_by_id(IntPtr handle, IntPtr field, int value) => SetFieldById(handle, field, value != 0);
+    public NativeStatus zvec_doc_set_null_by_id(IntPtr handle, IntPtr field) => SetFieldById(handle, field, null);
+
+    public NativeStatus zvec_doc_set_vector_f32_by_id(IntPtr handle, IntPtr field, in float data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_doc_set_vector_f32_by_id)}({_fieldIds[field]}, {len})");
+        var dimensionError = CheckDimension(field, len);
+        if (!dimensionError.IsOk) return dimensionError;
+        StoreVector(handle, _fieldIds[field], in data, len);
+        return Ok();
+    }
+
+    public NativeStatus zvec_doc_set_vector_f16_by_id(IntPtr handle, IntPtr field, in ushort data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_doc_set_vector_f16_by_id)}({_fieldIds[field]}, {len})");
+        var dimensionError = CheckDimension(field, len);
+        if (!dimensionError.IsOk) return dimensionError;
+        StoreVector(handle, _fieldIds[field], in Unsafe.As<ushort, Half>(ref Unsafe.AsRef(in data)), len);
+        return Ok();
+    }
+
+    public NativeStatus zvec_doc_set_vector_i8_by_id(IntPtr handle, IntPtr field, in sbyte data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_doc_set_vector_i8_by_id)}({_fieldIds[field]}, {len})");
+        var dimensionError = CheckDimension(field, len);
+        if (!dimensionError.IsOk) return dimensionError;
+        StoreVector(handle, _fieldIds[field], in data, len);
+        return Ok();
+    }
+
+    public NativeStatus zvec_doc_set_vector_i16_by_id(IntPtr handle, IntPtr field, in short data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_doc_set_vector_i16_by_id)}({_fieldIds[field]}, {len})");
+        var dimensionError = CheckDimension(field, len);
+        if (!dimensionError.IsOk) return dimensionError;
+        StoreVector(handle, _fieldIds[field], in data, len);
+        return Ok();
+    }
+
+    public NativeStatus zvec_doc_set_sparse_vector_f32_by_id(IntPtr handle, IntPtr field, in uint indices, in float values, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_doc_set_sparse_vector_f32_by_id)}({_fieldIds[field]})");
+        return Ok();
+    }
+
+    // ===== Document Batch =====
+
+    public IntPtr zvec_doc_batch_create(nuint capacity)
+    {
+        MethodCalls.Add($"{nameof(zvec_doc_batch_create)}({capacity})");
+        var handle = NextHandle();
+        _docBatches[handle] = new MockDocBatch();
+        return handle;
+    }
+
+    public void zvec_doc_batch_destroy(IntPtr batch)
+    {
+        MethodCalls.Add(nameof(zvec_doc_batch_destroy));
+        if (_docBatches.Remove(batch, out var docBatch))
+        {
+            foreach (var slot in docBatch.Slots)
+            {
+                _documents.Remove(slot);
+            }
+        }
+    }
+
+    public IntPtr zvec_doc_batch_add(IntPtr batch)
+    {
+        MethodCalls.Add(nameof(zvec_doc_batch_add));
+        if (!_docBatches.TryGetValue(batch, out var docBatch))
+        {
+            return IntPtr.Zero;
+        }
+
+        if (docBatch.Count == docBatch.Slots.Count)
+        {
+            docBatch.Slots.Add(NextHandle());
+        }
+        var slot = docBatch.Slots[docBatch.Count++];
+        _documents[slot] = new MockDocument();
+        return slot;
+    }
+
+    public void zvec_doc_batch_clear(IntPtr batch)
+    {
+        MethodCalls.Add(nameof(zvec_doc_batch_clear));
+        if (_docBatches.TryGetValue(batch, out var docBatch))
+        {
+            docBatch.Count = 0;
+        }
+    }
+
+    public nuint zvec_doc_batch_count(IntPtr batch)
+    {
+        return _docBatches.TryGetValue(batch, out var docBatch) ? (nuint)docBatch.Count : 0;
+    }
+
     // ===== Schema =====
 
     public IntPtr zvec_schema_create(string name)
@@ -270,7 +504,8 @@ internal sealed class MockNativeMethods : INativeMethods
         var name = Marshal.PtrToStringUTF8(fieldDef.Name);
         if (_schemas.TryGetValue(handle, out var schema) && name != null)
         {
-            // Store the field (we'd need to modify CollectionSchema to support mutation for this mock)
+            // CollectionSchema is immutable, so field types are tracked beside it
+            AddSchemaField(handle, name, fieldDef);
         }
         return Ok();
     }
@@ -278,9 +513,23 @@ internal sealed class MockNativeMethods : INativeMethods
     public NativeStatus zvec_schema_add_vector_field(IntPtr handle, in NativeFieldDef fieldDef)
     {
         MethodCalls.Add(nameof(zvec_schema_add_vector_field));
+        var name = Marshal.PtrToStringUTF8(fieldDef.Name);
+        if (_schemas.ContainsKey(handle) && name != null)
+        {
+            AddSchemaField(handle, name, fieldDef);
+        }
         return Ok();
     }
 
+    private void AddSchemaField(IntPtr handle, string name, in NativeFieldDef fieldDef)
+    {
+        if (!_schemaFields.TryGetValue(handle, out var fields))
+        {
+            _schemaFields[handle] = fields = new Dictionary<string, MockFieldType>();
+        }
+        fields[name] = new MockFieldType(fieldDef.DataType, fieldDef.Dimension);
+    }
+
     public IntPtr zvec_collection_get_schema(IntPtr handle)
     {
         MethodCalls.Add(nameof(zvec_collection_get_schema));
@@ -385,6 +634,39 @@ internal sealed class MockNativeMethods : INativeMethods
         }
     }
 
+    public void zvec_query_set_vector_f16(IntPtr handle, in ushort data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_query_set_vector_f16)}({len})");
+    }
+
+    public void zvec_query_set_vector_i8(IntPtr handle, in sbyte data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_query_set_vector_i8)}({len})");
+    }
+
+    public void zvec_query_set_vector_i16(IntPtr handle, in short data, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_query_set_vector_i16)}({len})");
+    }
+
+    public void zvec_query_set_sparse_vector(IntPtr handle, in uint indices, in float values, nuint len)
+    {
+        MethodCalls.Add($"{nameof(zvec_query_set_sparse_vector)}({len})");
+        if (_queries.TryGetValue(handle, out var query))
+        {
+            unsafe
+            {
+                fixed (uint* indicesPtr = &indices)
+                fixed (float* valuesPtr = &values)
+                {
+                    query.SparseVector = new SparseVector(
+                        new ReadOnlySpan<uint>(indicesPtr, (int)len).ToArray(),
+                        new ReadOnlySpan<float>(valuesPtr, (int)len).ToArray());
+                }
+            }
+        }
+    }
+
     public void zvec_query_set_filter(IntPtr handle, string filter)
     {
         MethodCalls.Add($"{nameof(zvec_query_set_filter)}({filter})");
@@ -414,6 +696,45 @@ internal sealed class MockNativeMethods : INativeMethods
         MethodCalls.Add($"{nameof(zvec_query_set_n_probe)}({nProbe})");
     }
 
+    public void zvec_query_set_params(IntPtr handle, in NativeQueryParams queryParams)
+    {
+        MethodCalls.Add($"{nameof(zvec_query_set_params)}({queryParams.IndexType})");
+        if (_queries.TryGetValue(handle, out var query))
+        {
+            query.Params = queryParams;
+        }
+    }
+
+    // ===== Id Sets =====
+
+    public NativeStatus zvec_id_set_create(string[] pks, nuint count, out IntPtr outSet)
+    {
+        MethodCalls.Add($"{nameof(zvec_id_set_create)}({count})");
+        outSet = NextHandle();
+        _idSets[outSet] = new HashSet<string>(pks.Take((int)count));
+        return Ok();
+    }
+
+    public void zvec_id_set_destroy(IntPtr set)
+    {
+        MethodCalls.Add(nameof(zvec_id_set_destroy));
+        _idSets.Remove(set);
+    }
+
+    public nuint zvec_id_set_count(IntPtr set) =>
+        _idSets.TryGetValue(set, out var pks) ? (nuint)pks.Count : 0;
+
+    public void zvec_query_set_id_filter(IntPtr handle, IntPtr set, int mode)
+    {
+        MethodCalls.Add($"{nameof(zvec_query_set_id_filter)}({mode})");
+        if (_queries.TryGetValue(handle, out var query))
+        {
+            // The native query keeps its own reference, so copy the set.
+            var pks = _idSets.TryGetValue(set, out var found) ? new HashSet<string>(found) : null;
+            query.IdFilter = pks == null || mode is not (1 or 2) ? null : (pks, mode == 1);
+        }
+    }
+
     // ===== Collection =====
 
     public NativeStatus zvec_collection_create_and_open(string path, IntPtr schema, in NativeCollectionOptions options, out IntPtr outHandle)
@@ -429,7 +750,11 @@ internal sealed class MockNativeMethods : INativeMethods
 
         outHandle = NextHandle();
         var schemaForCollection = _schemas.TryGetValue(schema, out var s) ? s : new CollectionSchema("mock");
-        _collections[outHandle] = new MockCollection(path, schemaForCollection);
+        _collections[outHandle] = new MockCollection(path, schemaForCollection) { Options = options };
+        if (_schemaFields.TryGetValue(schema, out var fields))
+        {
+            _collections[outHandle].FieldTypes = new Dictionary<string, MockFieldType>(fields);
+        }
         return Ok();
     }
 
@@ -453,144 +778,876 @@ internal sealed class MockNativeMethods : INativeMethods
         }
 
         outHandle = NextHandle();
-        _collections[outHandle] = new MockCollection(path, new CollectionSchema("mock"));
+        _collections[outHandle] = new MockCollection(path, new CollectionSchema("mock")) { Options = options };
         return Ok();
     }
 
-    public void zvec_collection_destroy(IntPtr handle)
+    public NativeStatus zvec_collection_open_readonly(string path, in NativeCollectionOptions options, out IntPtr outHandle)
     {
-        MethodCalls.Add(nameof(zvec_collection_destroy));
-        _collections.Remove(handle);
+        MethodCalls.Add($"{nameof(zvec_collection_open_readonly)}({path})");
+
+        var error = MaybeForceError();
+        if (!error.IsOk)
+        {
+            outHandle = IntPtr.Zero;
+            return error;
+        }
+
+        var schema = _collections.Values.FirstOrDefault(c => c.Path == path)?.Schema ?? new CollectionSchema("mock");
+        outHandle = NextHandle();
+        _collections[outHandle] = new MockCollection(path, schema) { Options = options, IsReadOnly = true };
+        return Ok();
     }
 
-    public NativeStatus zvec_collection_destroy_data(IntPtr handle)
+    public NativeStatus zvec_collection_refresh(IntPtr handle)
     {
-        MethodCalls.Add(nameof(zvec_collection_destroy_data));
-        _collections.Remove(handle);
-        return MaybeForceError();
+        MethodCalls.Add(nameof(zvec_collection_refresh));
+        if (!_collections.TryGetValue(handle, out var collection))
+        {
+            return Error(2, "Invalid handle");
+        }
+
+        if (collection.IsSnapshot)
+        {
+            return Error(2, "snapshots cannot be refreshed");
+        }
+
+        collection.RefreshCount++;
+        return Ok();
     }
 
-    public NativeStatus zvec_collection_flush(IntPtr handle)
+    public NativeStatus zvec_collection_snapshot_create(IntPtr handle, out IntPtr outSnapshot)
     {
-        MethodCalls.Add(nameof(zvec_collection_flush));
-        if (_collections.TryGetValue(handle, out var collection))
+        MethodCalls.Add(nameof(zvec_collection_snapshot_create));
+        outSnapshot = IntPtr.Zero;
+        if (!_collections.TryGetValue(handle, out var collection))
+        {
+            return Error(2, "Invalid handle");
+        }
+
+        var snapshot = new MockCollection(collection.Path, collection.Schema) { Options = collection.Options, IsReadOnly = true, IsSnapshot = true };
+        foreach (var (id, doc) in collection.Documents)
+        {
+            snapshot.Documents[id] = doc.Clone();
+        }
+        if (!collection.IsReadOnly)
         {
             collection.FlushCount++;
+            collection.SnapshotPins++;
+            snapshot.PinnedWriter = collection;
         }
-        return MaybeForceError();
+
+        outSnapshot = NextHandle();
+        _collections[outSnapshot] = snapshot;
+        return Ok();
     }
 
-    public NativeStatus zvec_collection_optimize(IntPtr handle)
+    public NativeStatus zvec_collection_snapshot_release(IntPtr snapshot)
     {
-        MethodCalls.Add(nameof(zvec_collection_optimize));
-        if (_collections.TryGetValue(handle, out var collection))
+        MethodCalls.Add(nameof(zvec_collection_snapshot_release));
+        if (!_collections.TryGetValue(snapshot, out var collection) || !collection.IsSnapshot)
         {
-            collection.OptimizeCount++;
+            return Error(2, "handle is not a snapshot");
         }
-        return MaybeForceError();
+
+        if (collection.PinnedWriter != null)
+        {
+            collection.PinnedWriter.SnapshotPins--;
+        }
+        _collections.Remove(snapshot);
+        return Ok();
     }
 
-    public NativeStatus zvec_collection_create_index(IntPtr handle, string fieldName, in NativeFieldDef indexDef)
+    public void zvec_collection_destroy(IntPtr handle)
     {
-        MethodCalls.Add($"{nameof(zvec_collection_create_index)}({fieldName})");
-        return MaybeForceError();
+        MethodCalls.Add(nameof(zvec_collection_destroy));
+        _collections.Remove(handle);
     }
 
-    public NativeStatus zvec_collection_drop_index(IntPtr handle, string fieldName)
+    public NativeStatus zvec_collection_destroy_data(IntPtr handle)
     {
-        MethodCalls.Add($"{nameof(zvec_collection_drop_index)}({fieldName})");
+        MethodCalls.Add(nameof(zvec_collection_destroy_data));
+        _collections.Remove(handle);
         return MaybeForceError();
     }
 
-    public NativeStatus zvec_collection_insert(IntPtr handle, IntPtr[] docs, nuint count)
+    public NativeStatus zvec_collection_flush(IntPtr handle)
     {
-        MethodCalls.Add($"{nameof(zvec_collection_insert)}({count})");
+        MethodCalls.Add(nameof(zvec_collection_flush));
         if (_collections.TryGetValue(handle, out var collection))
         {
-            for (int i = 0; i < (int)count; i++)
+            if (collection.IsReadOnly)
             {
-                if (_documents.TryGetValue(docs[i], out var doc) && doc.Pk != null)
-                {
-                    collection.Documents[doc.Pk] = doc.Clone();
-                }
+                return Error(2, "collection is opened read-only");
             }
+            collection.FlushCount++;
         }
         return MaybeForceError();
     }
 
-    public NativeStatus zvec_collection_upsert(IntPtr handle, IntPtr[] docs, nuint count)
+    public NativeStatus zvec_collection_optimize(IntPtr handle)
     {
-        MethodCalls.Add($"{nameof(zvec_collection_upsert)}({count})");
+        MethodCalls.Add(nameof(zvec_collection_optimize));
         if (_collections.TryGetValue(handle, out var collection))
         {
-            for (int i = 0; i < (int)count; i++)
+            if (collection.SnapshotPins > 0)
             {
-                if (_documents.TryGetValue(docs[i], out var doc) && doc.Pk != null)
-                {
-                    collection.Documents[doc.Pk] = doc.Clone();
-                }
+                return Error(2, SnapshotPinnedMessage);
             }
+            collection.OptimizeCount++;
         }
         return MaybeForceError();
     }
 
-    public NativeStatus zvec_collection_update(IntPtr handle, IntPtr[] docs, nuint count)
+    public NativeStatus zvec_collection_tune(IntPtr handle, in NativeTuneRequest request, NativeTunePoint[] outPoints, nuint pointCapacity, out NativeTuneReport outReport)
     {
-        MethodCalls.Add($"{nameof(zvec_collection_update)}({count})");
-        if (_collections.TryGetValue(handle, out var collection))
+        MethodCalls.Add(nameof(zvec_collection_tune));
+        outReport = default;
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+
+        var candidates = new[] { 16, 32, 64, 128 };
+        if (request.Candidates != IntPtr.Zero)
         {
-            for (int i = 0; i < (int)count; i++)
-            {
-                if (_documents.TryGetValue(docs[i], out var doc) && doc.Pk != null && collection.Documents.ContainsKey(doc.Pk))
-                {
-                    collection.Documents[doc.Pk] = doc.Clone();
-                }
-            }
+            candidates = new int[(int)request.CandidateCount];
+            Marshal.Copy(request.Candidates, candidates, 0, candidates.Length);
         }
-        return MaybeForceError();
+        LastTuneQueryCount = (int)request.QueryCount;
+
+        // Recall grows linearly up to 1 at 64, latency with the value
+        var points = candidates
+            .Select(v => new NativeTunePoint { Value = v, Recall = Math.Min(1.0, v / 64.0), MeanLatencyUs = v, P99LatencyUs = 2 * v, Pareto = 1 })
+            .ToArray();
+        var target = request.TargetRecall;
+        var met = points.Where(p => p.Recall >= target).ToArray();
+        var pick = met.Length > 0 ? met[0] : points.MaxBy(p => p.Recall);
+
+        if (request.Apply != 0)
+        {
+            collection.QueryDefaults[Marshal.PtrToStringUTF8(request.FieldName)!] =
+                new NativeQueryParams { IndexType = (int)IndexType.Hnsw, Ef = pick.Value };
+        }
+
+        Array.Copy(points, outPoints, Math.Min(points.Length, (int)pointCapacity));
+        outReport.IndexType = (int)IndexType.Hnsw;
+        outReport.Recommended = pick.Value;
+        outReport.TargetMet = met.Length > 0 ? 1 : 0;
+        outReport.PointCount = (nuint)points.Length;
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_set_query_defaults(IntPtr handle, string fieldName, IntPtr queryParams)
+    {
+        MethodCalls.Add(nameof(zvec_collection_set_query_defaults));
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+
+        if (queryParams == IntPtr.Zero)
+        {
+            collection.QueryDefaults.Remove(fieldName);
+        }
+        else
+        {
+            collection.QueryDefaults[fieldName] = Marshal.PtrToStructure<NativeQueryParams>(queryParams);
+        }
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_start_auto_optimize(IntPtr handle, in NativeOptimizePolicy policy)
+    {
+        MethodCalls.Add(nameof(zvec_collection_start_auto_optimize));
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+        if (collection.AutoOptimizePolicy.HasValue) return Error(2, "auto optimize already running");
+
+        collection.AutoOptimizePolicy = policy;
+        collection.AutoOptimizePaused = false;
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_stop_auto_optimize(IntPtr handle)
+    {
+        MethodCalls.Add(nameof(zvec_collection_stop_auto_optimize));
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+
+        collection.AutoOptimizePolicy = null;
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_pause_auto_optimize(IntPtr handle) => SetAutoOptimizePaused(handle, true);
+
+    public NativeStatus zvec_collection_resume_auto_optimize(IntPtr handle) => SetAutoOptimizePaused(handle, false);
+
+    private NativeStatus SetAutoOptimizePaused(IntPtr handle, bool paused)
+    {
+        MethodCalls.Add(paused ? nameof(zvec_collection_pause_auto_optimize) : nameof(zvec_collection_resume_auto_optimize));
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+        if (!collection.AutoOptimizePolicy.HasValue) return Error(2, "auto optimize not running");
+
+        collection.AutoOptimizePaused = paused;
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_get_auto_optimize_status(IntPtr handle, out NativeOptimizeStatus outStatus)
+    {
+        MethodCalls.Add(nameof(zvec_collection_get_auto_optimize_status));
+        outStatus = default;
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+
+        outStatus.State = !collection.AutoOptimizePolicy.HasValue ? 0 : collection.AutoOptimizePaused ? 3 : 1;
+        outStatus.Runs = (ulong)collection.OptimizeCount;
+        return Ok();
+    }
+
+    public unsafe NativeStatus zvec_collection_warmup(IntPtr handle, in NativeWarmupOptions options, out NativeWarmupProgress outProgress)
+    {
+        MethodCalls.Add(nameof(zvec_collection_warmup));
+        outProgress = default;
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+
+        collection.WarmupQueryField = Marshal.PtrToStringUTF8(options.QueryField);
+
+        // One 4 KiB file per document, cut to the budget
+        var bytes = (ulong)collection.Documents.Count * 4096;
+        if (options.ByteBudget > 0) bytes = Math.Min(bytes, options.ByteBudget);
+        var progress = new NativeWarmupProgress
+        {
+            FilesTotal = (bytes + 4095) / 4096,
+            BytesTotal = bytes,
+            QueriesTotal = options.QueryCount,
+            Running = 1
+        };
+        collection.WarmupProgress = progress;
+        collection.WarmupGate?.Wait();
+        if (collection.WarmupCancelled)
+        {
+            collection.WarmupCancelled = false;
+            progress.Running = 0;
+            collection.WarmupProgress = outProgress = progress;
+            return Error((int)StatusCode.Cancelled, "warmup cancelled");
+        }
+
+        progress.FilesLoaded = progress.FilesTotal;
+        progress.BytesLoaded = progress.BytesTotal;
+        progress.QueriesRun = progress.QueriesTotal;
+        progress.Running = 0;
+        collection.WarmupProgress = outProgress = progress;
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_get_warmup_progress(IntPtr handle, out NativeWarmupProgress outProgress)
+    {
+        MethodCalls.Add(nameof(zvec_collection_get_warmup_progress));
+        outProgress = default;
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+
+        outProgress = collection.WarmupProgress;
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_cancel_warmup(IntPtr handle)
+    {
+        MethodCalls.Add(nameof(zvec_collection_cancel_warmup));
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+
+        collection.WarmupCancelled = true;
+        collection.WarmupGate?.Set();
+        return Ok();
+    }
+
+    public unsafe NativeStatus zvec_collection_import(IntPtr handle, string path, int format, in NativeImportMapping mapping, in NativeImportOptions options, out NativeImportReport outReport)
+    {
+        MethodCalls.Add(nameof(zvec_collection_import));
+        outReport = default;
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+        if (collection.IsReadOnly) return Error(2, "collection is opened read-only");
+        var error = MaybeForceError();
+        if (!error.IsOk) return error;
+
+        var columns = (IntPtr*)mapping.ScalarColumns;
+        collection.LastImport = new MockImport
+        {
+            Path = path,
+            Format = format,
+            VectorField = Marshal.PtrToStringUTF8(mapping.VectorField),
+            PkColumn = Marshal.PtrToStringUTF8(mapping.PkColumn),
+            ScalarColumns = Enumerable.Range(0, (int)mapping.ScalarColumnCount)
+                .Select(i => Marshal.PtrToStringUTF8(columns[i])!)
+                .ToList(),
+            ChunkRows = options.ChunkRows,
+            Upsert = options.Upsert != 0
+        };
+
+        // The "file" holds ImportFileRows vectors keyed prefix + row number; inserts of existing keys fail
+        var rows = (ulong)ImportFileRows;
+        if (options.MaxRows > 0) rows = Math.Min(rows, options.MaxRows);
+        var chunk = options.ChunkRows > 0 ? options.ChunkRows : 16384;
+        var prefix = Marshal.PtrToStringUTF8(mapping.PkPrefix) ?? string.Empty;
+        var report = new NativeImportReport { RowsRead = rows, Chunks = (rows + chunk - 1) / chunk, ElapsedMs = 1 };
+        for (ulong i = 0; i < rows; i++)
+        {
+            var pk = prefix + (mapping.PkStart + i);
+            if (options.Upsert == 0 && collection.Documents.ContainsKey(pk))
+            {
+                if (report.RowsFailed++ == 0)
+                {
+                    Marshal.FreeHGlobal(_importMessage);
+                    _importMessage = Marshal.StringToHGlobalAnsi("duplicate key");
+                    report.FirstErrorCode = 4;
+                    report.FirstErrorMessage = _importMessage;
+                }
+                continue;
+            }
+            var doc = new MockDocument { Pk = pk };
+            doc.Vectors[collection.LastImport.VectorField!] = new float[4];
+            collection.Documents[pk] = doc;
+            report.RowsWritten++;
+        }
+        report.RowsPerSecond = report.RowsWritten * 1000.0;
+        outReport = report;
+        return Ok();
+    }
+
+    public unsafe NativeStatus zvec_collection_export(IntPtr handle, string path, int format, in NativeExportOptions options, out NativeExportReport outReport)
+    {
+        MethodCalls.Add(nameof(zvec_collection_export));
+        outReport = default;
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+        var error = MaybeForceError();
+        if (!error.IsOk) return error;
+
+        var fields = (IntPtr*)options.Fields;
+        collection.LastExport = new MockExport
+        {
+            Path = path,
+            Format = format,
+            Fields = Enumerable.Range(0, (int)options.FieldCount)
+                .Select(i => Marshal.PtrToStringUTF8(fields[i])!)
+                .ToList(),
+            Filter = Marshal.PtrToStringUTF8(options.Filter),
+            PkColumn = Marshal.PtrToStringUTF8(options.PkColumn),
+            Concurrency = options.Concurrency
+        };
+
+        // Every document is written; the filter is recorded, not evaluated
+        var rows = (ulong)collection.Documents.Count;
+        var batch = options.BatchRows > 0 ? options.BatchRows : 16384;
+        outReport = new NativeExportReport
+        {
+            Rows = rows,
+            Batches = (rows + batch - 1) / batch,
+            BytesWritten = rows * 64,
+            ElapsedMs = 1,
+            RowsPerSecond = rows * 1000.0
+        };
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_begin_bulk_load(IntPtr handle)
+    {
+        MethodCalls.Add(nameof(zvec_collection_begin_bulk_load));
+        if (!_collections.TryGetValue(handle, out var collection))
+        {
+            return Error(2, "null handle");
+        }
+        if (collection.SnapshotPins > 0)
+        {
+            return Error(2, SnapshotPinnedMessage);
+        }
+        if (collection.IsBulkLoading)
+        {
+            return Error(2, "bulk load already active");
+        }
+        collection.DeferredIndexes.Clear();
+        while (collection.IndexedFields.Count > 0)
+        {
+            if (collection.DeferredIndexes.Count + 1 == collection.FailDropIndexAt)
+            {
+                // Mirror the native rollback: recreate what was already dropped.
+                var failed = collection.IndexedFields[0];
+                collection.IndexedFields.InsertRange(0, collection.DeferredIndexes);
+                collection.DeferredIndexes.Clear();
+                return Error(2, $"drop index failed: {failed}");
+            }
+            collection.DeferredIndexes.Add(collection.IndexedFields[0]);
+            collection.IndexedFields.RemoveAt(0);
+        }
+        collection.IsBulkLoading = true;
+        return MaybeForceError();
+    }
+
+    public NativeStatus zvec_collection_end_bulk_load(IntPtr handle)
+    {
+        MethodCalls.Add(nameof(zvec_collection_end_bulk_load));
+        if (!_collections.TryGetValue(handle, out var collection))
+        {
+            return Error(2, "null handle");
+        }
+        if (!collection.IsBulkLoading)
+        {
+            return Error(2, "no bulk load active");
+        }
+        while (collection.DeferredIndexes.Count > 0)
+        {
+            if (collection.FailCreateIndexCount > 0)
+            {
+                collection.FailCreateIndexCount--;
+                return Error(2, $"create index failed: {collection.DeferredIndexes[0]}");
+            }
+            collection.IndexedFields.Add(collection.DeferredIndexes[0]);
+            collection.DeferredIndexes.RemoveAt(0);
+        }
+        collection.IsBulkLoading = false;
+        collection.OptimizeCount++;
+        collection.FlushCount++;
+        return MaybeForceError();
+    }
+
+    public NativeStatus zvec_collection_create_index(IntPtr handle, string fieldName, in NativeFieldDef indexDef)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_create_index)}({fieldName})");
+        if (_collections.TryGetValue(handle, out var collection) && collection.SnapshotPins > 0)
+        {
+            return Error(2, SnapshotPinnedMessage);
+        }
+        return MaybeForceError();
+    }
+
+    public NativeStatus zvec_collection_drop_index(IntPtr handle, string fieldName)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_drop_index)}({fieldName})");
+        if (_collections.TryGetValue(handle, out var collection) && collection.SnapshotPins > 0)
+        {
+            return Error(2, SnapshotPinnedMessage);
+        }
+        return MaybeForceError();
+    }
+
+    public NativeStatus zvec_collection_insert(IntPtr handle, IntPtr[] docs, nuint count)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_insert)}({count})");
+        if (_collections.TryGetValue(handle, out var collection))
+        {
+            for (int i = 0; i < (int)count; i++)
+            {
+                if (_documents.TryGetValue(docs[i], out var doc) && doc.Pk != null)
+                {
+                    collection.Documents[doc.Pk] = doc.Clone();
+                }
+            }
+        }
+        return MaybeForceError();
+    }
+
+    public NativeStatus zvec_collection_upsert(IntPtr handle, IntPtr[] docs, nuint count)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_upsert)}({count})");
+        if (_collections.TryGetValue(handle, out var collection))
+        {
+            for (int i = 0; i < (int)count; i++)
+            {
+                if (_documents.TryGetValue(docs[i], out var doc) && doc.Pk != null)
+                {
+                    collection.Documents[doc.Pk] = doc.Clone();
+                }
+            }
+        }
+        return MaybeForceError();
+    }
+
+    public NativeStatus zvec_collection_update(IntPtr handle, IntPtr[] docs, nuint count)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_update)}({count})");
+        if (_collections.TryGetValue(handle, out var collection))
+        {
+            for (int i = 0; i < (int)count; i++)
+            {
+                if (_documents.TryGetValue(docs[i], out var doc) && doc.Pk != null && collection.Documents.ContainsKey(doc.Pk))
+                {
+                    collection.Documents[doc.Pk] = doc.Clone();
+                }
+            }
+        }
+        return MaybeForceError();
+    }
+
+    public NativeStatus zvec_collection_insert_doc_batch(IntPtr handle, IntPtr batch)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_insert_doc_batch)}({zvec_doc_batch_count(batch)})");
+        return zvec_collection_insert(handle, BatchDocs(batch), zvec_doc_batch_count(batch));
+    }
+
+    public NativeStatus zvec_collection_upsert_doc_batch(IntPtr handle, IntPtr batch)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_upsert_doc_batch)}({zvec_doc_batch_count(batch)})");
+        return zvec_collection_upsert(handle, BatchDocs(batch), zvec_doc_batch_count(batch));
+    }
+
+    public NativeStatus zvec_collection_update_doc_batch(IntPtr handle, IntPtr batch)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_update_doc_batch)}({zvec_doc_batch_count(batch)})");
+        return zvec_collection_update(handle, BatchDocs(batch), zvec_doc_batch_count(batch));
+    }
+
+    private IntPtr[] BatchDocs(IntPtr batch)
+    {
+        return _docBatches.TryGetValue(batch, out var docBatch)
+            ? docBatch.Slots.Take(docBatch.Count).ToArray()
+            : Array.Empty<IntPtr>();
+    }
+
+    public NativeStatus zvec_collection_insert_columnar(IntPtr handle, in NativeColumnBatch batch)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_insert_columnar)}({batch.RowCount})");
+        if (_collections.TryGetValue(handle, out var collection))
+        {
+            foreach (var doc in DecodeColumnBatch(batch))
+            {
+                collection.Documents[doc.Pk!] = doc;
+            }
+        }
+        return MaybeForceError();
+    }
+
+    public NativeStatus zvec_collection_upsert_columnar(IntPtr handle, in NativeColumnBatch batch)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_upsert_columnar)}({batch.RowCount})");
+        if (_collections.TryGetValue(handle, out var collection))
+        {
+            foreach (var doc in DecodeColumnBatch(batch))
+            {
+                collection.Documents[doc.Pk!] = doc;
+            }
+        }
+        return MaybeForceError();
+    }
+
+    private static unsafe List<MockDocument> DecodeColumnBatch(in NativeColumnBatch batch)
+    {
+        var rows = (int)batch.RowCount;
+        var docs = new List<MockDocument>(rows);
+        var pkOffsets = (int*)batch.PkOffsets;
+        // The native side rejects offsets past the declared sizes, so a mismatch here is a wrapper bug
+        if ((nuint)pkOffsets[rows] > batch.PkDataSize)
+        {
+            throw new InvalidOperationException("pk offsets exceed pk data size");
+        }
+        for (int i = 0; i < rows; i++)
+        {
+            docs.Add(new MockDocument { Pk = ReadUtf8((byte*)batch.PkData, pkOffsets[i], pkOffsets[i + 1]) });
+        }
+
+        var columns = (NativeColumn*)batch.Columns;
+        for (int c = 0; c < (int)batch.ColumnCount; c++)
+        {
+            var column = columns[c];
+            var name = Marshal.PtrToStringUTF8(column.Name)!;
+            var nulls = (byte*)column.NullBitmap;
+            if ((DataType)column.DataType == DataType.String && (nuint)((int*)column.Offsets)[rows] > column.ValuesSize)
+            {
+                throw new InvalidOperationException($"offsets of column '{name}' exceed its values size");
+            }
+
+            for (int i = 0; i < rows; i++)
+            {
+                var isNull = nulls != null && (nulls[i >> 3] & (1 << (i & 7))) != 0;
+                switch ((DataType)column.DataType)
+                {
+                    case DataType.VectorFp32:
+                        if (!isNull) docs[i].Vectors[name] = ReadRow<float>(column, i);
+                        break;
+                    case DataType.VectorFp64:
+                        if (!isNull) docs[i].Vectors[name] = ReadRow<double>(column, i);
+                        break;
+                    case DataType.VectorFp16:
+                        if (!isNull) docs[i].Vectors[name] = ReadRow<Half>(column, i);
+                        break;
+                    case DataType.VectorInt8:
+                        if (!isNull) docs[i].Vectors[name] = ReadRow<sbyte>(column, i);
+                        break;
+                    case DataType.VectorInt16:
+                        if (!isNull) docs[i].Vectors[name] = ReadRow<short>(column, i);
+                        break;
+                    case DataType.String:
+                        var offsets = (int*)column.Offsets;
+                        docs[i].Fields[name] = isNull ? null : ReadUtf8((byte*)column.Values, offsets[i], offsets[i + 1]);
+                        break;
+                    case DataType.Int32:
+                        docs[i].Fields[name] = isNull ? null : ((int*)column.Values)[i];
+                        break;
+                    case DataType.Int64:
+                        docs[i].Fields[name] = isNull ? null : ((long*)column.Values)[i];
+                        break;
+                    case DataType.Float:
+                        docs[i].Fields[name] = isNull ? null : ((float*)column.Values)[i];
+                        break;
+                    case DataType.Double:
+                        docs[i].Fields[name] = isNull ? null : ((double*)column.Values)[i];
+                        break;
+                    case DataType.Bool:
+                        docs[i].Fields[name] = isNull ? null : ((byte*)column.Values)[i] != 0;
+                        break;
+                }
+            }
+        }
+
+        return docs;
+    }
+
+    private static unsafe TValue[] ReadRow<TValue>(in NativeColumn column, int row) where TValue : unmanaged
+    {
+        return new ReadOnlySpan<TValue>((TValue*)column.Values + (long)row * column.Dimension, column.Dimension).ToArray();
     }
 
-    public NativeStatus zvec_collection_delete(IntPtr handle, string[] ids, nuint count)
-    {
-        MethodCalls.Add($"{nameof(zvec_collection_delete)}({count})");
-        if (_collections.TryGetValue(handle, out var collection))
+    private static unsafe string ReadUtf8(byte* data, int begin, int end)
+    {
+        return System.Text.Encoding.UTF8.GetString(data + begin, end - begin);
+    }
+
+    public NativeStatus zvec_collection_delete(IntPtr handle, string[] ids, nuint count)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_delete)}({count})");
+        if (_collections.TryGetValue(handle, out var collection))
+        {
+            for (int i = 0; i < (int)count; i++)
+            {
+                collection.Documents.Remove(ids[i]);
+            }
+        }
+        return MaybeForceError();
+    }
+
+    public NativeStatus zvec_collection_delete_by_filter(IntPtr handle, string filter)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_delete_by_filter)}({filter})");
+        return MaybeForceError();
+    }
+
+    // Per-document write status: inserts fail on existing ids, updates and deletes on missing ones
+    public NativeStatus zvec_collection_insert_doc_batch_with_status(IntPtr handle, IntPtr batch, NativeDocStatus[] outStatuses, out nuint outFailed)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_insert_doc_batch_with_status)}({zvec_doc_batch_count(batch)})");
+        return WriteWithStatus(handle, BatchDocs(batch).Select(h => _documents[h].Clone()), MockWrite.Insert, outStatuses, out outFailed);
+    }
+
+    public NativeStatus zvec_collection_upsert_doc_batch_with_status(IntPtr handle, IntPtr batch, NativeDocStatus[] outStatuses, out nuint outFailed)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_upsert_doc_batch_with_status)}({zvec_doc_batch_count(batch)})");
+        return WriteWithStatus(handle, BatchDocs(batch).Select(h => _documents[h].Clone()), MockWrite.Upsert, outStatuses, out outFailed);
+    }
+
+    public NativeStatus zvec_collection_update_doc_batch_with_status(IntPtr handle, IntPtr batch, NativeDocStatus[] outStatuses, out nuint outFailed)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_update_doc_batch_with_status)}({zvec_doc_batch_count(batch)})");
+        return WriteWithStatus(handle, BatchDocs(batch).Select(h => _documents[h].Clone()), MockWrite.Update, outStatuses, out outFailed);
+    }
+
+    public NativeStatus zvec_collection_insert_columnar_with_status(IntPtr handle, in NativeColumnBatch batch, NativeDocStatus[] outStatuses, out nuint outFailed)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_insert_columnar_with_status)}({batch.RowCount})");
+        return WriteWithStatus(handle, DecodeColumnBatch(batch), MockWrite.Insert, outStatuses, out outFailed);
+    }
+
+    public NativeStatus zvec_collection_upsert_columnar_with_status(IntPtr handle, in NativeColumnBatch batch, NativeDocStatus[] outStatuses, out nuint outFailed)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_upsert_columnar_with_status)}({batch.RowCount})");
+        return WriteWithStatus(handle, DecodeColumnBatch(batch), MockWrite.Upsert, outStatuses, out outFailed);
+    }
+
+    public NativeStatus zvec_collection_delete_with_status(IntPtr handle, string[] ids, nuint count, NativeDocStatus[] outStatuses, out nuint outFailed)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_delete_with_status)}({count})");
+        return WriteWithStatus(handle, ids.Take((int)count).Select(id => new MockDocument { Pk = id }), MockWrite.Delete, outStatuses, out outFailed);
+    }
+
+    public IntPtr zvec_write_status_message(int index)
+    {
+        return index >= 0 && index < _writeMessages.Count ? _writeMessages[index] : IntPtr.Zero;
+    }
+
+    private enum MockWrite { Insert, Upsert, Update, Delete }
+
+    private NativeStatus WriteWithStatus(IntPtr handle, IEnumerable<MockDocument> docs, MockWrite write, NativeDocStatus[] outStatuses, out nuint outFailed)
+    {
+        outFailed = 0;
+        if (!_collections.TryGetValue(handle, out var collection)) return Error(2, "Invalid handle");
+        var error = MaybeForceError();
+        if (!error.IsOk) return error;
+
+        foreach (var ptr in _writeMessages) Marshal.FreeHGlobal(ptr);
+        _writeMessages.Clear();
+        var messages = new Dictionary<string, int>();
+
+        int i = 0;
+        foreach (var doc in docs)
+        {
+            var exists = collection.Documents.ContainsKey(doc.Pk!);
+            var message = write switch
+            {
+                MockWrite.Insert when exists => "duplicate key",
+                MockWrite.Update or MockWrite.Delete when !exists => "not found",
+                _ => null
+            };
+
+            if (message == null)
+            {
+                if (write == MockWrite.Delete) collection.Documents.Remove(doc.Pk!);
+                else collection.Documents[doc.Pk!] = doc;
+                outStatuses[i++] = new NativeDocStatus { Code = 0, MessageIndex = -1 };
+                continue;
+            }
+
+            if (!messages.TryGetValue(message, out var index))
+            {
+                index = messages[message] = _writeMessages.Count;
+                _writeMessages.Add(Marshal.StringToHGlobalAnsi(message));
+            }
+            outStatuses[i++] = new NativeDocStatus { Code = message == "duplicate key" ? 4 : 3, MessageIndex = index };
+            outFailed++;
+        }
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_query(IntPtr handle, IntPtr query, out IntPtr outResult)
+    {
+        MethodCalls.Add(nameof(zvec_collection_query));
+        outResult = IntPtr.Zero;
+
+        if (!_collections.TryGetValue(handle, out var collection) ||
+            !_queries.TryGetValue(query, out var queryObj))
+        {
+            return Error(2, "Invalid handle");
+        }
+
+        var error = MaybeForceError();
+        if (!error.IsOk)
+        {
+            return error;
+        }
+
+        // Create a mock result with all documents (in real implementation would do similarity search)
+        outResult = NextHandle();
+        var result = new MockResult { Truncated = TruncateQueries && queryObj.IdFilter != null };
+
+        foreach (var doc in collection.Documents.Values)
         {
-            for (int i = 0; i < (int)count; i++)
+            if (queryObj.IdFilter is var (pks, allow) && pks.Contains(doc.Pk ?? string.Empty) != allow)
             {
-                collection.Documents.Remove(ids[i]);
+                continue;
             }
+            result.Documents.Add(doc.Clone());
         }
-        return MaybeForceError();
+
+        _results[outResult] = result;
+        return Ok();
     }
 
-    public NativeStatus zvec_collection_delete_by_filter(IntPtr handle, string filter)
+    public NativeStatus zvec_collection_prepare_query(IntPtr handle, IntPtr query, out IntPtr outPrepared)
     {
-        MethodCalls.Add($"{nameof(zvec_collection_delete_by_filter)}({filter})");
-        return MaybeForceError();
+        MethodCalls.Add(nameof(zvec_collection_prepare_query));
+        outPrepared = IntPtr.Zero;
+
+        if (!_collections.ContainsKey(handle) || !_queries.TryGetValue(query, out var queryObj))
+        {
+            return Error(2, "Invalid handle");
+        }
+
+        outPrepared = NextHandle();
+        _preparedQueries[outPrepared] = (handle, queryObj);
+        return Ok();
     }
 
-    public NativeStatus zvec_collection_query(IntPtr handle, IntPtr query, out IntPtr outResult)
+    public void zvec_prepared_query_destroy(IntPtr prepared)
     {
-        MethodCalls.Add(nameof(zvec_collection_query));
+        MethodCalls.Add(nameof(zvec_prepared_query_destroy));
+        _preparedQueries.Remove(prepared);
+    }
+
+    public NativeStatus zvec_prepared_query_execute(IntPtr prepared, in float vector, nuint len, out IntPtr outResult)
+    {
+        MethodCalls.Add($"{nameof(zvec_prepared_query_execute)}({len})");
         outResult = IntPtr.Zero;
 
+        if (!_preparedQueries.TryGetValue(prepared, out var entry) ||
+            !_collections.TryGetValue(entry.Collection, out var collection))
+        {
+            return Error(2, "Invalid handle");
+        }
+
+        outResult = NextHandle();
+        var result = new MockResult();
+        foreach (var doc in collection.Documents.Values.Take(entry.Query.TopK))
+        {
+            result.Documents.Add(doc.Clone());
+        }
+
+        _results[outResult] = result;
+        return Ok();
+    }
+
+    public NativeStatus zvec_collection_query_batch(IntPtr handle, IntPtr query, in float vectors, nuint queryCount, nuint dimension, IntPtr[] outResults)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_query_batch)}({queryCount}x{dimension})");
+
         if (!_collections.TryGetValue(handle, out var collection) ||
-            !_queries.TryGetValue(query, out var queryObj))
+            !_queries.ContainsKey(query))
         {
             return Error(2, "Invalid handle");
         }
 
+        var fieldName = _queries[query].FieldName;
+        if (fieldName != null && collection.FieldTypes.TryGetValue(fieldName, out var fieldType) &&
+            fieldType.DataType != (int)DataType.VectorFp32)
+        {
+            return Error(2, $"query_batch takes float32 vectors; field '{fieldName}' is not VECTOR_FP32");
+        }
+
         var error = MaybeForceError();
         if (!error.IsOk)
         {
             return error;
         }
 
-        // Create a mock result with all documents (in real implementation would do similarity search)
+        for (int i = 0; i < (int)queryCount; i++)
+        {
+            var result = new MockResult();
+            foreach (var doc in collection.Documents.Values)
+            {
+                result.Documents.Add(doc.Clone());
+            }
+
+            outResults[i] = NextHandle();
+            _results[outResults[i]] = result;
+        }
+        return Ok();
+    }
+
+    public unsafe NativeStatus zvec_collection_query_multi(IntPtr handle, IntPtr[] queries, nuint queryCount, in NativeFusion fusion, out IntPtr outResult)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_query_multi)}({queryCount},{fusion.Method})");
+        outResult = IntPtr.Zero;
+
+        if (!_collections.TryGetValue(handle, out var collection) ||
+            queries.Take((int)queryCount).Any(q => !_queries.ContainsKey(q)))
+        {
+            return Error(2, "Invalid handle");
+        }
+
+        if (fusion.Method == NativeFusion.Weighted && fusion.WeightCount != queryCount)
+        {
+            return Error(2, "weight_count must equal query_count");
+        }
+
+        var error = MaybeForceError();
+        if (!error.IsOk)
+        {
+            return error;
+        }
+
+        LastFusionWeights = fusion.Method == NativeFusion.Weighted
+            ? new ReadOnlySpan<double>((void*)fusion.Weights, (int)queryCount).ToArray()
+            : null;
+
         outResult = NextHandle();
         var result = new MockResult();
-
-        foreach (var doc in collection.Documents.Values)
+        foreach (var doc in collection.Documents.Values.Take(fusion.TopK))
         {
             result.Documents.Add(doc.Clone());
         }
@@ -640,12 +1697,215 @@ internal sealed class MockNativeMethods : INativeMethods
         return IntPtr.Zero;
     }
 
+    public NativeStatus zvec_collection_get_query_cache_stats(IntPtr handle, out NativeQueryCacheStats outStats)
+    {
+        MethodCalls.Add(nameof(zvec_collection_get_query_cache_stats));
+        if (!_collections.TryGetValue(handle, out var collection))
+        {
+            outStats = default;
+            return Error(2, "Invalid handle");
+        }
+
+        outStats = collection.QueryCacheStats;
+        return Ok();
+    }
+
+    // ===== Metrics =====
+
+    private static readonly string[] OpNames =
+    {
+        "query", "query.prepare", "query.engine", "query.materialize", "query.batch",
+        "query.multi", "fetch", "insert", "upsert", "update", "delete", "write.convert",
+        "write.engine", "delete_by_filter", "flush", "optimize", "create_index",
+        "drop_index", "open", "scan.open", "scan.next", "result.export", "async.queue",
+        "import", "export", "warmup", "tune", "snapshot.create", "refresh", "prepared.execute",
+        "id_set.create", "bulk_load.begin", "bulk_load.end",
+    };
+
+    private readonly IntPtr[] _opNamePtrs = new IntPtr[OpNames.Length];
+
+    public NativeOpMetrics[] OpMetrics { get; } = new NativeOpMetrics[NativeOpMetrics.OpCount];
+
+    public NativeStatus zvec_metrics_snapshot(NativeOpMetrics[] outMetrics, nuint count)
+    {
+        MethodCalls.Add(nameof(zvec_metrics_snapshot));
+        Array.Copy(OpMetrics, outMetrics, Math.Min((int)count, OpMetrics.Length));
+        return Ok();
+    }
+
+    public void zvec_metrics_reset()
+    {
+        MethodCalls.Add(nameof(zvec_metrics_reset));
+        Array.Clear(OpMetrics);
+    }
+
+    public IntPtr zvec_metrics_op_name(int op)
+    {
+        if (op < 0 || op >= OpNames.Length) return IntPtr.Zero;
+        if (_opNamePtrs[op] == IntPtr.Zero)
+        {
+            _opNamePtrs[op] = Marshal.StringToHGlobalAnsi(OpNames[op]);
+        }
+        return _opNamePtrs[op];
+    }
+
+    // ===== Async =====
+
+    // The mock applies the operation at submission time and only defers the completion callback.
+    private NativeStatus CompleteAsync(NativeStatus status, IntPtr result, IntPtr callback, IntPtr userData, out IntPtr op)
+    {
+        op = NextHandle();
+        _pendingAsync.Add((op, callback, userData, status, result));
+        if (!DeferAsync)
+        {
+            RunPendingAsync();
+        }
+        return Ok();
+    }
+
+    public unsafe void RunPendingAsync()
+    {
+        var pending = _pendingAsync.ToList();
+        _pendingAsync.Clear();
+
+        foreach (var (op, callback, userData, status, result) in pending)
+        {
+            var completion = status;
+            var completionResult = result;
+            if (_cancelledAsync.Contains(op))
+            {
+                completion = Error((int)StatusCode.Cancelled, "operation cancelled");
+                completionResult = IntPtr.Zero;
+                _results.Remove(result);
+            }
+            ((delegate* unmanaged[Cdecl]<IntPtr, NativeStatus, IntPtr, void>)callback)(userData, completion, completionResult);
+        }
+    }
+
+    public NativeStatus zvec_collection_query_async(IntPtr handle, IntPtr query, IntPtr callback, IntPtr userData, out IntPtr op)
+    {
+        MethodCalls.Add(nameof(zvec_collection_query_async));
+        var status = zvec_collection_query(handle, query, out var result);
+        return CompleteAsync(status, result, callback, userData, out op);
+    }
+
+    public NativeStatus zvec_collection_insert_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_insert_async)}({count})");
+        return CompleteAsync(zvec_collection_insert(handle, docs, count), IntPtr.Zero, callback, userData, out op);
+    }
+
+    public NativeStatus zvec_collection_upsert_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_upsert_async)}({count})");
+        return CompleteAsync(zvec_collection_upsert(handle, docs, count), IntPtr.Zero, callback, userData, out op);
+    }
+
+    public NativeStatus zvec_collection_update_async(IntPtr handle, IntPtr[] docs, nuint count, IntPtr callback, IntPtr userData, out IntPtr op)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_update_async)}({count})");
+        return CompleteAsync(zvec_collection_update(handle, docs, count), IntPtr.Zero, callback, userData, out op);
+    }
+
+    public NativeStatus zvec_collection_insert_columnar_async(IntPtr handle, in NativeColumnBatch batch, IntPtr callback, IntPtr userData, out IntPtr op)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_insert_columnar_async)}({batch.RowCount})");
+        return CompleteAsync(zvec_collection_insert_columnar(handle, in batch), IntPtr.Zero, callback, userData, out op);
+    }
+
+    public NativeStatus zvec_collection_upsert_columnar_async(IntPtr handle, in NativeColumnBatch batch, IntPtr callback, IntPtr userData, out IntPtr op)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_upsert_columnar_async)}({batch.RowCount})");
+        return CompleteAsync(zvec_collection_upsert_columnar(handle, in batch), IntPtr.Zero, callback, userData, out op);
+    }
+
+    public NativeStatus zvec_collection_delete_async(IntPtr handle, string[] ids, nuint count, IntPtr callback, IntPtr userData, out IntPtr op)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_delete_async)}({count})");
+        return CompleteAsync(zvec_collection_delete(handle, ids, count), IntPtr.Zero, callback, userData, out op);
+    }
+
+    public void zvec_async_cancel(IntPtr op)
+    {
+        MethodCalls.Add(nameof(zvec_async_cancel));
+        if (_pendingAsync.Any(p => p.Op == op))
+        {
+            _cancelledAsync.Add(op);
+        }
+    }
+
+    public void zvec_async_release(IntPtr op)
+    {
+        MethodCalls.Add(nameof(zvec_async_release));
+        _cancelledAsync.Remove(op);
+    }
+
+    // ===== Scan =====
+
+    public NativeStatus zvec_collection_scan_open(IntPtr handle, string? filter, string[]? outputFields, nuint outputFieldCount, int includeVector, nuint batchSize, out IntPtr outScan)
+    {
+        MethodCalls.Add($"{nameof(zvec_collection_scan_open)}({filter},{outputFieldCount},{batchSize})");
+        outScan = IntPtr.Zero;
+
+        if (!_collections.TryGetValue(handle, out var collection))
+        {
+            return Error(2, "Invalid handle");
+        }
+
+        var error = MaybeForceError();
+        if (!error.IsOk)
+        {
+            return error;
+        }
+
+        outScan = NextHandle();
+        _scans[outScan] = new MockScan
+        {
+            Documents = collection.Documents.Values.Select(d => d.Clone()).ToList(),
+            BatchSize = (int)batchSize
+        };
+        return Ok();
+    }
+
+    public NativeStatus zvec_scan_next(IntPtr scan, out IntPtr outResult)
+    {
+        MethodCalls.Add(nameof(zvec_scan_next));
+        outResult = IntPtr.Zero;
+
+        if (!_scans.TryGetValue(scan, out var mockScan))
+        {
+            return Error(2, "Invalid handle");
+        }
+
+        if (mockScan.Next >= mockScan.Documents.Count)
+        {
+            return Ok();
+        }
+
+        var result = new MockResult();
+        result.Documents.AddRange(mockScan.Documents.Skip(mockScan.Next).Take(mockScan.BatchSize));
+        mockScan.Next += result.Documents.Count;
+
+        outResult = NextHandle();
+        _results[outResult] = result;
+        return Ok();
+    }
+
+    public void zvec_scan_close(IntPtr scan)
+    {
+        MethodCalls.Add(nameof(zvec_scan_close));
+        _scans.Remove(scan);
+    }
+
     // ===== Result =====
 
     public void zvec_result_destroy(IntPtr handle)
     {
         MethodCalls.Add(nameof(zvec_result_destroy));
-        _results.Remove(handle);
+        if (_results.Remove(handle, out var result))
+        {
+            result.FreeExportBuffers();
+        }
     }
 
     public nuint zvec_result_count(IntPtr handle)
@@ -658,6 +1918,11 @@ internal sealed class MockNativeMethods : INativeMethods
         return 0;
     }
 
+    public int zvec_result_truncated(IntPtr handle)
+    {
+        return _results.TryGetValue(handle, out var result) && result.Truncated ? 1 : 0;
+    }
+
     public IntPtr zvec_result_get_doc(IntPtr handle, nuint index)
     {
         MethodCalls.Add(nameof(zvec_result_get_doc));
@@ -669,6 +1934,118 @@ internal sealed class MockNativeMethods : INativeMethods
         }
         return IntPtr.Zero;
     }
+
+    public NativeStatus zvec_result_export(IntPtr handle, NativeColumn[] columns, nuint columnCount, out NativeResultExport export)
+    {
+        MethodCalls.Add($"{nameof(zvec_result_export)}({columnCount})");
+        export = default;
+
+        if (!_results.TryGetValue(handle, out var result))
+        {
+            return Error(2, "Invalid handle");
+        }
+
+        var error = MaybeForceError();
+        if (!error.IsOk)
+        {
+            return error;
+        }
+
+        var docs = result.Documents;
+        result.FreeExportBuffers();
+
+        var pks = EncodeStrings(docs.Select(d => (object?)d.Pk).ToList());
+        export.RowCount = (nuint)docs.Count;
+        export.PkData = result.Export(pks.Bytes);
+        export.PkOffsets = result.Export(pks.Offsets);
+        export.Scores = result.Export(docs.Select(d => d.Score).ToArray());
+
+        for (int c = 0; c < (int)columnCount; c++)
+        {
+            var name = Marshal.PtrToStringUTF8(columns[c].Name)!;
+            var dataType = (DataType)columns[c].DataType;
+            var dimension = columns[c].Dimension;
+            var nulls = new byte[(docs.Count + 7) / 8];
+
+            var values = docs.Select((d, i) =>
+            {
+                object? value = dimension > 0
+                    ? d.Vectors.GetValueOrDefault(name)
+                    : d.Fields.GetValueOrDefault(name);
+                if (value == null || (value is Array v && v.Length != dimension))
+                {
+                    nulls[i >> 3] |= (byte)(1 << (i & 7));
+                    return null;
+                }
+                return value;
+            }).ToList();
+
+            switch (dataType)
+            {
+                case DataType.String:
+                    var strings = EncodeStrings(values);
+                    columns[c].Values = result.Export(strings.Bytes);
+                    columns[c].Offsets = result.Export(strings.Offsets);
+                    break;
+                case DataType.Int32:
+                    columns[c].Values = result.Export(values.Select(v => v == null ? 0 : Convert.ToInt32(v)).ToArray());
+                    break;
+                case DataType.Int64:
+                    columns[c].Values = result.Export(values.Select(v => v == null ? 0L : Convert.ToInt64(v)).ToArray());
+                    break;
+                case DataType.Float:
+                    columns[c].Values = result.Export(values.Select(v => v == null ? 0f : Convert.ToSingle(v)).ToArray());
+                    break;
+                case DataType.Double:
+                    columns[c].Values = result.Export(values.Select(v => v == null ? 0d : Convert.ToDouble(v)).ToArray());
+                    break;
+                case DataType.Bool:
+                    columns[c].Values = result.Export(values.Select(v => v != null && Convert.ToBoolean(v) ? (byte)1 : (byte)0).ToArray());
+                    break;
+                case DataType.VectorFp32:
+                    columns[c].Values = result.Export(ExportRows<float>(values, dimension));
+                    break;
+                case DataType.VectorFp64:
+                    columns[c].Values = result.Export(ExportRows<double>(values, dimension));
+                    break;
+                case DataType.VectorFp16:
+                    columns[c].Values = result.Export(ExportRows<Half>(values, dimension));
+                    break;
+                case DataType.VectorInt8:
+                    columns[c].Values = result.Export(ExportRows<sbyte>(values, dimension));
+                    break;
+                case DataType.VectorInt16:
+                    columns[c].Values = result.Export(ExportRows<short>(values, dimension));
+                    break;
+                default:
+                    return Error(2, "unsupported column data type");
+            }
+
+            columns[c].NullBitmap = result.Export(nulls);
+        }
+
+        return Ok();
+    }
+
+    private static TValue[] ExportRows<TValue>(IReadOnlyList<object?> rows, int dimension)
+    {
+        return rows.SelectMany(v => (TValue[]?)v ?? new TValue[dimension]).ToArray();
+    }
+
+    private static (byte[] Bytes, int[] Offsets) EncodeStrings(IReadOnlyList<object?> values)
+    {
+        var bytes = new List<byte>();
+        var offsets = new int[values.Count + 1];
+        for (int i = 0; i < values.Count; i++)
+        {
+            if (values[i] is string str)
+            {
+                bytes.AddRange(System.Text.Encoding.UTF8.GetBytes(str));
+            }
+            offsets[i + 1] = bytes.Count;
+        }
+        return (bytes.ToArray(), offsets);
+    }
 }
 
 internal sealed class MockCollection
@@ -678,6 +2055,29 @@ internal sealed class MockCollection
     public Dictionary<string, MockDocument> Documents { get; } = new();
     public int FlushCount { get; set; }
     public int OptimizeCount { get; set; }
+    public NativeCollectionOptions Options { get; set; }
+    public NativeQueryCacheStats QueryCacheStats { get; set; }
+    public NativeOptimizePolicy? AutoOptimizePolicy { get; set; }
+    public Dictionary<string, NativeQueryParams> QueryDefaults { get; } = new();
+    public bool AutoOptimizePaused { get; set; }
+    public bool IsBulkLoading { get; set; }
+    public List<string> IndexedFields { get; set; } = new();
+    public List<string> DeferredIndexes { get; } = new();
+    public int FailDropIndexAt { get; set; }
+    public int FailCreateIndexCount { get; set; }
+    public bool IsReadOnly { get; set; }
+    public int RefreshCount { get; set; }
+    public bool IsSnapshot { get; set; }
+    public int SnapshotPins { get; set; }
+    public MockCollection? PinnedWriter { get; set; }
+    public NativeWarmupProgress WarmupProgress { get; set; }
+    public string? WarmupQueryField { get; set; }
+    public bool WarmupCancelled { get; set; }
+    public ManualResetEventSlim? WarmupGate { get; set; }
+    public MockImport? LastImport { get; set; }
+    public MockExport? LastExport { get; set; }
+
+    public Dictionary<string, MockFieldType> FieldTypes { get; set; } = new();
 
     public MockCollection(string path, CollectionSchema schema)
     {
@@ -686,12 +2086,48 @@ internal sealed class MockCollection
     }
 }
 
+internal readonly record struct MockFieldType(int DataType, int Dimension);
+
+internal sealed class MockImport
+{
+    public string Path { get; init; } = string.Empty;
+    public int Format { get; init; }
+    public string? VectorField { get; init; }
+    public string? PkColumn { get; init; }
+    public List<string> ScalarColumns { get; init; } = new();
+    public nuint ChunkRows { get; init; }
+    public bool Upsert { get; init; }
+}
+
+internal sealed class MockExport
+{
+    public string Path { get; init; } = string.Empty;
+    public int Format { get; init; }
+    public List<string> Fields { get; init; } = new();
+    public string? Filter { get; init; }
+    public string? PkColumn { get; init; }
+    public int Concurrency { get; init; }
+}
+
+internal sealed class MockScan
+{
+    public List<MockDocument> Documents { get; init; } = new();
+    public int BatchSize { get; init; }
+    public int Next { get; set; }
+}
+
+internal sealed class MockDocBatch
+{
+    public List<IntPtr> Slots { get; } = new();
+    public int Count { get; set; }
+}
+
 internal sealed class MockDocument
 {
     public string? Pk { get; set; }
     public double Score { get; set; }
     public Dictionary<string, object?> Fields { get; } = new();
-    public Dictionary<string, float[]> Vectors { get; } = new();
+    public Dictionary<string, Array> Vectors { get; } = new();
 
     public MockDocument Clone()
     {
@@ -706,7 +2142,7 @@ internal sealed class MockDocument
         }
         foreach (var (key, value) in Vectors)
         {
-            clone.Vectors[key] = (float[])value.Clone();
+            clone.Vectors[key] = (Array)value.Clone();
         }
         return clone;
     }
@@ -717,10 +2153,33 @@ internal sealed class MockQuery
     public int TopK { get; set; } = 10;
     public string? FieldName { get; set; }
     public float[]? Vector { get; set; }
+    public SparseVector? SparseVector { get; set; }
     public string? Filter { get; set; }
+    public NativeQueryParams? Params { get; set; }
+    public (HashSet<string> Pks, bool Allow)? IdFilter { get; set; }
 }
 
 internal sealed class MockResult
 {
+    private readonly List<IntPtr> _exportBuffers = new();
+
     public List<MockDocument> Documents { get; } = new();
+    public bool Truncated { get; init; }
+
+    public unsafe IntPtr Export<TValue>(TValue[] values) where TValue : unmanaged
+    {
+        var ptr = Marshal.AllocHGlobal(Math.Max(1, values.Length * sizeof(TValue)));
+        values.AsSpan().CopyTo(new Span<TValue>((void*)ptr, values.Length));
+        _exportBuffers.Add(ptr);
+        return ptr;
+    }
+
+    public void FreeExportBuffers()
+    {
+        foreach (var ptr in _exportBuffers)
+        {
+            Marshal.FreeHGlobal(ptr);
+        }
+        _exportBuffers.Clear();
+    }
 }
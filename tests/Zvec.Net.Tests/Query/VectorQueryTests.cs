@@ -86,6 +86,23 @@ public class VectorQueryTests
         Assert.Throws<ArgumentException>(() => VectorQuery.ById("embedding", ""));
     }
 
+    [Fact]
+    public void ByInt8Vector_ValidParams_CreatesQuery()
+    {
+        var query = VectorQuery.ByInt8Vector("embedding", new sbyte[] { 1, -2, 3 });
+
+        Assert.IsType<sbyte[]>(query.NativeVector);
+        Assert.Null(query.Vector);
+        Assert.True(query.HasVector);
+        Assert.False(query.IsSparse);
+    }
+
+    [Fact]
+    public void ByFloat16Vector_EmptyVector_ThrowsArgumentException()
+    {
+        Assert.Throws<ArgumentException>(() => VectorQuery.ByFloat16Vector("embedding", Array.Empty<Half>()));
+    }
+
     [Fact]
     public void BySparseVector_ValidParams_CreatesQuery()
     {
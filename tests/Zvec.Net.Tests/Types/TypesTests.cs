@@ -92,6 +92,14 @@ public class VectorPrecisionTests
         Assert.Equal(DataType.VectorInt8, dataType);
     }
 
+    [Fact]
+    public void ToDataType_Int16_ReturnsCorrectDataType()
+    {
+        var dataType = VectorPrecision.Int16.ToDataType();
+
+        Assert.Equal(DataType.VectorInt16, dataType);
+    }
+
     [Fact]
     public void ToDataType_SparseFloat32_ReturnsCorrectDataType()
     {